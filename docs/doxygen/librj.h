@@ -19,10 +19,20 @@
  *
  * \c binaryHeap.h contains the public interface for a binary heap type.
  *
+ * \c pairingHeap.h contains the public interface for a pairing heap type
+ * with constant time \e meld and \e decrease-key operations. See: "The
+ * Pairing Heap: A New Form of Self-Adjusting Heap", M. L. Fredman,
+ * R. Sedgewick, D. D. Sleator and R. E. Tarjan, Algorithmica, 1986,
+ * Vol. 1, pp. 111-129.
+ *
  * \c list.h contains the public interface for a doubly linked list type. 
  *
  * \c stack.h contains the public interface for a stack type. 
  *
+ * \c arena.h contains the public interface for an arena of fixed-size
+ * blocks. The binary tree types can allocate their nodes from an arena
+ * with, for example, \c redblackTreeCreateWithArena(). 
+ *
  * \c bsTree.h contains the public interface for a balanced tree type based
  * on the pseudo-code in the paper by \e Andersson. See: "Balanced Search
  * Trees Made Simple", Arne Andersson, Proc. Workshop on Algorithms and Data
@@ -47,6 +57,13 @@
  * Commun. ACM, June 1990, Vol. 33, No. 6, pp 668-676. Walker's source code
  * appears to no longer be available on the interwebs. A modified version is at:
  * https://github.com/flightaware/speedtables/tree/master/ctables/skiplists
+ * \c skipListLockFree.c is an alternative implementation of \c skipList.h
+ * that may be shared by threads without a lock. Links are updated with
+ * compare-and-swap, removed nodes are marked and removed nodes are
+ * reclaimed with epoch based reclamation. See: "A Pragmatic Implementation
+ * of Non-Blocking Linked-Lists", Timothy L. Harris, DISC 2001, and
+ * "Practical Lock-Freedom", Keir Fraser, University of Cambridge Technical
+ * Report 579, 2004.
  *
  * \c splayTree.h contains the public interface for a splay tree type. 
  * See :"Self-Adjusting Binary Search Trees", D.D. Sleator and R. E. Tarjan,
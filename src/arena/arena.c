@@ -0,0 +1,194 @@
+/**
+ * \file arena.c
+ *
+ * An \c arena_t implementation.
+ */
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+#include "arena_private.h"
+
+arena_t *
+arenaCreate(const size_t blockSize,
+            const size_t chunkBlocks,
+            const arenaAllocFunc_t alloc,
+            const arenaDeallocFunc_t dealloc,
+            const arenaDebugFunc_t debug,
+            void * const user)
+{
+  arena_t *arena;
+  size_t align = sizeof(arenaChunk_t);
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (blockSize == 0)
+    {
+      debug(__func__, __LINE__, user, "Request for blockSize==0!");
+      return NULL;
+    }
+  if (chunkBlocks == 0)
+    {
+      debug(__func__, __LINE__, user, "Request for chunkBlocks==0!");
+      return NULL;
+    }
+
+  /* The rounded block size and the chunk size must fit in a size_t */
+  if ((blockSize > (SIZE_MAX-align+1)) ||
+      ((((blockSize+align-1)/align)*align) >
+       ((SIZE_MAX-sizeof(arenaChunk_t))/chunkBlocks)))
+    {
+      debug(__func__, __LINE__, user,
+            "Chunk of %zu blocks of %zu bytes is too large!",
+            chunkBlocks, blockSize);
+      return NULL;
+    }
+
+  arena = alloc(sizeof(arena_t), user);
+  if (arena == NULL)
+    {
+      debug(__func__, __LINE__, user,
+            "Couldn't allocate %zu bytes for arena_t!",
+            sizeof(arena_t));
+      return NULL;
+    }
+
+  arena->alloc = alloc;
+  arena->dealloc = dealloc;
+  arena->debug = debug;
+  arena->user = user;
+  arena->blockSize = ((blockSize+align-1)/align)*align;
+  arena->chunkBlocks = chunkBlocks;
+  arena->chunks = NULL;
+  arena->freeList = NULL;
+  arena->unused = NULL;
+  arena->remaining = 0;
+  arena->size = 0;
+  arena->space = 0;
+
+  return arena;
+}
+
+void *
+arenaAlloc(arena_t * const arena)
+{
+  void *block;
+
+  if (arena == NULL)
+    {
+      return NULL;
+    }
+
+  /* Recycle a free block */
+  if (arena->freeList != NULL)
+    {
+      block = arena->freeList;
+      arena->freeList = arena->freeList->next;
+      arena->size = arena->size+1;
+      return block;
+    }
+
+  /* Allocate a new chunk */
+  if (arena->remaining == 0)
+    {
+      arenaChunk_t *chunk;
+      size_t chunkSize = sizeof(arenaChunk_t) +
+                         (arena->chunkBlocks*arena->blockSize);
+
+      chunk = (arenaChunk_t *)arena->alloc(chunkSize, arena->user);
+      if (chunk == NULL)
+        {
+          arena->debug(__func__, __LINE__, arena->user,
+                       "Couldn't allocate %zu bytes for chunk!", chunkSize);
+          return NULL;
+        }
+      chunk->next = arena->chunks;
+      arena->chunks = chunk;
+      arena->unused = (unsigned char *)(chunk+1);
+      arena->remaining = arena->chunkBlocks;
+      arena->space = arena->space+arena->chunkBlocks;
+    }
+
+  /* Take the next unused block in the chunk */
+  block = arena->unused;
+  arena->unused = arena->unused+arena->blockSize;
+  arena->remaining = arena->remaining-1;
+  arena->size = arena->size+1;
+
+  return block;
+}
+
+void
+arenaFree(arena_t * const arena, void * const block)
+{
+  arenaBlock_t *freeBlock;
+
+  if ((arena == NULL) || (block == NULL))
+    {
+      return;
+    }
+
+  freeBlock = (arenaBlock_t *)block;
+  freeBlock->next = arena->freeList;
+  arena->freeList = freeBlock;
+  arena->size = arena->size-1;
+}
+
+void
+arenaDestroy(arena_t * const arena)
+{
+  arenaChunk_t *chunk;
+
+  if (arena == NULL)
+    {
+      return;
+    }
+
+  chunk = arena->chunks;
+  while (chunk != NULL)
+    {
+      arenaChunk_t *next = chunk->next;
+      arena->dealloc(chunk, arena->user);
+      chunk = next;
+    }
+
+  arena->dealloc(arena, arena->user);
+}
+
+size_t
+arenaGetSize(const arena_t * const arena)
+{
+  if (arena == NULL)
+    {
+      return 0;
+    }
+
+  return arena->size;
+}
+
+size_t
+arenaGetSpace(const arena_t * const arena)
+{
+  if (arena == NULL)
+    {
+      return 0;
+    }
+
+  return arena->space;
+}
@@ -0,0 +1,148 @@
+/**
+ * \file arena.h
+ *
+ * Public interface for an arena type. An \e arena_t allocates fixed-size
+ * blocks of memory from larger chunks obtained from the caller's \e alloc()
+ * callback. Blocks returned to the arena are recycled through a free list.
+ * All chunks are returned to the caller's \e dealloc() callback when the
+ * arena is destroyed. An arena is intended for the nodes of the binary
+ * tree types so that a tree with many insertions and removals makes few
+ * calls to the memory allocator and the nodes are close together in memory.
+ */
+
+#if !defined(ARENA_H)
+#define ARENA_H
+
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstdbool>
+#include <cstddef>
+using std::size_t;
+extern "C" {
+#else
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#endif
+
+/**
+ * \e arena_t structure. An opaque type for an arena of fixed-size blocks.
+ */
+typedef struct arena_t arena_t;
+
+/**
+ * \e arena_t memory allocator.
+ *
+ * Memory allocation call-back.
+ *
+ * \param size amount of memory requested
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to the memory allocated. \e NULL indicates failure.
+ */
+typedef void *(*arenaAllocFunc_t)(const size_t size, void * const user);
+
+/**
+ * \e arena_t memory de-allocator.
+ *
+ * Memory deallocation call-back.
+ *
+ * \param ptr pointer to memory to be deallocated
+ * \param user \e void pointer to user data to be echoed by callbacks
+ */
+typedef void (*arenaDeallocFunc_t)(void * const ptr, void * const user);
+
+/**
+ * Debugging message.
+ *
+ * Callback function to output a debugging message. Accepts a
+ * variable argument list like \e printf().
+ *
+ * \param function name
+ * \param line number
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \param format string
+ * \param ... variable argument list
+ */
+typedef void (*arenaDebugFunc_t)(const char *function,
+                                 const unsigned int line,
+                                 void * const user,
+                                 const char *format,
+                                 ...);
+
+/**
+ * Create an empty arena.
+ *
+ * Creates and initialises an empty \e arena_t instance. No chunks are
+ * allocated until the first call to \e arenaAlloc(). Fails if the size
+ * of a chunk would not fit in a \e size_t.
+ *
+ * \param blockSize size in bytes of each block
+ * \param chunkBlocks number of blocks allocated in each chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param debug message function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to an \e arena_t. \e NULL indicates failure.
+ */
+arena_t *arenaCreate(const size_t blockSize,
+                     const size_t chunkBlocks,
+                     const arenaAllocFunc_t alloc,
+                     const arenaDeallocFunc_t dealloc,
+                     const arenaDebugFunc_t debug,
+                     void * const user);
+
+/**
+ * Allocate a block from the arena.
+ *
+ * Returns a recycled block from the free list if one is available.
+ * Otherwise returns the next unused block in the current chunk, allocating
+ * a new chunk if necessary. The block contents are not initialised.
+ *
+ * \param arena \e arena_t pointer
+ * \return \e void pointer to the block. \e NULL indicates failure.
+ */
+void *arenaAlloc(arena_t * const arena);
+
+/**
+ * Return a block to the arena.
+ *
+ * Places the block on the free list for re-use by \e arenaAlloc(). The
+ * block must have been allocated by \e arenaAlloc() for the same arena.
+ *
+ * \param arena \e arena_t pointer
+ * \param block \e void pointer to the block
+ */
+void arenaFree(arena_t * const arena, void * const block);
+
+/**
+ * Destroy the arena.
+ *
+ * Deallocates all the chunks and the arena. Any blocks still in use
+ * become invalid.
+ *
+ * \param arena \e arena_t pointer
+ */
+void arenaDestroy(arena_t * const arena);
+
+/**
+ * Get the number of blocks in use.
+ *
+ * \param arena \e arena_t pointer
+ * \return number of blocks allocated and not yet freed
+ */
+size_t arenaGetSize(const arena_t * const arena);
+
+/**
+ * Get the number of blocks available without allocating a new chunk.
+ *
+ * \param arena \e arena_t pointer
+ * \return number of blocks in all the chunks allocated
+ */
+size_t arenaGetSpace(const arena_t * const arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,4 @@
+# No programs in this directory. arena.c is compiled into the programs
+# of the tree types that use it.
+
+VPATH += src/arena
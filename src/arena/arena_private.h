@@ -0,0 +1,103 @@
+/**
+ * \file arena_private.h
+ *
+ * Private definition for an arena type.
+ */
+
+#if !defined(ARENA_PRIVATE_H)
+#define ARENA_PRIVATE_H
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstdbool>
+#include <cstddef>
+using std::size_t;
+using std::max_align_t;
+extern "C" {
+#else
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#endif
+
+#include "arena.h"
+
+/**
+ * \c arenaBlock_t structure.
+ *
+ * A free block in the arena is overlaid with a pointer to the next free
+ * block.
+ */
+typedef struct arenaBlock_t
+{
+  struct arenaBlock_t *next;
+  /**< Pointer to the next block in the free list. */
+} arenaBlock_t;
+
+/**
+ * \c arenaChunk_t structure.
+ *
+ * Each chunk begins with a header linking it to the previously allocated
+ * chunk. The union pads the header so that the first block is aligned for
+ * any type.
+ */
+typedef union arenaChunk_t
+{
+  union arenaChunk_t *next;
+  /**< Pointer to the previously allocated chunk. */
+
+  max_align_t align;
+  /**< Alignment of the blocks following the chunk header. */
+} arenaChunk_t;
+
+/**
+ * \c arena_t structure.
+ *
+ * Blocks are taken from the free list if it is not empty. Otherwise blocks
+ * are taken in order from the unused part of the most recently allocated
+ * chunk so that a new chunk need not be threaded onto the free list.
+ */
+struct arena_t
+{
+  arenaAllocFunc_t alloc;
+  /**< Memory allocator callback function for \c arena_t. */
+
+  arenaDeallocFunc_t dealloc;
+  /**< Memory de-allocator callback function for \c arena_t. */
+
+  arenaDebugFunc_t debug;
+  /**< Debugging message callback function. */
+
+  void *user;
+  /**< Placeholder for user data in callbacks. */
+
+  size_t blockSize;
+  /**< Size of each block rounded up to a multiple of the alignment. */
+
+  size_t chunkBlocks;
+  /**< Number of blocks in each chunk. */
+
+  arenaChunk_t *chunks;
+  /**< List of allocated chunks. */
+
+  arenaBlock_t *freeList;
+  /**< List of blocks returned to the arena. */
+
+  unsigned char *unused;
+  /**< Next unused block in the most recently allocated chunk. */
+
+  size_t remaining;
+  /**< Number of unused blocks in the most recently allocated chunk. */
+
+  size_t size;
+  /**< Number of blocks in use. */
+
+  size_t space;
+  /**< Number of blocks in all allocated chunks. */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
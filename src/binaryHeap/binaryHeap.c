@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <unistd.h>
 
@@ -17,29 +18,59 @@
 /**
  * Private helper function for binary heap implementation.
  *
- * Find the left child of a binary heap index.
+ * Test if a binary heap index has any children in the heap. The test
+ * avoids overflow in the calculation of the first child index.
  *
+ * \param binaryHeap pointer to \e binaryHeap_t
  * \param i binary heap parent index.
- * \return left child index of binary heap index.
+ * \return true if the first child index is in the heap.
+ */
+static bool 
+binaryHeapHasChild(const binaryHeap_t * const binaryHeap, const size_t i)
+{
+  return ((binaryHeap->size >= 2) && 
+          (i <= ((binaryHeap->size-2)/binaryHeap->arity)));
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Find the first child of a binary heap index. The \e arity children of
+ * an index are adjacent in the heap array.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param i binary heap parent index.
+ * \return first child index of binary heap index.
  */
 static size_t 
-binaryHeapLeft(const size_t i)
+binaryHeapChild(const binaryHeap_t * const binaryHeap, const size_t i)
 {
-  return (2*i)+1;
+  return (binaryHeap->arity*i)+1;
 }
 
 /**
  * Private helper function for binary heap implementation.
  *
- * Find the right child index of a binary heap index.
+ * Find the index after the last child of a binary heap index that is in
+ * the heap.
  *
+ * \param binaryHeap pointer to \e binaryHeap_t
  * \param i binary heap parent index.
- * \return right child index of a binary heap index.
+ * \return index after the last child of binary heap index.
  */
 static size_t 
-binaryHeapRight(const size_t i)
+binaryHeapChildEnd(const binaryHeap_t * const binaryHeap, const size_t i)
 {
-  return 2*(i+1);
+  size_t c = binaryHeapChild(binaryHeap, i);
+
+  if ((binaryHeap->size-c) > binaryHeap->arity)
+    {
+      return c+binaryHeap->arity;
+    }
+  else
+    {
+      return binaryHeap->size;
+    }
 }
 
 /**
@@ -47,11 +78,12 @@ binaryHeapRight(const size_t i)
  *
  * Find the parent index of a binary heap index.
  *
+ * \param binaryHeap pointer to \e binaryHeap_t
  * \param i binary heap index.
  * \return parent index of binary heap index.
  */
 static size_t 
-binaryHeapParent(const size_t i)
+binaryHeapParent(const binaryHeap_t * const binaryHeap, const size_t i)
 {
   if (i == 0)
     {
@@ -59,7 +91,7 @@ binaryHeapParent(const size_t i)
     }
   else 
     {
-      return (i-1)/2;
+      return (i-1)/binaryHeap->arity;
     }
 }
 
@@ -93,6 +125,23 @@ binaryHeapSwap(binaryHeap_t * const binaryHeap, const size_t i, const size_t j)
   tmp = (binaryHeap->heap)[i];
   (binaryHeap->heap)[i] = (binaryHeap->heap)[j];
   (binaryHeap->heap)[j] = tmp;
+
+  /* Keep the handles pointing at their entries */
+  if (binaryHeap->handles != NULL)
+    {
+      binaryHeapHandle_t *tmpHandle = (binaryHeap->handles)[i];
+
+      (binaryHeap->handles)[i] = (binaryHeap->handles)[j];
+      (binaryHeap->handles)[j] = tmpHandle;
+      if ((binaryHeap->handles)[i] != NULL)
+        {
+          (binaryHeap->handles)[i]->index = i;
+        }
+      if ((binaryHeap->handles)[j] != NULL)
+        {
+          (binaryHeap->handles)[j]->index = j;
+        }
+    }
 }
 
 /**
@@ -150,12 +199,12 @@ binaryHeapBubbleUp(binaryHeap_t * const binaryHeap, size_t i)
       return;
     }
 
-  size_t p = binaryHeapParent(i);
+  size_t p = binaryHeapParent(binaryHeap, i);
   while((i>0) && ((binaryHeapCompareGreater)(binaryHeap, p, i) == true))
     {
       binaryHeapSwap(binaryHeap, p, i);
       i = p;
-      p = binaryHeapParent(i);
+      p = binaryHeapParent(binaryHeap, i);
     }
 
   return;
@@ -165,7 +214,8 @@ binaryHeapBubbleUp(binaryHeap_t * const binaryHeap, size_t i)
  * Private helper function for binary heap implementation.
  *
  * Move an entry down the binary heap to a location in which it
- * satisfies the heap property. 
+ * satisfies the heap property. At each level the entry is compared with
+ * the least of its children, which are adjacent in the heap array.
  *
  * \param binaryHeap pointer to \e binaryHeap_t
  * \param i index of an entry in the binary heap
@@ -197,37 +247,29 @@ binaryHeapTrickleDown(binaryHeap_t * const binaryHeap, size_t i)
   /* Move the i'th entry down the heap */
   do
     {
-      size_t n,r,l;
+      size_t n,c,end;
 
       do_swap = false;
+      if (binaryHeapHasChild(binaryHeap, i) == false)
+        {
+          break;
+        }
 
-      /* Compare parent with right child */
-      r = binaryHeapRight(i);
-      if ((r < binaryHeap->size) && 
-          (binaryHeapCompareGreater(binaryHeap, i, r) == true))
+      /* Find the last of the least children */
+      n = binaryHeapChild(binaryHeap, i);
+      end = binaryHeapChildEnd(binaryHeap, i);
+      for (c=n+1; c<end; c++)
         {
-          do_swap = true;
-          /* Compare right and left children */
-          l = binaryHeapLeft(i);
-          if (binaryHeapCompareGreater(binaryHeap, r, l) == true)
-            {
-              n = l;
-            }
-          else
+          if (binaryHeapCompareGreater(binaryHeap, c, n) == false)
             {
-              n = r;
+              n = c;
             }
         }
-      /* Compare parent with left child */
-      else
+
+      /* Compare parent with the least child */
+      if (binaryHeapCompareGreater(binaryHeap, i, n) == true)
         {
-          l = binaryHeapLeft(i);
-          if ((l < binaryHeap->size) && 
-              binaryHeapCompareGreater(binaryHeap, i, l) == true)
-            {
-              do_swap = true;
-              n = l;
-            }
+          do_swap = true;
         }
 
       /* If necessary, swap the entries */
@@ -242,6 +284,331 @@ binaryHeapTrickleDown(binaryHeap_t * const binaryHeap, size_t i)
   return;
 }
 
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Move the last entry of the binary heap, and its handle, to an index.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param i index of an entry in the binary heap
+ */
+static void
+binaryHeapMoveLast(binaryHeap_t * const binaryHeap, const size_t i)
+{
+  size_t last = (binaryHeap->size)-1;
+
+  (binaryHeap->heap)[i] = (binaryHeap->heap)[last];
+  if (binaryHeap->handles != NULL)
+    {
+      (binaryHeap->handles)[i] = (binaryHeap->handles)[last];
+      if ((binaryHeap->handles)[i] != NULL)
+        {
+          (binaryHeap->handles)[i]->index = i;
+        }
+    }
+  binaryHeap->size -= 1;
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Detach the handle of an entry, if it has one, as the entry leaves the
+ * binary heap. The handle is deallocated when the caller releases it.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param i index of an entry in the binary heap
+ */
+static void
+binaryHeapDetachHandle(binaryHeap_t * const binaryHeap, const size_t i)
+{
+  if ((binaryHeap->handles != NULL) && ((binaryHeap->handles)[i] != NULL))
+    {
+      (binaryHeap->handles)[i]->index = SIZE_MAX;
+      (binaryHeap->handles)[i] = NULL;
+    }
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Double the space of the binary heap array and, if it exists, of the
+ * array of handles until there is space for at least \e space entries.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param space number of entries required
+ * \return \e bool indicating success
+ */
+static bool
+binaryHeapGrow(binaryHeap_t * const binaryHeap, const size_t space)
+{
+  void **new_heap = NULL;
+  binaryHeapHandle_t **new_handles = NULL;
+  size_t new_space = binaryHeap->space;
+  size_t new_alloc;
+
+  if (space > (SIZE_MAX/(2*sizeof(void *))))
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "Too many entries(%zu)!", space);
+      return false;
+    }
+  while (new_space < space)
+    {
+      new_space = 2*new_space;
+    }
+  new_alloc = sizeof(void *)*new_space;
+
+  new_heap = (void **)binaryHeap->alloc(new_alloc, binaryHeap->user);
+  if (new_heap == NULL)
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+            "Couldn't allocate %zd bytes for new binaryHeap->heap!", 
+            new_alloc);
+      return false;
+    }
+  if (binaryHeap->handles != NULL)
+    {
+      new_alloc = sizeof(binaryHeapHandle_t *)*new_space;
+      new_handles = (binaryHeapHandle_t **)binaryHeap->alloc(new_alloc, 
+                                                             binaryHeap->user);
+      if (new_handles == NULL)
+        {
+          binaryHeap->dealloc(new_heap, binaryHeap->user);
+          binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                "Couldn't allocate %zd bytes for new binaryHeap->handles!", 
+                new_alloc);
+          return false;
+        }
+      memcpy(new_handles, binaryHeap->handles, 
+             sizeof(binaryHeapHandle_t *)*binaryHeap->space);
+      binaryHeap->dealloc(binaryHeap->handles, binaryHeap->user);
+      binaryHeap->handles = new_handles;
+    }
+
+  memcpy(new_heap, binaryHeap->heap, 
+         sizeof(void *)*binaryHeap->space);
+  binaryHeap->dealloc(binaryHeap->heap, binaryHeap->user);
+  binaryHeap->heap = new_heap;
+
+  binaryHeap->space = new_space;
+
+  return true;
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Test if an entry would be kept by a full binary heap in top-K mode.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param entry \e void pointer to caller's entry data 
+ * \return true if the entry is greater than the root entry
+ */
+static bool
+binaryHeapBeatsRoot(binaryHeap_t * const binaryHeap, void * const entry)
+{
+  return ((binaryHeap->compare)(entry, (binaryHeap->heap)[0], 
+                                binaryHeap->user) == compareGreater);
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Replace the root entry of the binary heap in place and move the new
+ * entry down the heap. The old root entry and its handle are deleted as
+ * if popped.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param entry \e void pointer to caller's entry data 
+ * \param handle pointer to the \e binaryHeapHandle_t of the entry. \e NULL
+ * if the entry has no handle.
+ * \return \e void pointer to the entry data installed. \e NULL indicates
+ * failure.
+ */
+static void *
+binaryHeapReplaceRoot(binaryHeap_t * const binaryHeap, 
+                      void * const entry,
+                      binaryHeapHandle_t * const handle)
+{
+  void *new_entry;
+  if (binaryHeap->duplicateEntry != NULL)
+    {
+      new_entry = binaryHeap->duplicateEntry(entry, binaryHeap->user);
+      if (new_entry == NULL)
+        {
+          binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                            "Couldn't duplicate entry!");
+          return NULL;
+        }
+    }
+  else
+    {
+      new_entry = entry;
+    }
+
+  if (binaryHeap->deleteEntry != NULL)
+    {
+      (binaryHeap->deleteEntry)((binaryHeap->heap)[0], binaryHeap->user);
+    }
+  binaryHeapDetachHandle(binaryHeap, 0);
+  (binaryHeap->heap)[0] = new_entry;
+  if (binaryHeap->handles != NULL)
+    {
+      (binaryHeap->handles)[0] = handle;
+      if (handle != NULL)
+        {
+          handle->index = 0;
+        }
+    }
+  binaryHeapTrickleDown(binaryHeap, 0);
+
+  return new_entry;
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Push an entry onto the binary heap with an optional handle. In top-K
+ * mode an entry that is not greater than the root of a full heap is
+ * rejected.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param entry \e void pointer to caller's entry data 
+ * \param handle pointer to the \e binaryHeapHandle_t of the entry. \e NULL
+ * if the entry has no handle.
+ * \return \e void pointer to the entry data installed. \e NULL indicates
+ * failure or a rejected entry.
+ */
+static void *
+binaryHeapPushEntry(binaryHeap_t * const binaryHeap, 
+                    void * const entry,
+                    binaryHeapHandle_t * const handle)
+{
+  /* A full heap in top-K mode replaces the root or rejects the entry */
+  if ((binaryHeap->topK != 0) && (binaryHeap->size == binaryHeap->topK))
+    {
+      if (binaryHeapBeatsRoot(binaryHeap, entry) == false)
+        {
+          return NULL;
+        }
+      return binaryHeapReplaceRoot(binaryHeap, entry, handle);
+    }
+
+  if (binaryHeap->size == binaryHeap->space)
+    {
+      if (binaryHeapGrow(binaryHeap, binaryHeap->size+1) == false)
+        {
+          return NULL;
+        }
+    }
+
+  void *new_entry;
+  if (binaryHeap->duplicateEntry != NULL)
+    {
+      new_entry = binaryHeap->duplicateEntry(entry, binaryHeap->user);
+      if (new_entry == NULL)
+        {
+          binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                            "Couldn't duplicate entry!");
+          return NULL;
+        }
+    }
+  else
+    {
+      new_entry = entry;
+    }
+  (binaryHeap->heap)[binaryHeap->size] = new_entry;
+  if (binaryHeap->handles != NULL)
+    {
+      (binaryHeap->handles)[binaryHeap->size] = handle;
+      if (handle != NULL)
+        {
+          handle->index = binaryHeap->size;
+        }
+    }
+  binaryHeap->size += 1;
+  binaryHeapBubbleUp(binaryHeap, (binaryHeap->size)-1);
+
+  return new_entry;
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Restore the heap property of the whole binary heap array with Floyd's
+ * bottom-up method. Each parent, from the last to the root, is moved
+ * down below its children. Takes time proportional to the number of
+ * entries.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ */
+static void
+binaryHeapHeapify(binaryHeap_t * const binaryHeap)
+{
+  size_t i;
+
+  if (binaryHeap->size < 2)
+    {
+      return;
+    }
+
+  i = binaryHeapParent(binaryHeap, (binaryHeap->size)-1)+1;
+  while (i > 0)
+    {
+      i = i-1;
+      binaryHeapTrickleDown(binaryHeap, i);
+    }
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Find the number of levels of a binary heap with \e n entries.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param n number of entries
+ * \return number of levels
+ */
+static size_t
+binaryHeapLevels(const binaryHeap_t * const binaryHeap, size_t n)
+{
+  size_t levels = 0;
+
+  while (n > 0)
+    {
+      n = n/binaryHeap->arity;
+      levels = levels+1;
+    }
+
+  return levels;
+}
+
+/**
+ * Private helper function for binary heap implementation.
+ *
+ * Check that a handle belongs to an entry in the binary heap.
+ *
+ * \param binaryHeap pointer to \e binaryHeap_t
+ * \param handle pointer to \e binaryHeapHandle_t
+ * \return \e bool indicating a valid handle
+ */
+static bool
+binaryHeapValidHandle(binaryHeap_t * const binaryHeap, 
+                      const binaryHeapHandle_t * const handle)
+{
+  if ((handle == NULL) ||
+      (binaryHeap->handles == NULL) ||
+      (handle->index >= binaryHeap->size) ||
+      ((binaryHeap->handles)[handle->index] != handle))
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "invalid handle!");
+      return false;
+    }
+
+  return true;
+}
+
 binaryHeap_t *
 binaryHeapCreate(const binaryHeapAllocFunc_t alloc, 
                  const binaryHeapDeallocFunc_t dealloc, 
@@ -250,6 +617,20 @@ binaryHeapCreate(const binaryHeapAllocFunc_t alloc,
                  const binaryHeapDebugFunc_t debug,
                  const binaryHeapCompFunc_t compare,
                  void * const user)
+{
+  return binaryHeapCreateDary(2, alloc, dealloc, duplicateEntry, deleteEntry,
+                              debug, compare, user);
+}
+
+binaryHeap_t *
+binaryHeapCreateDary(const size_t arity,
+                     const binaryHeapAllocFunc_t alloc, 
+                     const binaryHeapDeallocFunc_t dealloc, 
+                     const binaryHeapDuplicateEntryFunc_t duplicateEntry, 
+                     const binaryHeapDeleteEntryFunc_t deleteEntry, 
+                     const binaryHeapDebugFunc_t debug,
+                     const binaryHeapCompFunc_t compare,
+                     void * const user)
 {
   binaryHeap_t *binaryHeap = NULL;
 
@@ -257,6 +638,11 @@ binaryHeapCreate(const binaryHeapAllocFunc_t alloc,
     {
       return NULL;
     }
+  if (arity < 2)
+    {
+      debug(__func__, __LINE__, user, "Invalid arity(%zu)!", arity);
+      return NULL;
+    }
   if (alloc == NULL)
     {
       debug(__func__, __LINE__, user, "Invalid alloc() function!");
@@ -302,13 +688,44 @@ binaryHeapCreate(const binaryHeapAllocFunc_t alloc,
   binaryHeap->deleteEntry = deleteEntry;
   binaryHeap->debug = debug;
   binaryHeap->compare = compare;
+  binaryHeap->arity = arity;
+  binaryHeap->handles = NULL;
   binaryHeap->size = 0;
   binaryHeap->space = 1;
+  binaryHeap->topK = 0;
   binaryHeap->user = user;
   
   return binaryHeap;
 }
 
+binaryHeap_t *
+binaryHeapCreateFrom(void * const * const entries,
+                     const size_t n,
+                     const binaryHeapAllocFunc_t alloc, 
+                     const binaryHeapDeallocFunc_t dealloc, 
+                     const binaryHeapDuplicateEntryFunc_t duplicateEntry, 
+                     const binaryHeapDeleteEntryFunc_t deleteEntry, 
+                     const binaryHeapDebugFunc_t debug,
+                     const binaryHeapCompFunc_t compare,
+                     void * const user)
+{
+  binaryHeap_t *binaryHeap;
+
+  binaryHeap = binaryHeapCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                                debug, compare, user);
+  if (binaryHeap == NULL)
+    {
+      return NULL;
+    }
+  if (binaryHeapPushBatch(binaryHeap, entries, n) == false)
+    {
+      binaryHeapDestroy(binaryHeap);
+      return NULL;
+    }
+
+  return binaryHeap;
+}
+
 void *
 binaryHeapPush(binaryHeap_t * const binaryHeap, void * const entry)
 {
@@ -323,51 +740,310 @@ binaryHeapPush(binaryHeap_t * const binaryHeap, void * const entry)
       return NULL;
     }
 
-  if (binaryHeap->size == binaryHeap->space)
-    {
-      void **new_heap = NULL;
-      size_t new_space = 2*binaryHeap->space;
-      size_t new_alloc = sizeof(void *)*new_space;
+  return binaryHeapPushEntry(binaryHeap, entry, NULL);
+}
 
-      new_heap = (void **)binaryHeap->alloc(new_alloc, 
-                                                        binaryHeap->user);
-      if (new_heap == NULL)
+bool
+binaryHeapPushBatch(binaryHeap_t * const binaryHeap, 
+                    void * const * const entries,
+                    const size_t n)
+{
+  size_t i, m, start, total;
+
+  if (binaryHeap == NULL)
+    {
+      return false;
+    }
+  if ((entries == NULL) && (n != 0))
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "invalid entries == NULL!");
+      return false;
+    }
+  for (i=0; i<n; i++)
+    {
+      if (entries[i] == NULL)
         {
           binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
-                "Couldn't allocate %zd bytes for new binaryHeap->heap!", 
-                new_alloc);
-          return NULL;
+                            "invalid entries[%zu] == NULL!", i);
+          return false;
         }
+    }
+  if (n > (SIZE_MAX-binaryHeap->size))
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "Too many entries(%zu)!", n);
+      return false;
+    }
 
-      memcpy(new_heap, binaryHeap->heap, 
-             sizeof(void *)*binaryHeap->space);
-      binaryHeap->dealloc(binaryHeap->heap, binaryHeap->user);
-      binaryHeap->heap = new_heap;
+  /* In top-K mode only fill the heap from the batch */
+  m = n;
+  if ((binaryHeap->topK != 0) && (m > (binaryHeap->topK-binaryHeap->size)))
+    {
+      m = binaryHeap->topK-binaryHeap->size;
+    }
 
-      binaryHeap->space = new_space;
+  start = binaryHeap->size;
+  total = start+m;
+  if ((total > binaryHeap->space) && 
+      (binaryHeapGrow(binaryHeap, total) == false))
+    {
+      return false;
     }
 
-  void *new_entry;
-  if (binaryHeap->duplicateEntry != NULL)
+  /* Append the entries. If one can't be duplicated then undo the batch. */
+  for (i=0; i<m; i++)
     {
-      new_entry = binaryHeap->duplicateEntry(entry, binaryHeap->user);
-      if (new_entry == NULL)
+      void *new_entry = entries[i];
+
+      if (binaryHeap->duplicateEntry != NULL)
+        {
+          new_entry = binaryHeap->duplicateEntry(entries[i], binaryHeap->user);
+          if (new_entry == NULL)
+            {
+              while ((i > 0) && (binaryHeap->deleteEntry != NULL))
+                {
+                  i = i-1;
+                  binaryHeap->deleteEntry((binaryHeap->heap)[start+i], 
+                                          binaryHeap->user);
+                }
+              binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                                "Couldn't duplicate entry!");
+              return false;
+            }
+        }
+      (binaryHeap->heap)[start+i] = new_entry;
+      if (binaryHeap->handles != NULL)
+        {
+          (binaryHeap->handles)[start+i] = NULL;
+        }
+    }
+
+  /* Heapify the whole array if that costs less than moving each new
+     entry up the heap */
+  binaryHeap->size = total;
+  if ((2*total) <= (m*binaryHeapLevels(binaryHeap, total)))
+    {
+      binaryHeapHeapify(binaryHeap);
+    }
+  else
+    {
+      for (i=start; i<total; i++)
+        {
+          binaryHeapBubbleUp(binaryHeap, i);
+        }
+    }
+
+  /* Offer the rest of the batch to the full heap in turn */
+  for (i=m; i<n; i++)
+    {
+      if ((binaryHeapBeatsRoot(binaryHeap, entries[i]) == true) &&
+          (binaryHeapReplaceRoot(binaryHeap, entries[i], NULL) == NULL))
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+bool
+binaryHeapSetTopK(binaryHeap_t * const binaryHeap, const size_t k)
+{
+  if (binaryHeap == NULL)
+    {
+      return false;
+    }
+  if (binaryHeap->size != 0)
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "Can't set top-K of a binary heap with entries!");
+      return false;
+    }
+
+  /* Allocate all the space now so that binaryHeapPush() never grows */
+  if ((k > binaryHeap->space) && (binaryHeapGrow(binaryHeap, k) == false))
+    {
+      return false;
+    }
+  binaryHeap->topK = k;
+
+  return true;
+}
+
+bool
+binaryHeapOffer(binaryHeap_t * const binaryHeap, void * const entry)
+{
+  if (binaryHeap == NULL)
+    {
+      return false;
+    }
+  if (entry == NULL)
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "invalid entry == NULL!");
+      return false;
+    }
+
+  return (binaryHeapPushEntry(binaryHeap, entry, NULL) != NULL);
+}
+
+binaryHeapHandle_t *
+binaryHeapPushHandle(binaryHeap_t * const binaryHeap, void * const entry)
+{
+  binaryHeapHandle_t *handle;
+
+  if (binaryHeap == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "invalid entry == NULL!");
+      return NULL;
+    }
+
+  /* Allocate the array of handles on first use */
+  if (binaryHeap->handles == NULL)
+    {
+      size_t new_alloc = sizeof(binaryHeapHandle_t *)*binaryHeap->space;
+
+      binaryHeap->handles = 
+        (binaryHeapHandle_t **)binaryHeap->alloc(new_alloc, binaryHeap->user);
+      if (binaryHeap->handles == NULL)
         {
-          binaryHeap->dealloc(new_entry, binaryHeap->user);
           binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
-                            "Couldn't duplicate entry!");
+                "Couldn't allocate %zd bytes for binaryHeap->handles!", 
+                new_alloc);
           return NULL;
         }
+      for (size_t i=0; i<binaryHeap->space; i++)
+        {
+          (binaryHeap->handles)[i] = NULL;
+        }
+    }
+
+  handle = (binaryHeapHandle_t *)binaryHeap->alloc(sizeof(binaryHeapHandle_t),
+                                                   binaryHeap->user);
+  if (handle == NULL)
+    {
+      binaryHeap->debug(__func__, __LINE__, binaryHeap->user, 
+                        "Couldn't allocate %zd bytes for handle!", 
+                        sizeof(binaryHeapHandle_t));
+      return NULL;
+    }
+  if (binaryHeapPushEntry(binaryHeap, entry, handle) == NULL)
+    {
+      binaryHeap->dealloc(handle, binaryHeap->user);
+      return NULL;
+    }
+
+  return handle;
+}
+
+void *
+binaryHeapGetEntry(binaryHeap_t * const binaryHeap, 
+                   const binaryHeapHandle_t * const handle)
+{
+  if (binaryHeap == NULL)
+    {
+      return NULL;
+    }
+  if (binaryHeapValidHandle(binaryHeap, handle) == false)
+    {
+      return NULL;
+    }
+
+  return (binaryHeap->heap)[handle->index];
+}
+
+bool
+binaryHeapUpdate(binaryHeap_t * const binaryHeap, 
+                 const binaryHeapHandle_t * const handle)
+{
+  size_t i;
+
+  if (binaryHeap == NULL)
+    {
+      return false;
+    }
+  if (binaryHeapValidHandle(binaryHeap, handle) == false)
+    {
+      return false;
+    }
+
+  /* The entry moves either up or down the heap */
+  i = handle->index;
+  binaryHeapBubbleUp(binaryHeap, i);
+  if (handle->index == i)
+    {
+      binaryHeapTrickleDown(binaryHeap, i);
+    }
+
+  return true;
+}
+
+void *
+binaryHeapRemove(binaryHeap_t * const binaryHeap, 
+                 binaryHeapHandle_t * const handle)
+{
+  size_t i;
+
+  if (binaryHeap == NULL)
+    {
+      return NULL;
+    }
+  if (binaryHeapValidHandle(binaryHeap, handle) == false)
+    {
+      return NULL;
+    }
+
+  i = handle->index;
+  void *entry = (binaryHeap->heap)[i];
+  if (binaryHeap->deleteEntry != NULL)
+    {
+      (binaryHeap->deleteEntry)(entry, binaryHeap->user);
+      entry = NULL;
+    }
+  binaryHeapDetachHandle(binaryHeap, i);
+
+  /* Fill the hole with the last entry and move it up or down */
+  if (i != (binaryHeap->size)-1)
+    {
+      binaryHeapMoveLast(binaryHeap, i);
+      binaryHeapBubbleUp(binaryHeap, i);
+      binaryHeapTrickleDown(binaryHeap, i);
     }
   else
     {
-      new_entry = entry;
+      binaryHeap->size -= 1;
     }
-  (binaryHeap->heap)[binaryHeap->size] = new_entry;
-  binaryHeap->size += 1;
-  binaryHeapBubbleUp(binaryHeap, (binaryHeap->size)-1);
 
-  return new_entry;
+  return entry;
+}
+
+bool
+binaryHeapReleaseHandle(binaryHeap_t * const binaryHeap, 
+                        binaryHeapHandle_t * const handle)
+{
+  if ((binaryHeap == NULL) || (handle == NULL))
+    {
+      return false;
+    }
+
+  /* The entry of an attached handle stays in the heap without it */
+  if (handle->index != SIZE_MAX)
+    {
+      if (binaryHeapValidHandle(binaryHeap, handle) == false)
+        {
+          return false;
+        }
+      (binaryHeap->handles)[handle->index] = NULL;
+    }
+  binaryHeap->dealloc(handle, binaryHeap->user);
+
+  return true;
 }
 
 void *
@@ -410,8 +1086,8 @@ binaryHeapPop(binaryHeap_t * const binaryHeap)
       entry = NULL;
     }
 
-  (binaryHeap->heap)[0] = (binaryHeap->heap)[(binaryHeap->size)-1];
-  binaryHeap->size -= 1;
+  binaryHeapDetachHandle(binaryHeap, 0);
+  binaryHeapMoveLast(binaryHeap, 0);
   binaryHeapTrickleDown(binaryHeap, 0);
 
   return entry;
@@ -437,6 +1113,13 @@ binaryHeapClear(binaryHeap_t * const binaryHeap)
           binaryHeap->deleteEntry(entry,binaryHeap->user);
         }
     }
+  if (binaryHeap->handles != NULL)
+    {
+      for (size_t i=0; i<binaryHeap->size; i++)
+        {
+          binaryHeapDetachHandle(binaryHeap, i);
+        }
+    }
 
   binaryHeap->size = 0;
 
@@ -451,10 +1134,27 @@ binaryHeapDestroy(binaryHeap_t * const binaryHeap)
       return;
     }
 
+  /* Deallocate the handles of the entries in the heap */
+  if (binaryHeap->handles != NULL)
+    {
+      for (size_t i=0; i<binaryHeap->size; i++)
+        {
+          if ((binaryHeap->handles)[i] != NULL)
+            {
+              binaryHeap->dealloc((binaryHeap->handles)[i], binaryHeap->user);
+              (binaryHeap->handles)[i] = NULL;
+            }
+        }
+    }
+
   /* Get rid of all entries */
   binaryHeapClear(binaryHeap);
   
   /* Free the binaryHeap_t */
+  if (binaryHeap->handles != NULL)
+    {
+      (binaryHeap->dealloc)(binaryHeap->handles, binaryHeap->user);
+    }
   (binaryHeap->dealloc)(binaryHeap->heap, binaryHeap->user);
   (binaryHeap->dealloc)(binaryHeap, binaryHeap->user);
 }
@@ -500,14 +1200,18 @@ binaryHeapWalk(binaryHeap_t * const binaryHeap, const binaryHeapWalkFunc_t walk)
 
   for (size_t i=0; i<binaryHeap->size; i++)
     {
-      fprintf(stdout,"Node %zu : parent %zu : ", i, binaryHeapParent(i));
-      if (binaryHeapLeft(i) < binaryHeap->size)
+      fprintf(stdout,"Node %zu : parent %zu : ", 
+              i, binaryHeapParent(binaryHeap, i));
+      if (binaryHeapHasChild(binaryHeap, i))
         {
-          fprintf(stdout,"children %zu ", binaryHeapLeft(i));
-        }
-      if (binaryHeapRight(i) < binaryHeap->size)
-        {
-          fprintf(stdout," , %zu", binaryHeapRight(i));
+          size_t c = binaryHeapChild(binaryHeap, i);
+          size_t end = binaryHeapChildEnd(binaryHeap, i);
+
+          fprintf(stdout,"children %zu ", c);
+          for (c=c+1; c<end; c++)
+            {
+              fprintf(stdout," , %zu", c);
+            }
         }
       fprintf(stdout," : ");
 
@@ -532,29 +1236,16 @@ binaryHeapCheck(binaryHeap_t * const binaryHeap)
       return false;
     }
 
-  for (size_t i=0; binaryHeapRight(i) < binaryHeap->size; i++)
+  for (size_t i=1; i<binaryHeap->size; i++)
     {
-      if ( binaryHeapLeft(i) < binaryHeap->size)
-        {
-          if (binaryHeapCompareGreater(binaryHeap, i, binaryHeapLeft(i)))
-            {
-              binaryHeap->debug
-                (__func__, __LINE__, binaryHeap->user, 
-                 "Compare failed at parent %zd, left child %zd\n",
-                 i, binaryHeapLeft(i));
-              return false;
-            }
-        }
-      if (binaryHeapRight(i) < binaryHeap->size)
+      size_t p = binaryHeapParent(binaryHeap, i);
+
+      if (binaryHeapCompareGreater(binaryHeap, p, i))
         {
-          if (binaryHeapCompareGreater(binaryHeap, i, binaryHeapRight(i)))
-            {
-              binaryHeap->debug
-                (__func__, __LINE__, binaryHeap->user, 
-                 "Compare failed at parent %zd, right child %zd\n",
-                 i, binaryHeapRight(i));
-              return false;
-            }
+          binaryHeap->debug
+            (__func__, __LINE__, binaryHeap->user, 
+             "Compare failed at parent %zd, child %zd\n", p, i);
+          return false;
         }
     }
 
@@ -26,6 +26,12 @@ extern "C" {
  */
 typedef struct binaryHeap_t binaryHeap_t;
 
+/**
+ * \e binaryHeapHandle_t structure. An opaque type for the handle of an
+ * entry in a binary heap.
+ */
+typedef struct binaryHeapHandle_t binaryHeapHandle_t;
+
 /**
  * \e binaryHeap_t memory allocator.
  *
@@ -45,7 +51,8 @@ typedef void *(*binaryHeapAllocFunc_t)(const size_t amount, void * const user);
  * \param pointer to memory to be deallocated
  * \param user \e void pointer to user data to be echoed by callbacks
  */
-typedef void (*binaryHeapDeallocFunc_t)(void * const pointer, void * const user);
+typedef void (*binaryHeapDeallocFunc_t)(void * const pointer,
+                                        void * const user);
 
 /**
  * \e binaryHeap_t entry data memory duplicator callback function.
@@ -136,21 +143,212 @@ binaryHeap_t *binaryHeapCreate
  const binaryHeapCompFunc_t comp,
  void * const user);
 
+/**
+ * Create an empty d-ary heap.
+ * 
+ * Creates and initialises an empty \e binaryHeap_t instance in which each
+ * entry has up to \e arity children. The children of an entry are adjacent
+ * in the heap array so a larger arity gives a shallower heap in which
+ * \e binaryHeapPop() compares more entries at each level but touches
+ * fewer cache lines. An arity of 4 or 8 suits large heaps of pointers.
+ * \e binaryHeapCreate() creates a heap with an arity of 2.
+ *
+ * \param arity maximum number of children of each entry. At least 2.
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for caller's entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e binaryHeap_t. \e NULL indicates failure.
+ */
+binaryHeap_t *binaryHeapCreateDary
+(const size_t arity,
+ const binaryHeapAllocFunc_t alloc, 
+ const binaryHeapDeallocFunc_t dealloc, 
+ const binaryHeapDuplicateEntryFunc_t duplicateEntry, 
+ const binaryHeapDeleteEntryFunc_t deleteEntry, 
+ const binaryHeapDebugFunc_t debug,
+ const binaryHeapCompFunc_t comp,
+ void * const user);
+
+/**
+ * Create a binary heap from an array of entries.
+ * 
+ * Creates a \e binaryHeap_t instance and pushes the entries with
+ * \e binaryHeapPushBatch(), which builds the heap bottom-up in time
+ * proportional to \e n. For a d-ary heap call \e binaryHeapCreateDary()
+ * and then \e binaryHeapPushBatch().
+ *
+ * \param entries array of \e void pointers to caller's entry data
+ * \param n number of entries in \e entries
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for caller's entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e binaryHeap_t. \e NULL indicates failure.
+ */
+binaryHeap_t *binaryHeapCreateFrom
+(void * const * const entries,
+ const size_t n,
+ const binaryHeapAllocFunc_t alloc, 
+ const binaryHeapDeallocFunc_t dealloc, 
+ const binaryHeapDuplicateEntryFunc_t duplicateEntry, 
+ const binaryHeapDeleteEntryFunc_t deleteEntry, 
+ const binaryHeapDebugFunc_t debug,
+ const binaryHeapCompFunc_t comp,
+ void * const user);
+
 /**
  * Push an entry onto the binary heap.
  *
  * Allocates an entry and pushes it onto the binary heap. The address of the
- * entry data inserted is returned. 
+ * entry data inserted is returned. In top-K mode a full heap behaves as
+ * \e binaryHeapOffer() and does not grow.
  *
  * \param binaryHeap \e binaryHeap_t pointer 
  * \param entry \e void pointer to caller's entry data 
  * \return \e void_t pointer to the entry data installed or, if the 
  * entry already exists, the existing entry data pointer. \e NULL 
- * indicates failure.
+ * indicates failure or, in top-K mode, that the entry was not kept.
  */
 void *binaryHeapPush(binaryHeap_t * const binaryHeap, 
                      void * const entry);
 
+/**
+ * Push an array of entries onto the binary heap.
+ *
+ * Appends the entries to the binary heap array. If the batch is large
+ * compared with the heap, so that moving each new entry up the heap could
+ * cost more than rebuilding it, then the whole heap is rebuilt bottom-up
+ * with Floyd's method in time proportional to its size. Otherwise each new
+ * entry is moved up the heap as by \e binaryHeapPush(). The entries have
+ * no handles. If an entry can't be duplicated then none of the batch is
+ * pushed. In top-K mode the batch only fills the heap up to its capacity
+ * and the rest of the batch is offered in turn as by \e binaryHeapOffer().
+ * If an offered entry can't be duplicated then the entries before it
+ * remain in the heap.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param entries array of \e void pointers to caller's entry data
+ * \param n number of entries in \e entries
+ * \return \e bool indicating success
+ */
+bool binaryHeapPushBatch(binaryHeap_t * const binaryHeap, 
+                         void * const * const entries,
+                         const size_t n);
+
+/**
+ * Select the top-K mode of an empty binary heap.
+ *
+ * In top-K mode the binary heap holds at most \e k entries and keeps the
+ * \e k greatest entries pushed onto it. The root is the least of them.
+ * When the heap is full an entry greater than the root replaces the root
+ * in place and is moved down the heap. Otherwise the entry is rejected
+ * after a single comparison, without being duplicated. The space for
+ * \e k entries is allocated by \e binaryHeapSetTopK() so the heap array
+ * never grows. To keep the \e k least entries reverse the \e comp()
+ * callback.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param k maximum number of entries. 0 for an unbounded heap.
+ * \return \e bool indicating success
+ */
+bool binaryHeapSetTopK(binaryHeap_t * const binaryHeap, const size_t k);
+
+/**
+ * Offer an entry from a stream to the binary heap.
+ *
+ * Pushes the entry as by \e binaryHeapPush(). In top-K mode, if the heap is
+ * full, the entry replaces the root if it is greater than the root and is
+ * otherwise rejected.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param entry \e void pointer to caller's entry data 
+ * \return \e bool indicating that the entry is in the heap. \e false if
+ * the entry was rejected or on failure.
+ */
+bool binaryHeapOffer(binaryHeap_t * const binaryHeap, void * const entry);
+
+/**
+ * Push an entry onto the binary heap and return a handle for it.
+ *
+ * Pushes an entry onto the binary heap like \e binaryHeapPush(). The handle
+ * refers to the entry while the entry is in the heap. When the entry is
+ * popped, removed, replaced in top-K mode or cleared from the heap the
+ * handle is detached and the handle functions report it as invalid. The
+ * caller deallocates a handle with \e binaryHeapReleaseHandle(), so a
+ * stale handle is never confused with the handle of a newer entry.
+ * \e binaryHeapDestroy() deallocates the handles of the entries still in
+ * the heap.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param entry \e void pointer to caller's entry data 
+ * \return pointer to the \e binaryHeapHandle_t of the entry. \e NULL
+ * indicates failure.
+ */
+binaryHeapHandle_t *binaryHeapPushHandle(binaryHeap_t * const binaryHeap, 
+                                         void * const entry);
+
+/**
+ * Get the entry of a handle.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param handle \e binaryHeapHandle_t pointer 
+ * \return pointer to the entry data in the binary heap. \e NULL indicates
+ * an invalid handle.
+ */
+void *binaryHeapGetEntry(binaryHeap_t * const binaryHeap, 
+                         const binaryHeapHandle_t * const handle);
+
+/**
+ * Restore the position of an entry after its key has changed.
+ *
+ * The caller changes the key of the entry data of a handle in place and
+ * then calls \e binaryHeapUpdate() to move the entry up or down the heap.
+ * Takes time proportional to the depth of the heap.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param handle \e binaryHeapHandle_t pointer 
+ * \return \e bool indicating success
+ */
+bool binaryHeapUpdate(binaryHeap_t * const binaryHeap, 
+                      const binaryHeapHandle_t * const handle);
+
+/**
+ * Remove the entry of a handle from the binary heap.
+ *
+ * Removes an entry from anywhere in the binary heap and detaches its
+ * handle. If the \e deleteEntry() callback has been defined then that
+ * function will be called to deallocate the caller's entry memory and
+ * NULL will be returned. Takes time proportional to the depth of the heap.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param handle \e binaryHeapHandle_t pointer 
+ * \return pointer to removed entry data. NULL if the entry memory has been
+ * deallocated or if the handle is invalid.
+ */
+void *binaryHeapRemove(binaryHeap_t * const binaryHeap, 
+                       binaryHeapHandle_t * const handle);
+
+/**
+ * Release a handle.
+ *
+ * Deallocates a handle returned by \e binaryHeapPushHandle(). If the
+ * entry of the handle is still in the binary heap then the entry stays
+ * in the heap without a handle.
+ *
+ * \param binaryHeap \e binaryHeap_t pointer 
+ * \param handle \e binaryHeapHandle_t pointer 
+ * \return \e bool indicating success
+ */
+bool binaryHeapReleaseHandle(binaryHeap_t * const binaryHeap, 
+                             binaryHeapHandle_t * const handle);
+
 /**
  * Copy the root entry in the binary heap.
  *
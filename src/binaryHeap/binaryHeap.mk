@@ -1,5 +1,6 @@
 # Programs in this directory
-binaryHeap_PROGRAMS:=binaryHeap_interp
+binaryHeap_PROGRAMS:=binaryHeap_interp binaryHeapHandle_test \
+  binaryHeapBatch_test
 PROGRAMS+=$(binaryHeap_PROGRAMS)
 
 VPATH += src/binaryHeap
@@ -9,3 +10,11 @@ binaryHeap_interp_C_SOURCES := binaryHeap.c binaryHeap_wrapper.c
 binaryHeap_interp_STATIC_LIBRARIES := interp.a
 
 $(call add_extra_CFLAGS_macro,$(binaryHeap_interp_C_SOURCES),-Isrc/interp)
+
+binaryHeapHandle_test_C_SOURCES := binaryHeapHandle_test.c binaryHeap.c
+
+$(call add_extra_CFLAGS_macro,$(binaryHeapHandle_test_C_SOURCES),-Isrc/interp)
+
+binaryHeapBatch_test_C_SOURCES := binaryHeapBatch_test.c binaryHeap.c
+
+$(call add_extra_CFLAGS_macro,$(binaryHeapBatch_test_C_SOURCES),-Isrc/interp)
@@ -0,0 +1,215 @@
+/*
+ * binaryHeapBatch_test.c
+ *
+ * Build binary and d-ary heaps from batches of entries: empty batches,
+ * batches of one entry, batches that rebuild the whole heap, small
+ * batches that are moved up a large heap and a batch larger than the
+ * top-K capacity. After each build the heap is checked and popped.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "binaryHeap.h"
+
+#define ENTRIES 1000
+
+static long keys[ENTRIES];
+static void *entries[ENTRIES];
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  printf("%s: ", function);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+binaryHeap_t *
+Create(const size_t arity)
+{
+  binaryHeap_t *heap;
+
+  heap = binaryHeapCreateDary(arity, Alloc, Dealloc, NULL, NULL, Debug,
+                              Compare, NULL);
+  if (heap == NULL)
+    {
+      fprintf(stderr, "binaryHeapCreateDary() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  return heap;
+}
+
+static
+void
+Batch(binaryHeap_t * const heap, const size_t from, const size_t n)
+{
+  if (binaryHeapPushBatch(heap, &entries[from], n) == false)
+    {
+      printf("push batch of %zu failed\n", n);
+    }
+}
+
+/*
+ * Pop every entry and print the entries if there are few of them or
+ * otherwise whether they were popped in order
+ */
+static
+void
+Pop(const char *name, binaryHeap_t * const heap)
+{
+  size_t size = binaryHeapGetSize(heap);
+  size_t popped = 0;
+  bool ordered = true;
+  long previous = 0;
+  long *entry;
+
+  printf("%s: size %zu check %s pop", name, size,
+         binaryHeapCheck(heap) ? "true" : "false");
+  while ((entry = binaryHeapPop(heap)) != NULL)
+    {
+      if ((popped > 0) && (*entry < previous))
+        {
+          ordered = false;
+        }
+      if (size <= 10)
+        {
+          printf(" %ld", *entry);
+        }
+      previous = *entry;
+      popped++;
+    }
+  if (size > 10)
+    {
+      printf(" %zu %s", popped, ordered ? "in order" : "out of order");
+    }
+  printf("\n");
+}
+
+int main(void)
+{
+  static const size_t arities[] = { 2, 3, 4, 8 };
+  binaryHeap_t *heap;
+  size_t a;
+  size_t k;
+
+  /* Shuffled keys with duplicates */
+  for (k=0; k<ENTRIES; k++)
+    {
+      keys[k] = (long)((k*7919)%(ENTRIES/2));
+      entries[k] = &keys[k];
+    }
+
+  /* binaryHeapCreateFrom() */
+  heap = binaryHeapCreateFrom(NULL, 0, Alloc, Dealloc, NULL, NULL, Debug,
+                              Compare, NULL);
+  Pop("from none", heap);
+  binaryHeapDestroy(heap);
+  heap = binaryHeapCreateFrom(entries, 1, Alloc, Dealloc, NULL, NULL, Debug,
+                              Compare, NULL);
+  Pop("from one", heap);
+  binaryHeapDestroy(heap);
+  heap = binaryHeapCreateFrom(entries, 7, Alloc, Dealloc, NULL, NULL, Debug,
+                              Compare, NULL);
+  Pop("from seven", heap);
+  binaryHeapDestroy(heap);
+  heap = binaryHeapCreateFrom(entries, ENTRIES, Alloc, Dealloc, NULL, NULL,
+                              Debug, Compare, NULL);
+  Pop("from all", heap);
+  binaryHeapDestroy(heap);
+  heap = binaryHeapCreateFrom(NULL, 1, Alloc, Dealloc, NULL, NULL, Debug,
+                              Compare, NULL);
+  printf("from NULL: %s\n", (heap == NULL) ? "failed" : "succeeded");
+  binaryHeapDestroy(heap);
+
+  /* binaryHeapPushBatch() */
+  for (a=0; a<(sizeof(arities)/sizeof(arities[0])); a++)
+    {
+      printf("arity %zu\n", arities[a]);
+      heap = Create(arities[a]);
+
+      /* Into an empty heap */
+      Batch(heap, 0, 0);
+      Pop("none", heap);
+      Batch(heap, 5, 1);
+      Pop("one", heap);
+      Batch(heap, 0, 9);
+      Pop("nine", heap);
+      Batch(heap, 0, ENTRIES);
+      Pop("all", heap);
+
+      /* Into a heap with entries */
+      Batch(heap, 0, ENTRIES-3);
+      Batch(heap, 0, 0);
+      Batch(heap, ENTRIES-3, 3);
+      Pop("few into many", heap);
+      Batch(heap, 0, 3);
+      Batch(heap, 3, ENTRIES-3);
+      Pop("many into few", heap);
+      Batch(heap, 0, 4);
+      Batch(heap, 4, 1);
+      Batch(heap, 5, 4);
+      Pop("one into few", heap);
+
+      binaryHeapDestroy(heap);
+    }
+
+  /* A batch larger than the top-K capacity keeps the greatest entries */
+  heap = Create(2);
+  if (binaryHeapSetTopK(heap, 5) == false)
+    {
+      fprintf(stderr, "binaryHeapSetTopK() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  Batch(heap, 0, 3);
+  Batch(heap, 3, ENTRIES-3);
+  Pop("top 5", heap);
+  binaryHeapDestroy(heap);
+
+  return EXIT_SUCCESS;
+}
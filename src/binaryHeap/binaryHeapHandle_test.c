@@ -0,0 +1,236 @@
+/*
+ * binaryHeapHandle_test.c
+ *
+ * Update and remove binary heap entries through their handles, use
+ * handles after their entries have left the heap and push new entries
+ * while stale handles are held and after they are released.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "binaryHeap.h"
+
+#define ENTRIES 8
+
+static long keys[ENTRIES];
+static binaryHeapHandle_t *handles[ENTRIES];
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  printf("%s: ", function);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+binaryHeap_t *
+Create(void)
+{
+  binaryHeap_t *heap;
+
+  heap = binaryHeapCreate(Alloc, Dealloc, NULL, NULL, Debug, Compare, NULL);
+  if (heap == NULL)
+    {
+      fprintf(stderr, "binaryHeapCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  return heap;
+}
+
+static
+void
+Push(binaryHeap_t * const heap, const size_t h, const long key)
+{
+  keys[h] = key;
+  handles[h] = binaryHeapPushHandle(heap, &keys[h]);
+  if (handles[h] == NULL)
+    {
+      printf("push %zu:%ld: rejected\n", h, key);
+    }
+}
+
+static
+void
+Entry(binaryHeap_t * const heap, const size_t h)
+{
+  long *entry = binaryHeapGetEntry(heap, handles[h]);
+
+  if (entry == NULL)
+    {
+      printf("handle %zu: NULL\n", h);
+    }
+  else
+    {
+      printf("handle %zu: %ld\n", h, *entry);
+    }
+}
+
+static
+void
+Pop(binaryHeap_t * const heap)
+{
+  long *entry;
+
+  printf("check %s pop", binaryHeapCheck(heap) ? "true" : "false");
+  while ((entry = binaryHeapPop(heap)) != NULL)
+    {
+      printf(" %ld", *entry);
+    }
+  printf("\n");
+}
+
+static
+void
+Release(binaryHeap_t * const heap, const size_t lo, const size_t hi)
+{
+  size_t h;
+
+  for (h=lo; h<=hi; h++)
+    {
+      if ((handles[h] != NULL) &&
+          (binaryHeapReleaseHandle(heap, handles[h]) == false))
+        {
+          printf("release %zu failed\n", h);
+        }
+      handles[h] = NULL;
+    }
+}
+
+int main(void)
+{
+  binaryHeap_t *heap;
+  long other = 45;
+  size_t h;
+
+  heap = Create();
+  for (h=0; h<5; h++)
+    {
+      Push(heap, h, (long)(((h*3)%5)+1)*10);
+    }
+  (void)binaryHeapPush(heap, &other);
+  for (h=0; h<5; h++)
+    {
+      Entry(heap, h);
+    }
+
+  /* Move entries up and down the heap */
+  keys[4] = 5;
+  printf("update 4: %s\n",
+         binaryHeapUpdate(heap, handles[4]) ? "ok" : "failed");
+  printf("peek: %ld\n", *(long *)binaryHeapPeek(heap));
+  keys[4] = 60;
+  printf("update 4: %s\n",
+         binaryHeapUpdate(heap, handles[4]) ? "ok" : "failed");
+  printf("peek: %ld\n", *(long *)binaryHeapPeek(heap));
+
+  /* Remove the root, an inner entry and the last entry through handles */
+  printf("remove 0: %ld\n", *(long *)binaryHeapRemove(heap, handles[0]));
+  printf("remove 2: %ld\n", *(long *)binaryHeapRemove(heap, handles[2]));
+  printf("remove 4: %ld\n", *(long *)binaryHeapRemove(heap, handles[4]));
+  printf("size: %zu check %s\n", binaryHeapGetSize(heap),
+         binaryHeapCheck(heap) ? "true" : "false");
+
+  /* Stale handles of removed and popped entries */
+  printf("pop: %ld\n", *(long *)binaryHeapPop(heap));
+  Entry(heap, 0);
+  Entry(heap, 3);
+  printf("update 2: %s\n",
+         binaryHeapUpdate(heap, handles[2]) ? "ok" : "failed");
+  printf("remove 4: %s\n",
+         (binaryHeapRemove(heap, handles[4]) == NULL) ? "NULL" : "entry");
+  Entry(heap, 1);
+
+  /* New entries while the stale handles are held */
+  Push(heap, 5, 15);
+  Push(heap, 6, 25);
+  Entry(heap, 0);
+  Entry(heap, 5);
+  Entry(heap, 6);
+
+  /* Reuse the memory of released handles */
+  Release(heap, 0, 4);
+  Push(heap, 0, 35);
+  Push(heap, 2, 55);
+  Push(heap, 4, 65);
+  Entry(heap, 0);
+  Entry(heap, 2);
+  Entry(heap, 4);
+
+  /* Release handles of entries that stay in the heap */
+  Release(heap, 5, 6);
+  printf("size: %zu\n", binaryHeapGetSize(heap));
+  Pop(heap);
+  Entry(heap, 0);
+  Entry(heap, 2);
+  Release(heap, 0, 4);
+
+  /* Handles cleared from the heap and replaced in top-K mode */
+  Push(heap, 0, 10);
+  Push(heap, 1, 20);
+  binaryHeapClear(heap);
+  Entry(heap, 0);
+  Entry(heap, 1);
+  Release(heap, 0, 1);
+  printf("topk: %s\n", binaryHeapSetTopK(heap, 3) ? "ok" : "failed");
+  Push(heap, 0, 10);
+  Push(heap, 1, 20);
+  Push(heap, 2, 30);
+  Push(heap, 3, 40);
+  Push(heap, 4, 5);
+  for (h=0; h<4; h++)
+    {
+      Entry(heap, h);
+    }
+  Release(heap, 0, 0);
+
+  /* The handles of entries left in the heap are deallocated with it */
+  binaryHeapDestroy(heap);
+
+  return EXIT_SUCCESS;
+}
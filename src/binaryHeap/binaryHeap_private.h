@@ -22,10 +22,24 @@ extern "C" {
 #include "compare.h"
 #include "binaryHeap.h"
 
+/**
+ * \e binaryHeapHandle_t structure.
+ *
+ * The handle of an entry pushed by \e binaryHeapPushHandle(). The handle
+ * follows the entry as it moves in the heap array.
+ */
+struct binaryHeapHandle_t
+{
+  size_t index;
+  /**< Index of the entry in the heap array. \c SIZE_MAX once the entry
+     has left the heap. */
+};
+
 /**
  * \e binaryHeap_t structure.
  *
- *  A binary heap type.
+ *  A binary heap type. A heap with \e arity greater than two is a d-ary
+ *  heap.
  */
 struct binaryHeap_t
 {
@@ -47,15 +61,28 @@ struct binaryHeap_t
   binaryHeapCompFunc_t compare;
   /**< Callback function to compare two entries in the binary heap.  */
 
+  size_t arity;
+  /**< Maximum number of children of each entry. The children of the
+     entry at index \e i are at indices \e arity*i+1 to \e arity*i+arity. */
+
   void **heap;
   /**< Array of pointers to the heap entries */
 
+  binaryHeapHandle_t **handles;
+  /**< Array of pointers to the handles of the heap entries, in the same
+     order as \e heap. An entry pushed without a handle has a \c NULL
+     handle. \c NULL until the first entry with a handle is pushed. */
+
   size_t size;
   /**< Number of entries in the binary heap. */
 
   size_t space;
   /**< Number of possible entries in the binary heap. */
 
+  size_t topK;
+  /**< Maximum number of entries in top-K mode. A full heap replaces its
+     root with a greater entry. 0 if the number of entries is unbounded. */
+
   void *user;
   /**< Placeholder for user data in callbacks. */
 };
@@ -24,6 +24,19 @@ interpCreate(void)
                           NULL);
 }
 
+void *
+interpCreateWithSize(const size_t size)
+{
+  return binaryHeapCreateDary(size,
+                              interpAlloc, 
+                              interpDealloc,
+                              interpDuplicateEntry,
+                              interpDeleteEntry,
+                              interpDebug, 
+                              interpComp, 
+                              NULL);
+}
+
 void *
 interpFind(void * const binaryHeap, void * const entry)
 {
@@ -198,3 +211,105 @@ interpCopy(void * const dst, void * const src)
   interpError(__func__, __LINE__, "Not implemented!");
   return NULL;
 }
+
+bool
+interpBuild(void * const tree, const size_t n)
+{
+  (void)tree;
+  (void)n;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpWalkRange(void * const tree,
+                const void * const lo,
+                const void * const hi,
+                const interpWalkFunc_t walk)
+{
+  (void)tree;
+  (void)lo;
+  (void)hi;
+  (void)walk;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+size_t
+interpRemoveRange(void * const tree,
+                  const void * const lo,
+                  const void * const hi)
+{
+  (void)tree;
+  (void)lo;
+  (void)hi;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return 0;
+}
+
+bool
+interpSetPolicy(void * const tree, const size_t policy)
+{
+  (void)tree;
+  (void)policy;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpShowStats(void * const tree)
+{
+  (void)tree;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetBudget(void * const tree, const size_t budget)
+{
+  (void)tree;
+  (void)budget;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+size_t
+interpGetCost(void * const tree)
+{
+  (void)tree;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return 0;
+}
+
+bool
+interpSetTTL(void * const tree, const size_t ttl)
+{
+  (void)tree;
+  (void)ttl;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpMeld(void * const dst, void * const src)
+{
+  (void)dst;
+  (void)src;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetTopK(void * const binaryHeap, const size_t k)
+{
+  return binaryHeapSetTopK(binaryHeap, k);
+}
+
+bool
+interpSetFinger(void * const tree, const bool finger)
+{
+  (void)tree;
+  (void)finger;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
@@ -12,9 +12,55 @@
 #include <stdbool.h>
 
 #include "compare.h"
+#include "arena.h"
 #include "bsTree.h"
 #include "bsTree_private.h"
 
+/**
+ * Private helper function for balanced search tree implementation.
+ *
+ * Allocate a node from the arena, if it exists, or with \e alloc().
+ *
+ * \param tree pointer to bsTree_t
+ * \return pointer to the new bsTreeNode_t. \e NULL indicates failure.
+ */
+static
+bsTreeNode_t *
+bsTreeAllocNode(bsTree_t * const tree)
+{
+  if (tree->arena != NULL)
+    {
+      return (bsTreeNode_t *)arenaAlloc(tree->arena);
+    }
+  else
+    {
+      return (bsTreeNode_t *)
+        (tree->alloc)(sizeof(bsTreeNode_t), tree->user);
+    }
+}
+
+/**
+ * Private helper function for balanced search tree implementation.
+ *
+ * Return a node to the arena, if it exists, or to \e dealloc().
+ *
+ * \param tree pointer to bsTree_t
+ * \param node pointer to bsTreeNode_t
+ */
+static
+void
+bsTreeDeallocNode(bsTree_t * const tree, bsTreeNode_t * const node)
+{
+  if (tree->arena != NULL)
+    {
+      arenaFree(tree->arena, node);
+    }
+  else
+    {
+      (tree->dealloc)(node, tree->user);
+    }
+}
+
 /**
  * Private helper function for balanced search tree implementation.
  *
@@ -137,7 +183,7 @@ bsTreeRecurseInsertNode(bsTree_t * const tree,
   
   if ((*node) == tree->bottom)
     {
-      (*node) = (bsTreeNode_t *)(tree->alloc(sizeof(bsTreeNode_t), tree->user));
+      (*node) = bsTreeAllocNode(tree);
       if ((*node) == NULL)
         {
           tree->debug(__func__, __LINE__, tree->user, 
@@ -150,7 +196,7 @@ bsTreeRecurseInsertNode(bsTree_t * const tree,
       (*node)->entry = bsTreeDuplicateEntry(tree, entry);
       if ((*node)->entry == NULL)
         {
-          (tree->dealloc)(*node, tree->user);
+          bsTreeDeallocNode(tree, *node);
           (tree->debug)(__func__, __LINE__, tree->user,
                         "redblackTreeDuplicateEntry() failed!");
           return NULL;
@@ -286,7 +332,7 @@ bsTreeRecurseRemoveNode(bsTree_t * const tree,
             {
               (tree->deleteEntry)(ptr, tree->user);
             }
-          tree->dealloc(tree->last, tree->user);
+          bsTreeDeallocNode(tree, tree->last);
           tree->last = NULL;
 
           tree->size = tree->size - 1;
@@ -544,10 +590,7 @@ bsTreeRecurseClear(bsTree_t * const tree, bsTreeNode_t * const node)
     }
 
   /* Deallocate node */
-  if (tree->dealloc != NULL)
-    {
-      (tree->dealloc)(node, tree->user);
-    }
+  bsTreeDeallocNode(tree, node);
   tree->size = tree->size - 1;
 
   return;
@@ -661,6 +704,7 @@ bsTree_t *bsTreeCreate
   tree->debug = debug; 
   tree->root = tree->bottom; 
   tree->size = 0;
+  tree->arena = NULL;
   tree->user = user;
 
   tree->bottom->level = 0;
@@ -673,6 +717,37 @@ bsTree_t *bsTreeCreate
   return tree;
 }
 
+bsTree_t *bsTreeCreateWithArena
+(const size_t chunkNodes,
+ const bsTreeAllocFunc_t alloc,
+ const bsTreeDeallocFunc_t dealloc,
+ const bsTreeDuplicateEntryFunc_t duplicateEntry,
+ const bsTreeDeleteEntryFunc_t deleteEntry,
+ const bsTreeDebugFunc_t debug,
+ const bsTreeCompFunc_t comp,
+ void * const user)
+{
+  bsTree_t *tree; 
+
+  tree = bsTreeCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                      debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  tree->arena = arenaCreate(sizeof(bsTreeNode_t), chunkNodes,
+                            alloc, dealloc, debug, user);
+  if (tree->arena == NULL)
+    {
+      debug(__func__, __LINE__, user, "Can't create arena!");
+      bsTreeDestroy(tree);
+      return NULL;
+    }
+
+  return tree;
+}
+
 void *bsTreeFind(bsTree_t * const tree, void * const entry)
 {
   bsTreeNode_t *node;
@@ -752,6 +827,7 @@ void bsTreeDestroy(bsTree_t * const tree)
 
   /* Free all the nodes in the tree */
   bsTreeClear(tree);
+  arenaDestroy(tree->arena);
   
   /* Free sentinel */
   tree->dealloc(tree->bottom, tree->user);
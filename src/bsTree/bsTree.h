@@ -142,6 +142,34 @@ extern "C" {
    const bsTreeCompFunc_t comp,
    void * const user);
 
+  /**
+   * Create an empty balanced search tree with an arena for the tree nodes.
+   * 
+   * Creates and initialises an empty \e bsTree_t instance. The tree
+   * nodes are allocated in chunks of \e chunkNodes nodes and nodes that
+   * are removed are recycled by later insertions. The chunks are
+   * deallocated when the tree is destroyed.
+   *
+   * \param chunkNodes number of tree nodes allocated in each chunk
+   * \param alloc memory allocator callback
+   * \param dealloc memory deallocator callback
+   * \param duplicateEntry entry duplication callback for caller's entry data
+   * \param deleteEntry memory deallocator callback for callers entry data
+   * \param debug message function callback
+   * \param comp entry key comparison function callback
+   * \param user \e void pointer to user data to be echoed by callbacks
+   * \return pointer to a \e bsTree_t. \e NULL indicates failure
+   */
+  bsTree_t *bsTreeCreateWithArena
+  (const size_t chunkNodes,
+   const bsTreeAllocFunc_t alloc, 
+   const bsTreeDeallocFunc_t dealloc,
+   const bsTreeDuplicateEntryFunc_t duplicateEntry,
+   const bsTreeDeleteEntryFunc_t deleteEntry,
+   const bsTreeDebugFunc_t debug,
+   const bsTreeCompFunc_t comp,
+   void * const user);
+
   /**
    * Find an entry in the balanced search tree.
    *
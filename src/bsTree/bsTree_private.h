@@ -20,6 +20,7 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "arena.h"
 #include "bsTree.h"
 
 /**
@@ -80,6 +81,9 @@ struct bsTree_t
   size_t size;
   /**< Number of entries in the bsTree. */
 
+  arena_t *arena;
+  /**< Arena for bsTreeNode_t. \e NULL if nodes use \e alloc(). */
+
   void *user;
   /**< Placeholder for user data in callbacks. */
 };
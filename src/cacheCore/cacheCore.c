@@ -0,0 +1,1875 @@
+/**
+ * \file cacheCore.c
+ *
+ * A \c cacheCore_t implementation. The replacement policies, the hash
+ * index, the timer wheel, the budget and the operation counts shared by
+ * \c redblackCache_t and \c splayCache_t.
+ */
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "cacheCore.h"
+#include "cacheCore_private.h"
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Move the cache entry (should be the last in the list) to the head
+ * of the linked list.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to \c cacheCoreEntry_t to be moved
+ * \return pointer to \c cacheCore_t. \c NULL indicates failure
+ */
+static
+cacheCore_t *
+cacheCoreMoveToHead(cacheCore_t * const core, cacheCoreEntry_t *cacheEntry)
+{
+  if ((cacheEntry->next == NULL) || (cacheEntry->prev == NULL))
+    {
+      return NULL;
+    }
+
+  /* Unlink cacheEntry */
+  (cacheEntry->prev)->next = cacheEntry->next;
+  (cacheEntry->next)->prev = cacheEntry->prev;
+
+  /* Update cacheEntry */
+  cacheEntry->next = (core->head).next;
+  cacheEntry->prev = &(core->head);
+
+  /* Link cacheEntry */
+  (cacheEntry->next)->prev = (core->head).next = cacheEntry;
+
+  return core;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the dummy first entry of a queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param queue \c cacheCoreQueue_e value
+ * \return pointer to the dummy first \c cacheCoreEntry_t
+ */
+static
+cacheCoreEntry_t *
+cacheCoreQueueHead(cacheCore_t * const core, const cacheCoreQueue_e queue)
+{
+  if (queue == cacheCoreQueueRecent)
+    {
+      return &(core->head);
+    }
+
+  return &(core->queueHead[queue-1]);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the least recently queued entry of a queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param queue \c cacheCoreQueue_e value
+ * \return pointer to \c cacheCoreEntry_t. \c NULL if the queue is empty.
+ */
+static
+cacheCoreEntry_t *
+cacheCoreQueueLast(cacheCore_t * const core, const cacheCoreQueue_e queue)
+{
+  cacheCoreEntry_t *tail;
+
+  if (queue == cacheCoreQueueRecent)
+    {
+      tail = &(core->tail);
+    }
+  else
+    {
+      tail = &(core->queueTail[queue-1]);
+    }
+  if (tail->prev == cacheCoreQueueHead(core, queue))
+    {
+      return NULL;
+    }
+
+  return tail->prev;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the number of entries in a queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param queue \c cacheCoreQueue_e value
+ * \return number of entries in the queue
+ */
+static
+size_t
+cacheCoreQueueLength(const cacheCore_t * const core,
+                     const cacheCoreQueue_e queue)
+{
+  if (queue == cacheCoreQueueRecent)
+    {
+      return core->size - core->queueSize[cacheCoreQueueFrequent-1];
+    }
+
+  return core->queueSize[queue-1];
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Insert a cache entry at the head of a queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to \c cacheCoreEntry_t
+ * \param queue \c cacheCoreQueue_e value
+ */
+static
+void
+cacheCoreQueuePush(cacheCore_t * const core,
+                   cacheCoreEntry_t * const cacheEntry,
+                   const cacheCoreQueue_e queue)
+{
+  cacheCoreEntry_t *head = cacheCoreQueueHead(core, queue);
+
+  cacheEntry->next = head->next;
+  cacheEntry->prev = head;
+  (cacheEntry->next)->prev = head->next = cacheEntry;
+  cacheEntry->queue = queue;
+
+  if (queue != cacheCoreQueueRecent)
+    {
+      core->queueSize[queue-1] = core->queueSize[queue-1]+1;
+    }
+  if (queue <= cacheCoreQueueFrequent)
+    {
+      core->size = core->size+1;
+      core->totalCost = core->totalCost+cacheEntry->cost;
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Remove a cache entry from its queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to \c cacheCoreEntry_t
+ */
+static
+void
+cacheCoreQueueRemove(cacheCore_t * const core,
+                     cacheCoreEntry_t * const cacheEntry)
+{
+  if (core->hand == cacheEntry)
+    {
+      core->hand = cacheEntry->prev;
+    }
+  (cacheEntry->prev)->next = cacheEntry->next;
+  (cacheEntry->next)->prev = cacheEntry->prev;
+
+  if (cacheEntry->queue != cacheCoreQueueRecent)
+    {
+      core->queueSize[cacheEntry->queue-1] =
+        core->queueSize[cacheEntry->queue-1]-1;
+    }
+  if (cacheEntry->queue <= cacheCoreQueueFrequent)
+    {
+      core->size = core->size-1;
+      core->totalCost = core->totalCost-cacheEntry->cost;
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Empty the list and the queues.
+ *
+ * \param core pointer to \c cacheCore_t
+ */
+static
+void
+cacheCoreInitQueues(cacheCore_t * const core)
+{
+  size_t q;
+
+  core->head.prev = NULL;
+  core->head.next = &(core->tail);
+  core->head.entry = NULL;
+  core->tail.prev = &(core->head);
+  core->tail.next = NULL;
+  core->tail.entry = NULL;
+  for (q=0; q<(cacheCoreQueues-1); q++)
+    {
+      core->queueHead[q].prev = NULL;
+      core->queueHead[q].next = &(core->queueTail[q]);
+      core->queueHead[q].entry = NULL;
+      core->queueTail[q].prev = &(core->queueHead[q]);
+      core->queueTail[q].next = NULL;
+      core->queueTail[q].entry = NULL;
+      core->queueSize[q] = 0;
+    }
+  core->size = 0;
+  core->totalCost = 0;
+  core->hand = NULL;
+  core->target = 0;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Record a hit on a cache entry. With the LRU policy the entry is moved
+ * to the head of the list. With the CLOCK policy only the reference bit
+ * is set. With the 2Q policy a hit in the FIFO queue is ignored. With
+ * the 2Q and ARC policies any other hit moves the entry to the head of
+ * the frequent queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to \c cacheCoreEntry_t that was hit
+ * \return pointer to \c cacheCore_t. \c NULL indicates failure
+ */
+static
+cacheCore_t *
+cacheCoreTouch(cacheCore_t * const core, cacheCoreEntry_t * const cacheEntry)
+{
+  if (core->policy == cacheCorePolicyClock)
+    {
+      cacheEntry->referenced = true;
+      return core;
+    }
+  if ((core->policy == cacheCorePolicyTwoQ) &&
+      (cacheEntry->queue == cacheCoreQueueRecent))
+    {
+      return core;
+    }
+  if ((core->policy == cacheCorePolicyTwoQ) ||
+      (core->policy == cacheCorePolicyARC))
+    {
+      cacheCoreQueueRemove(core, cacheEntry);
+      cacheCoreQueuePush(core, cacheEntry, cacheCoreQueueFrequent);
+      return core;
+    }
+
+  return cacheCoreMoveToHead(core, cacheEntry);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Choose the cache entry to be replaced in a full cache. With the LRU
+ * policy this is the last entry in the list. With the CLOCK policy the
+ * hand sweeps towards the head of the list, giving each referenced
+ * entry a second chance by clearing its reference bit, until it finds
+ * an unreferenced entry. The hand then moves past the chosen entry.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \return pointer to \c cacheCoreEntry_t to be replaced
+ */
+static
+cacheCoreEntry_t *
+cacheCoreVictim(cacheCore_t * const core)
+{
+  cacheCoreEntry_t *cacheEntry;
+
+  if (core->policy != cacheCorePolicyClock)
+    {
+      return (core->tail).prev;
+    }
+
+  cacheEntry = core->hand;
+  while (true)
+    {
+      if ((cacheEntry == NULL) || (cacheEntry == &(core->head)))
+        {
+          cacheEntry = (core->tail).prev;
+        }
+      if (cacheEntry->referenced == false)
+        {
+          break;
+        }
+      cacheEntry->referenced = false;
+      cacheEntry = cacheEntry->prev;
+    }
+  core->hand = cacheEntry->prev;
+
+  return cacheEntry;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Duplicate an entry.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \return pointer to duplicated entry. \c NULL indicates failure.
+ */
+static
+void *
+cacheCoreDuplicateEntry(cacheCore_t * const core, void * const entry)
+{
+  void *newEntry;
+
+  if (core->duplicateEntry == NULL)
+    {
+      return entry;
+    }
+
+  newEntry = (core->duplicateEntry)(entry, core->user);
+  if (newEntry == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Couldn't duplicate entry!");
+    }
+
+  return newEntry;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Call the \e deleteEntry() callback, if any, on the caller's data of a
+ * cache entry. Does nothing for a ghost entry in a hash index, which has
+ * no caller's data.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to \c cacheCoreEntry_t
+ */
+static
+void
+cacheCoreDeleteEntry(cacheCore_t * const core,
+                     cacheCoreEntry_t * const cacheEntry)
+{
+  if ((core->deleteEntry != NULL) && (cacheEntry->entry != NULL))
+    {
+      (core->deleteEntry)(cacheEntry->entry, core->user);
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Allocate an empty power-of-two hash index that is at most half full
+ * when it holds \e entries entries. Replaces any existing hash index.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entries maximum number of entries in the hash index
+ * \return \c bool indicating success
+ */
+static
+bool
+cacheCoreIndexCreate(cacheCore_t * const core, const size_t entries)
+{
+  cacheCoreEntry_t **index;
+  size_t slots, slot;
+
+  for (slots=2; slots<(2*entries); slots=2*slots);
+  index = (core->alloc)(slots*sizeof(cacheCoreEntry_t *), core->user);
+  if (index == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Can't allocate %zu for cacheCore_t hash index",
+                  slots*sizeof(cacheCoreEntry_t *));
+      return false;
+    }
+  for (slot=0; slot<slots; slot++)
+    {
+      index[slot] = NULL;
+    }
+
+  if (core->index != NULL)
+    {
+      (core->dealloc)(core->index, core->user);
+    }
+  core->index = index;
+  core->indexMask = slots-1;
+
+  return true;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the hash index slot holding an entry. A ghost entry only keeps the
+ * hash of its key so it matches any entry with the same hash, but only if
+ * the entry is not resident. If the entry is not in the cache then find
+ * the empty slot that ends its probe sequence. The index always has an
+ * empty slot since it has at least twice \c space slots.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \param hash hash of the caller's data
+ * \return hash index slot
+ */
+static
+size_t
+cacheCoreIndexSlot(const cacheCore_t * const core,
+                   const void * const entry,
+                   const size_t hash)
+{
+  size_t slot, ghostSlot = SIZE_MAX;
+
+  for (slot = hash & core->indexMask;
+       core->index[slot] != NULL;
+       slot = (slot+1) & core->indexMask)
+    {
+      const cacheCoreEntry_t *cacheEntry = core->index[slot];
+
+      if (cacheEntry->hash != hash)
+        {
+          continue;
+        }
+      if (cacheEntry->entry == NULL)
+        {
+          ghostSlot = (ghostSlot == SIZE_MAX) ? slot : ghostSlot;
+        }
+      else if ((core->compare)(entry, cacheEntry->entry, core->user)
+               == compareEqual)
+        {
+          return slot;
+        }
+    }
+
+  return (ghostSlot == SIZE_MAX) ? slot : ghostSlot;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the hash index slot holding a cache entry. If the cache entry is
+ * not in the index then find the empty slot that ends its probe sequence.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ * \return hash index slot
+ */
+static
+size_t
+cacheCoreIndexPlace(const cacheCore_t * const core,
+                    const cacheCoreEntry_t * const cacheEntry)
+{
+  size_t slot;
+
+  for (slot = cacheEntry->hash & core->indexMask;
+       (core->index[slot] != NULL) && (core->index[slot] != cacheEntry);
+       slot = (slot+1) & core->indexMask);
+
+  return slot;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Empty a hash index slot. Later entries in the probe sequence are
+ * shifted back into the hole so that no tombstones are needed.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param slot hash index slot to be emptied
+ */
+static
+void
+cacheCoreIndexRemove(cacheCore_t * const core, size_t slot)
+{
+  size_t next;
+
+  for (next = (slot+1) & core->indexMask;
+       core->index[next] != NULL;
+       next = (next+1) & core->indexMask)
+    {
+      size_t home = (core->index[next])->hash & core->indexMask;
+
+      /* Move the entry back unless the hole precedes its home slot */
+      if (((next-home) & core->indexMask) >= ((next-slot) & core->indexMask))
+        {
+          core->index[slot] = core->index[next];
+          slot = next;
+        }
+    }
+
+  core->index[slot] = NULL;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the cache entry for the caller's data in the hash index or, if
+ * the cache has no hash index, in the search tree of the owning cache.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \return pointer to the \c cacheCoreEntry_t. \c NULL if not found.
+ */
+static
+cacheCoreEntry_t *
+cacheCoreLookup(cacheCore_t * const core, void * const entry)
+{
+  if (core->index != NULL)
+    {
+      size_t slot;
+
+      slot = cacheCoreIndexSlot(core, entry, (core->hash)(entry, core->user));
+      return core->index[slot];
+    }
+
+  return (core->lookup)(entry, core->owner);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Add a cache entry to the hash index or, if the cache has no hash
+ * index, to the search tree of the owning cache.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ * \return \c bool indicating success
+ */
+static
+bool
+cacheCoreLink(cacheCore_t * const core, cacheCoreEntry_t * const cacheEntry)
+{
+  if (core->index != NULL)
+    {
+      size_t slot;
+
+      cacheEntry->hash = (core->hash)(cacheEntry->entry, core->user);
+      slot = cacheCoreIndexPlace(core, cacheEntry);
+      core->index[slot] = cacheEntry;
+      return true;
+    }
+
+  return (core->link)(cacheEntry, core->owner);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Remove a cache entry from the hash index or, if the cache has no hash
+ * index, from the search tree of the owning cache.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ */
+static
+void
+cacheCoreUnlink(cacheCore_t * const core, cacheCoreEntry_t * const cacheEntry)
+{
+  if (core->index != NULL)
+    {
+      size_t slot;
+
+      slot = cacheCoreIndexPlace(core, cacheEntry);
+      if (core->index[slot] == cacheEntry)
+        {
+          cacheCoreIndexRemove(core, slot);
+        }
+      return;
+    }
+
+  (core->unlink)(cacheEntry, core->owner);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Take a cache entry out of the timer wheel. Does nothing if the entry
+ * does not expire.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ */
+static
+void
+cacheCoreTimerRemove(cacheCore_t * const core,
+                     cacheCoreEntry_t * const cacheEntry)
+{
+  if (cacheEntry->timerPrev == NULL)
+    {
+      return;
+    }
+
+  *(cacheEntry->timerPrev) = cacheEntry->timerNext;
+  if (cacheEntry->timerNext != NULL)
+    {
+      cacheEntry->timerNext->timerPrev = cacheEntry->timerPrev;
+    }
+  cacheEntry->timerPrev = NULL;
+  core->timers = core->timers-1;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Place a cache entry in the timer wheel slot for its expiry time. An
+ * entry expiring within \c CACHE_CORE_WHEEL_SLOTS ticks of \e wheelTime
+ * goes in the first level, an entry expiring within the square of that
+ * in the second level and so on. The slot is chosen by the digits of the
+ * expiry time for that level so that the slot is cascaded to the lower
+ * levels, or expired, when the wheel reaches it. An entry expiring
+ * beyond the last level is placed in the last slot to be reached and
+ * placed again when that slot is cascaded.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ */
+static
+void
+cacheCoreTimerAdd(cacheCore_t * const core,
+                  cacheCoreEntry_t * const cacheEntry)
+{
+  const size_t span = (size_t)1 <<
+    (CACHE_CORE_WHEEL_BITS*CACHE_CORE_WHEEL_LEVELS);
+  size_t delta, when, level, slot;
+  cacheCoreEntry_t **head;
+
+  delta = (cacheEntry->expiry > core->wheelTime) ?
+    (cacheEntry->expiry-core->wheelTime) : 0;
+  when = (delta < span) ? cacheEntry->expiry : (core->wheelTime+span-1);
+  for (level=0; level<(CACHE_CORE_WHEEL_LEVELS-1); level++)
+    {
+      if (delta < ((size_t)1 << (CACHE_CORE_WHEEL_BITS*(level+1))))
+        {
+          break;
+        }
+    }
+  slot = (level*CACHE_CORE_WHEEL_SLOTS) +
+    ((when >> (CACHE_CORE_WHEEL_BITS*level)) & (CACHE_CORE_WHEEL_SLOTS-1));
+
+  head = &(core->wheel[slot]);
+  cacheEntry->timerNext = *head;
+  cacheEntry->timerPrev = head;
+  if (*head != NULL)
+    {
+      (*head)->timerPrev = &(cacheEntry->timerNext);
+    }
+  *head = cacheEntry;
+  core->timers = core->timers+1;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Set the expiry time of a cache entry \e ttl ticks after the current
+ * time of the timer wheel and place it in the wheel.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ * \param ttl time to live of the entry. \c 0 if the entry does not expire.
+ */
+static
+void
+cacheCoreSchedule(cacheCore_t * const core,
+                  cacheCoreEntry_t * const cacheEntry,
+                  const size_t ttl)
+{
+  cacheCoreTimerRemove(core, cacheEntry);
+  if (ttl == 0)
+    {
+      return;
+    }
+
+  cacheEntry->expiry = (ttl > (SIZE_MAX-core->wheelTime)) ?
+    SIZE_MAX : (core->wheelTime+ttl);
+  cacheCoreTimerAdd(core, cacheEntry);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Remove a cache entry from its queue, from the timer wheel and from the
+ * index and deallocate it and the caller's entry data.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ */
+static
+void
+cacheCoreDropEntry(cacheCore_t * const core,
+                   cacheCoreEntry_t * const cacheEntry)
+{
+  cacheCoreQueueRemove(core, cacheEntry);
+  cacheCoreTimerRemove(core, cacheEntry);
+  cacheCoreUnlink(core, cacheEntry);
+  cacheCoreDeleteEntry(core, cacheEntry);
+  (core->dealloc)(cacheEntry, core->user);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Delete the caller's data of an evicted entry, keeping only what its
+ * ghost entry needs to remember the key. With a hash index that is the
+ * hash already stored in the entry. With a search tree it is a key-only
+ * copy made by the \e keyEntry() callback. The copy has the same key so
+ * the entry keeps its place in the search tree.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ * \return \c bool indicating success
+ */
+static
+bool
+cacheCoreForget(cacheCore_t * const core, cacheCoreEntry_t * const cacheEntry)
+{
+  void *key = NULL;
+
+  if (core->index == NULL)
+    {
+      key = (core->keyEntry)(cacheEntry->entry, core->user);
+      if (key == NULL)
+        {
+          core->debug(__func__, __LINE__, core->user,
+                      "Couldn't copy the key of an entry!");
+          return false;
+        }
+    }
+
+  cacheCoreDeleteEntry(core, cacheEntry);
+  cacheEntry->entry = key;
+
+  return true;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Move the least recently queued entry of one queue to the head of
+ * another queue. A resident entry moved to a ghost queue is evicted but
+ * its key is remembered. If its key can't be remembered it is dropped
+ * instead. Ghost entries do not expire.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param from \c cacheCoreQueue_e value
+ * \param to \c cacheCoreQueue_e value
+ */
+static
+void
+cacheCoreQueueDemote(cacheCore_t * const core,
+                     const cacheCoreQueue_e from,
+                     const cacheCoreQueue_e to)
+{
+  cacheCoreEntry_t *cacheEntry = cacheCoreQueueLast(core, from);
+
+  if (cacheEntry == NULL)
+    {
+      return;
+    }
+  if ((from < cacheCoreQueueRecentGhost) &&
+      (to >= cacheCoreQueueRecentGhost) &&
+      (cacheCoreForget(core, cacheEntry) == false))
+    {
+      cacheCoreDropEntry(core, cacheEntry);
+      return;
+    }
+
+  cacheCoreQueueRemove(core, cacheEntry);
+  cacheCoreTimerRemove(core, cacheEntry);
+  cacheCoreQueuePush(core, cacheEntry, to);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Drop the least recently queued entry of a queue.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param queue \c cacheCoreQueue_e value
+ */
+static
+void
+cacheCoreQueueDrop(cacheCore_t * const core, const cacheCoreQueue_e queue)
+{
+  cacheCoreEntry_t *cacheEntry = cacheCoreQueueLast(core, queue);
+
+  if (cacheEntry != NULL)
+    {
+      cacheCoreDropEntry(core, cacheEntry);
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Advance the timer wheel by one tick. When the digits of the new time
+ * for the lower levels are all zero the slots of the higher levels
+ * reached by the wheel are cascaded, placing their entries again in the
+ * lower levels. Then the entries in the first level slot for the new
+ * time have expired and are dropped.
+ *
+ * \param core pointer to \c cacheCore_t
+ */
+static
+void
+cacheCoreTimerTick(cacheCore_t * const core)
+{
+  cacheCoreEntry_t *cacheEntry;
+  size_t level, slot;
+
+  core->wheelTime = core->wheelTime+1;
+  for (level=1; level<CACHE_CORE_WHEEL_LEVELS; level++)
+    {
+      if (((core->wheelTime >> (CACHE_CORE_WHEEL_BITS*(level-1))) &
+           (CACHE_CORE_WHEEL_SLOTS-1)) != 0)
+        {
+          break;
+        }
+
+      slot = (level*CACHE_CORE_WHEEL_SLOTS) +
+        ((core->wheelTime >> (CACHE_CORE_WHEEL_BITS*level)) &
+         (CACHE_CORE_WHEEL_SLOTS-1));
+      cacheEntry = core->wheel[slot];
+      core->wheel[slot] = NULL;
+      while (cacheEntry != NULL)
+        {
+          cacheCoreEntry_t *nextCacheEntry = cacheEntry->timerNext;
+
+          core->timers = core->timers-1;
+          cacheCoreTimerAdd(core, cacheEntry);
+          cacheEntry = nextCacheEntry;
+        }
+    }
+
+  slot = core->wheelTime & (CACHE_CORE_WHEEL_SLOTS-1);
+  while ((cacheEntry = core->wheel[slot]) != NULL)
+    {
+      cacheCoreDropEntry(core, cacheEntry);
+      CACHE_CORE_COUNT(core, expirations);
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Drop the entries that have expired by the current time. The timer
+ * wheel is advanced tick by tick to the current time unless there are
+ * fewer entries in the wheel than ticks to process. In that case the
+ * entries are taken out of the wheel and those that have not expired are
+ * placed again. Either way the work done is proportional to the smaller
+ * of the elapsed time and the number of expiring entries.
+ *
+ * \param core pointer to \c cacheCore_t
+ */
+static
+void
+cacheCoreExpire(cacheCore_t * const core)
+{
+  cacheCoreEntry_t *cacheEntry, *pending = NULL;
+  size_t now, slot;
+
+  if (core->wheel == NULL)
+    {
+      return;
+    }
+
+  now = (core->clock)(core->user);
+  if (now <= core->wheelTime)
+    {
+      return;
+    }
+  if (core->timers == 0)
+    {
+      core->wheelTime = now;
+      return;
+    }
+  if ((now-core->wheelTime) <= core->timers)
+    {
+      while ((core->wheelTime < now) && (core->timers > 0))
+        {
+          cacheCoreTimerTick(core);
+        }
+      core->wheelTime = now;
+      return;
+    }
+
+  for (slot=0;
+       slot<(CACHE_CORE_WHEEL_LEVELS*CACHE_CORE_WHEEL_SLOTS);
+       slot++)
+    {
+      while ((cacheEntry = core->wheel[slot]) != NULL)
+        {
+          cacheCoreTimerRemove(core, cacheEntry);
+          cacheEntry->timerNext = pending;
+          pending = cacheEntry;
+        }
+    }
+  core->wheelTime = now;
+  while (pending != NULL)
+    {
+      cacheEntry = pending;
+      pending = cacheEntry->timerNext;
+      if (cacheEntry->expiry <= now)
+        {
+          cacheCoreDropEntry(core, cacheEntry);
+          CACHE_CORE_COUNT(core, expirations);
+        }
+      else
+        {
+          cacheCoreTimerAdd(core, cacheEntry);
+        }
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Evict a resident entry from a full cache with the 2Q or ARC policy.
+ *
+ * With 2Q the FIFO queue is limited to a quarter of \e space and the
+ * ghost queue to half of \e space. An entry evicted from the FIFO
+ * queue becomes a ghost. An entry evicted from the frequent queue is
+ * forgotten.
+ *
+ * With ARC an entry is evicted from the main list if it is longer than
+ * the target length, or as long as the target length when the key being
+ * inserted is a ghost of the frequent queue. Otherwise an entry is
+ * evicted from the frequent queue. Either way it becomes a ghost.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param ghostFrequent the key being inserted is a frequent queue ghost
+ */
+static
+void
+cacheCoreReclaim(cacheCore_t * const core, const bool ghostFrequent)
+{
+  size_t recent = cacheCoreQueueLength(core, cacheCoreQueueRecent);
+  size_t frequent = cacheCoreQueueLength(core, cacheCoreQueueFrequent);
+
+  CACHE_CORE_COUNT(core, evictions);
+
+  if (core->policy == cacheCorePolicyTwoQ)
+    {
+      size_t in = (core->space > 4) ? (core->space/4) : 1;
+      size_t out = (core->space > 2) ? (core->space/2) : 1;
+
+      if ((recent > in) || (frequent == 0))
+        {
+          cacheCoreQueueDemote(core, cacheCoreQueueRecent,
+                               cacheCoreQueueRecentGhost);
+          if (cacheCoreQueueLength(core, cacheCoreQueueRecentGhost) > out)
+            {
+              cacheCoreQueueDrop(core, cacheCoreQueueRecentGhost);
+            }
+        }
+      else
+        {
+          cacheCoreQueueDrop(core, cacheCoreQueueFrequent);
+        }
+      return;
+    }
+
+  if ((recent > 0) &&
+      ((recent > core->target) ||
+       (ghostFrequent && (recent == core->target)) ||
+       (frequent == 0)))
+    {
+      cacheCoreQueueDemote(core, cacheCoreQueueRecent,
+                           cacheCoreQueueRecentGhost);
+    }
+  else
+    {
+      cacheCoreQueueDemote(core, cacheCoreQueueFrequent,
+                           cacheCoreQueueFrequentGhost);
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the cost of an entry. Without a \e cost() callback every entry
+ * costs one.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \return cost of the entry
+ */
+static
+size_t
+cacheCoreEntryCost(cacheCore_t * const core, const void * const entry)
+{
+  if (core->cost == NULL)
+    {
+      return 1;
+    }
+
+  return (core->cost)(entry, core->user);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Evict resident entries, chosen by the policy, until an entry of cost
+ * \e cost fits in the budget of the cache.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param cost cost of the entry to be inserted
+ */
+static
+void
+cacheCoreMakeRoom(cacheCore_t * const core, const size_t cost)
+{
+  while ((core->budget != 0) &&
+         (core->size > 0) &&
+         ((core->totalCost+cost) > core->budget))
+    {
+      if ((core->policy == cacheCorePolicyTwoQ) ||
+          (core->policy == cacheCorePolicyARC))
+        {
+          cacheCoreReclaim(core, false);
+        }
+      else
+        {
+          cacheCoreDropEntry(core, cacheCoreVictim(core));
+          CACHE_CORE_COUNT(core, evictions);
+        }
+    }
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Allocate a new cache entry for a copy of the caller's data, add it to
+ * the index and place it at the head of the main list.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \param cost cost of the caller's data
+ * \return pointer to the \c cacheCoreEntry_t. \c NULL indicates failure.
+ */
+static
+cacheCoreEntry_t *
+cacheCoreNewEntry(cacheCore_t * const core,
+                  void * const entry,
+                  const size_t cost)
+{
+  cacheCoreEntry_t *cacheEntry;
+
+  /* Allocate memory for cacheCoreEntry_t */
+  if ((cacheEntry = (core->alloc)(core->entrySize, core->user)) == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Memory allocation for cacheEntry failed!");
+      return NULL;
+    }
+
+  /* Install the new entry */
+  cacheEntry->entry = cacheCoreDuplicateEntry(core, entry);
+  if (cacheEntry->entry == NULL)
+    {
+      (core->dealloc)(cacheEntry, core->user);
+      return NULL;
+    }
+  if (cacheCoreLink(core, cacheEntry) == false)
+    {
+      cacheCoreDeleteEntry(core, cacheEntry);
+      (core->dealloc)(cacheEntry, core->user);
+      core->debug(__func__, __LINE__, core->user,
+                  "cacheCoreLink() failed");
+      return NULL;
+    }
+
+  /* Insert cacheEntry at head of list and count it */
+  cacheEntry->referenced = false;
+  cacheEntry->cost = cost;
+  cacheEntry->timerPrev = NULL;
+  cacheCoreQueuePush(core, cacheEntry, cacheCoreQueueRecent);
+
+  return cacheEntry;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Insert an entry that is not resident in a cache with the 2Q or ARC
+ * policy. If the key is remembered by a ghost entry then, for ARC, the
+ * target length of the main list is adapted and the ghost entry is
+ * revived in the frequent queue. Otherwise a new entry is placed at the
+ * head of the main list. For ARC the ghost queues are trimmed so that
+ * the main list and its ghosts hold at most \e space entries and all
+ * the queues together at most twice \e space entries.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \param ghost pointer to the ghost \c cacheCoreEntry_t for the
+ * caller's data. \c NULL if the key is not remembered.
+ * \param cost cost of the caller's data
+ * \return pointer to the \c cacheCoreEntry_t. \c NULL indicates failure.
+ */
+static
+cacheCoreEntry_t *
+cacheCoreInsertQueued(cacheCore_t * const core,
+                      void * const entry,
+                      cacheCoreEntry_t * const ghost,
+                      const size_t cost)
+{
+  bool ghostFrequent = false;
+
+  if ((ghost != NULL) && (core->policy == cacheCorePolicyARC))
+    {
+      size_t b1 = cacheCoreQueueLength(core, cacheCoreQueueRecentGhost);
+      size_t b2 = cacheCoreQueueLength(core, cacheCoreQueueFrequentGhost);
+
+      if (ghost->queue == cacheCoreQueueRecentGhost)
+        {
+          size_t delta = (b2 > b1) ? (b2/b1) : 1;
+
+          core->target = ((core->space-core->target) > delta) ?
+            (core->target+delta) : core->space;
+        }
+      else
+        {
+          size_t delta = (b1 > b2) ? (b1/b2) : 1;
+
+          core->target = (core->target > delta) ? (core->target-delta) : 0;
+          ghostFrequent = true;
+        }
+    }
+  else if (core->policy == cacheCorePolicyARC)
+    {
+      size_t l1 =
+        cacheCoreQueueLength(core, cacheCoreQueueRecent) +
+        cacheCoreQueueLength(core, cacheCoreQueueRecentGhost);
+      size_t l2 =
+        cacheCoreQueueLength(core, cacheCoreQueueFrequent) +
+        cacheCoreQueueLength(core, cacheCoreQueueFrequentGhost);
+
+      if (l1 >= core->space)
+        {
+          if (cacheCoreQueueLength(core, cacheCoreQueueRecent) < core->space)
+            {
+              cacheCoreQueueDrop(core, cacheCoreQueueRecentGhost);
+            }
+          else
+            {
+              cacheCoreQueueDrop(core, cacheCoreQueueRecent);
+              CACHE_CORE_COUNT(core, evictions);
+            }
+        }
+      else if ((l1+l2) >= (2*core->space))
+        {
+          cacheCoreQueueDrop(core, cacheCoreQueueFrequentGhost);
+        }
+    }
+
+  /* Take the ghost out of its queue so that it can't be dropped */
+  if (ghost != NULL)
+    {
+      cacheCoreQueueRemove(core, ghost);
+    }
+
+  /* Make room */
+  cacheCoreMakeRoom(core, cost);
+  if (core->size >= core->space)
+    {
+      cacheCoreReclaim(core, ghostFrequent);
+    }
+
+  /* Revive the ghost in the frequent queue */
+  if (ghost != NULL)
+    {
+      void *newEntry = cacheCoreDuplicateEntry(core, entry);
+
+      if (newEntry == NULL)
+        {
+          cacheCoreUnlink(core, ghost);
+          cacheCoreDeleteEntry(core, ghost);
+          (core->dealloc)(ghost, core->user);
+          return NULL;
+        }
+      cacheCoreDeleteEntry(core, ghost);
+      ghost->entry = newEntry;
+      ghost->cost = cost;
+      cacheCoreQueuePush(core, ghost, cacheCoreQueueFrequent);
+      return ghost;
+    }
+
+  return cacheCoreNewEntry(core, entry, cost);
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Insert an entry in the cache.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \param entry pointer to caller's data
+ * \return pointer to the \c cacheCoreEntry_t installed. \c NULL indicates
+ * failure.
+ */
+static
+cacheCoreEntry_t *
+cacheCoreInstall(cacheCore_t * const core, void * const entry)
+{
+  cacheCoreEntry_t *cacheEntry;
+  size_t cost;
+
+  /* An entry costing more than the budget can never fit */
+  cost = cacheCoreEntryCost(core, entry);
+  if ((core->budget != 0) && (cost > core->budget))
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Entry cost(%zu) exceeds budget(%zu)!",
+                  cost, core->budget);
+      return NULL;
+    }
+
+  /* First see if we can find the entry in the cache */
+  cacheEntry = cacheCoreLookup(core, entry);
+  if ((cacheEntry != NULL) &&
+      (cacheEntry->queue < cacheCoreQueueRecentGhost))
+    {
+      void *newEntry;
+
+      CACHE_CORE_COUNT(core, replacements);
+
+      /* Move it to the head of the list */
+      if (cacheCoreTouch(core, cacheEntry) == NULL)
+        {
+          core->debug(__func__, __LINE__, core->user,
+                      "cacheCoreTouch() failed");
+          return NULL;
+        }
+
+      /* Make room if the new entry costs more than the old entry */
+      if ((core->budget != 0) &&
+          ((core->totalCost-cacheEntry->cost+cost) > core->budget))
+        {
+          cacheCoreQueue_e queue = cacheEntry->queue;
+
+          cacheCoreQueueRemove(core, cacheEntry);
+          cacheCoreMakeRoom(core, cost);
+          cacheCoreQueuePush(core, cacheEntry, queue);
+        }
+
+      /* New key/value? */
+      newEntry = cacheCoreDuplicateEntry(core, entry);
+      if (newEntry == NULL)
+        {
+          return NULL;
+        }
+      cacheCoreDeleteEntry(core, cacheEntry);
+      cacheEntry->entry = newEntry;
+      core->totalCost = core->totalCost-cacheEntry->cost+cost;
+      cacheEntry->cost = cost;
+
+      return cacheEntry;
+    }
+
+  /* Entry not resident. The 2Q and ARC policies may remember it. */
+  CACHE_CORE_COUNT(core, insertions);
+  if ((core->policy == cacheCorePolicyTwoQ) ||
+      (core->policy == cacheCorePolicyARC))
+    {
+      return cacheCoreInsertQueued(core, entry, cacheEntry, cost);
+    }
+
+  /* Entry not found. Install in the cache */
+  cacheCoreMakeRoom(core, cost);
+  if (core->size < core->space)
+    {
+      return cacheCoreNewEntry(core, entry, cost);
+    }
+
+  /* Reuse the last cache entry or the entry chosen by the hand */
+  cacheEntry = cacheCoreVictim(core);
+  cacheCoreUnlink(core, cacheEntry);
+  cacheCoreTimerRemove(core, cacheEntry);
+  cacheCoreDeleteEntry(core, cacheEntry);
+  CACHE_CORE_COUNT(core, evictions);
+
+  /* Install the new entry */
+  cacheEntry->entry = cacheCoreDuplicateEntry(core, entry);
+  if (cacheEntry->entry == NULL)
+    {
+      /* Drop the reused entry from the list */
+      cacheCoreQueueRemove(core, cacheEntry);
+      (core->dealloc)(cacheEntry, core->user);
+      return NULL;
+    }
+  core->totalCost = core->totalCost-cacheEntry->cost+cost;
+  cacheEntry->cost = cost;
+  if (cacheCoreLink(core, cacheEntry) == false)
+    {
+      cacheCoreQueueRemove(core, cacheEntry);
+      cacheCoreDeleteEntry(core, cacheEntry);
+      (core->dealloc)(cacheEntry, core->user);
+      core->debug(__func__, __LINE__, core->user,
+                  "cacheCoreLink() failed");
+      return NULL;
+    }
+
+  /* Replace a CLOCK entry in place */
+  if (core->policy == cacheCorePolicyClock)
+    {
+      cacheEntry->referenced = false;
+      return cacheEntry;
+    }
+
+  /* Move it to the start of the cache list */
+  if (cacheCoreMoveToHead(core, cacheEntry) == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "cacheCoreMoveToHead() failed");
+      return NULL;
+    }
+
+  return cacheEntry;
+}
+
+/**
+ * Private helper function for cache core implementation.
+ *
+ * Find the length of the longest probe sequence in the hash index.
+ *
+ * \param core pointer to \c cacheCore_t
+ * \return number of slots probed to find the worst-placed entry
+ */
+static
+size_t
+cacheCoreIndexDepth(const cacheCore_t * const core)
+{
+  size_t slot, maxDepth = 0;
+
+  for (slot=0; slot<=core->indexMask; slot++)
+    {
+      if (core->index[slot] != NULL)
+        {
+          size_t home = (core->index[slot])->hash & core->indexMask;
+          size_t depth = ((slot-home) & core->indexMask)+1;
+
+          if (depth > maxDepth)
+            {
+              maxDepth = depth;
+            }
+        }
+    }
+
+  return maxDepth;
+}
+
+cacheCore_t *
+cacheCoreCreate(const size_t space,
+                const size_t entrySize,
+                const cacheCoreAllocFunc_t alloc,
+                const cacheCoreDeallocFunc_t dealloc,
+                const cacheCoreDuplicateEntryFunc_t duplicateEntry,
+                const cacheCoreDeleteEntryFunc_t deleteEntry,
+                const cacheCoreDebugFunc_t debug,
+                const cacheCoreCompFunc_t comp,
+                const cacheCoreHashFunc_t hash,
+                const cacheCoreLinkFunc_t link,
+                const cacheCoreUnlinkFunc_t unlink,
+                const cacheCoreLookupFunc_t lookup,
+                void * const owner,
+                void * const user)
+{
+  cacheCore_t *core;
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (space == 0)
+    {
+      debug(__func__, __LINE__, user, "Invalid space==0 requested!");
+      return NULL;
+    }
+  if (entrySize < sizeof(cacheCoreEntry_t))
+    {
+      debug(__func__, __LINE__, user,
+            "Invalid entrySize(%zu) requested!", entrySize);
+      return NULL;
+    }
+  if ((alloc == NULL) || (dealloc == NULL))
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() or dealloc()!");
+      return NULL;
+    }
+  if (comp == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      return NULL;
+    }
+  if ((hash == NULL) &&
+      ((link == NULL) || (unlink == NULL) || (lookup == NULL)))
+    {
+      debug(__func__, __LINE__, user, "Invalid search tree functions!");
+      return NULL;
+    }
+  if ((hash != NULL) && (space > (SIZE_MAX/(4*sizeof(cacheCoreEntry_t *)))))
+    {
+      debug(__func__, __LINE__, user, "Invalid space(%zu) requested!", space);
+      return NULL;
+    }
+
+  /* Allocate space for cacheCore_t */
+  core = alloc(sizeof(cacheCore_t), user);
+  if (core == NULL)
+    {
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for cacheCore_t", sizeof(cacheCore_t));
+      return NULL;
+    }
+
+  /* Initialise cache core */
+  cacheCoreInitQueues(core);
+  core->alloc = alloc;
+  core->dealloc = dealloc;
+  core->duplicateEntry = duplicateEntry;
+  core->deleteEntry = deleteEntry;
+  core->keyEntry = NULL;
+  core->debug = debug;
+  core->compare = comp;
+  core->link = link;
+  core->unlink = unlink;
+  core->lookup = lookup;
+  core->owner = owner;
+  core->user = user;
+  core->entrySize = entrySize;
+  core->space = space;
+  core->hash = hash;
+  core->index = NULL;
+  core->indexMask = 0;
+  core->policy = cacheCorePolicyLRU;
+  core->stats = (cacheCoreStats_t){ 0 };
+  core->cost = NULL;
+  core->budget = 0;
+  core->clock = NULL;
+  core->ttl = 0;
+  core->wheel = NULL;
+  core->wheelTime = 0;
+  core->timers = 0;
+
+  /* Allocate a power-of-two hash index at most half full */
+  if ((hash != NULL) && (cacheCoreIndexCreate(core, space) == false))
+    {
+      dealloc(core, user);
+      return NULL;
+    }
+
+  return core;
+}
+
+bool
+cacheCoreSetPolicy(cacheCore_t * const core,
+                   const cacheCorePolicy_e policy,
+                   const cacheCoreKeyEntryFunc_t keyEntry)
+{
+  if (core == NULL)
+    {
+      return false;
+    }
+  if (core->size != 0)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Can't change the policy of a cache that is not empty!");
+      return false;
+    }
+  if ((core->index == NULL) && (keyEntry == NULL) &&
+      ((policy == cacheCorePolicyTwoQ) || (policy == cacheCorePolicyARC)))
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Policy %d requires a keyEntry() function!", (int)policy);
+      return false;
+    }
+
+  /* Leave room in the hash index for the ghost entries */
+  if ((core->index != NULL) &&
+      ((policy == cacheCorePolicyTwoQ) || (policy == cacheCorePolicyARC)))
+    {
+      if (core->space > (SIZE_MAX/(8*sizeof(cacheCoreEntry_t *))))
+        {
+          core->debug(__func__, __LINE__, core->user,
+                      "Invalid space(%zu) for policy %d!",
+                      core->space, (int)policy);
+          return false;
+        }
+      if (((core->indexMask+1) < (4*core->space)) &&
+          (cacheCoreIndexCreate(core, 2*core->space) == false))
+        {
+          return false;
+        }
+    }
+
+  core->policy = policy;
+  core->keyEntry = keyEntry;
+
+  return true;
+}
+
+bool
+cacheCoreSetBudget(cacheCore_t * const core,
+                   const size_t budget,
+                   const cacheCoreCostFunc_t cost)
+{
+  if (core == NULL)
+    {
+      return false;
+    }
+  if (cost == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Invalid cost() function!");
+      return false;
+    }
+  if (budget == 0)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Invalid budget(%zu)!", budget);
+      return false;
+    }
+  if (core->size != 0)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Can't change the budget of a cache that is not empty!");
+      return false;
+    }
+
+  core->cost = cost;
+  core->budget = budget;
+
+  return true;
+}
+
+bool
+cacheCoreSetTTL(cacheCore_t * const core,
+                const size_t ttl,
+                const cacheCoreClockFunc_t clock)
+{
+  size_t slot, slots = CACHE_CORE_WHEEL_LEVELS*CACHE_CORE_WHEEL_SLOTS;
+
+  if (core == NULL)
+    {
+      return false;
+    }
+  if (clock == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Invalid clock() function!");
+      return false;
+    }
+  if (core->size != 0)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Can't change the time to live of a cache that "
+                        "is not empty!");
+      return false;
+    }
+
+  if (core->wheel == NULL)
+    {
+      core->wheel = (core->alloc)(slots*sizeof(cacheCoreEntry_t *),
+                                  core->user);
+      if (core->wheel == NULL)
+        {
+          core->debug(__func__, __LINE__, core->user,
+                      "Can't allocate %zu for cacheCore_t timer wheel",
+                      slots*sizeof(cacheCoreEntry_t *));
+          return false;
+        }
+      for (slot=0; slot<slots; slot++)
+        {
+          core->wheel[slot] = NULL;
+        }
+    }
+
+  core->clock = clock;
+  core->ttl = ttl;
+  core->wheelTime = clock(core->user);
+  core->timers = 0;
+
+  return true;
+}
+
+void *
+cacheCoreFind(cacheCore_t * const core, void * const entry)
+{
+  cacheCoreEntry_t *cacheEntry;
+
+  if ((core == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  /* Drop the expired entries */
+  cacheCoreExpire(core);
+
+  /* First see if we find the entry in the cache */
+  CACHE_CORE_COUNT(core, lookups);
+  if (((cacheEntry = cacheCoreLookup(core, entry)) == NULL) ||
+      (cacheEntry->queue >= cacheCoreQueueRecentGhost))
+    {
+      CACHE_CORE_COUNT(core, misses);
+      return NULL;
+    }
+  CACHE_CORE_COUNT(core, hits);
+
+  /* Found! Move it to the head of the list */
+  if (cacheCoreTouch(core, cacheEntry) == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "cacheCoreTouch() failed");
+      return NULL;
+    }
+
+  return cacheEntry->entry;
+}
+
+void *
+cacheCoreInsert(cacheCore_t * const core, void * const entry)
+{
+  if (core == NULL)
+    {
+      return NULL;
+    }
+
+  return cacheCoreInsertWithTTL(core, entry, core->ttl);
+}
+
+void *
+cacheCoreInsertWithTTL(cacheCore_t * const core,
+                       void * const entry,
+                       const size_t ttl)
+{
+  cacheCoreEntry_t *cacheEntry;
+
+  if (core == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      core->debug(__func__, __LINE__, core->user, "Invalid entry==NULL");
+      return NULL;
+    }
+  if ((ttl != 0) && (core->clock == NULL))
+    {
+      core->debug(__func__, __LINE__, core->user,
+                  "Cache has no clock() function!");
+      return NULL;
+    }
+
+  /* Drop the expired entries, then insert and set the expiry time */
+  cacheCoreExpire(core);
+  cacheEntry = cacheCoreInstall(core, entry);
+  if (cacheEntry == NULL)
+    {
+      return NULL;
+    }
+  if (core->wheel != NULL)
+    {
+      cacheCoreSchedule(core, cacheEntry, ttl);
+    }
+
+  return cacheEntry->entry;
+}
+
+void
+cacheCoreClear(cacheCore_t * const core)
+{
+  cacheCoreEntry_t *cacheEntry, *nextCacheEntry;
+  size_t q;
+
+  if (core == NULL)
+    {
+      return;
+    }
+
+  /* Clear the list and the queues */
+  for (q=0; q<cacheCoreQueues; q++)
+    {
+      cacheEntry = cacheCoreQueueHead(core, (cacheCoreQueue_e)q)->next;
+      while (cacheEntry->next != NULL)
+        {
+          nextCacheEntry = cacheEntry->next;
+          cacheCoreDeleteEntry(core, cacheEntry);
+          (core->dealloc)(cacheEntry, core->user);
+          cacheEntry = nextCacheEntry;
+        }
+    }
+  cacheCoreInitQueues(core);
+
+  /* Clear the timer wheel */
+  if (core->wheel != NULL)
+    {
+      size_t slot;
+
+      for (slot=0;
+           slot<(CACHE_CORE_WHEEL_LEVELS*CACHE_CORE_WHEEL_SLOTS);
+           slot++)
+        {
+          core->wheel[slot] = NULL;
+        }
+      core->timers = 0;
+    }
+
+  /* Clear the hash index */
+  if (core->index != NULL)
+    {
+      size_t slot;
+
+      for (slot=0; slot<=core->indexMask; slot++)
+        {
+          core->index[slot] = NULL;
+        }
+    }
+}
+
+void
+cacheCoreDestroy(cacheCore_t * const core)
+{
+  if (core == NULL)
+    {
+      return;
+    }
+
+  cacheCoreClear(core);
+  if (core->index != NULL)
+    {
+      (core->dealloc)(core->index, core->user);
+    }
+  if (core->wheel != NULL)
+    {
+      (core->dealloc)(core->wheel, core->user);
+    }
+  (core->dealloc)(core, core->user);
+}
+
+size_t
+cacheCoreGetSize(const cacheCore_t * const core)
+{
+  if (core == NULL)
+    {
+      return 0;
+    }
+
+  return core->size;
+}
+
+size_t
+cacheCoreGetEntries(const cacheCore_t * const core)
+{
+  if (core == NULL)
+    {
+      return 0;
+    }
+
+  return core->size +
+    core->queueSize[cacheCoreQueueRecentGhost-1] +
+    core->queueSize[cacheCoreQueueFrequentGhost-1];
+}
+
+size_t
+cacheCoreGetCost(const cacheCore_t * const core)
+{
+  if (core == NULL)
+    {
+      return 0;
+    }
+
+  return core->totalCost;
+}
+
+bool
+cacheCoreGetStats(const cacheCore_t * const core,
+                  cacheCoreStats_t * const stats)
+{
+  if ((core == NULL) || (stats == NULL))
+    {
+      return false;
+    }
+#if defined(CACHE_CORE_NO_STATS)
+  return false;
+#else
+  *stats = core->stats;
+  return true;
+#endif
+}
+
+size_t
+cacheCoreGetDepth(const cacheCore_t * const core)
+{
+  if ((core == NULL) || (core->index == NULL))
+    {
+      return 0;
+    }
+
+  return cacheCoreIndexDepth(core);
+}
+
+bool
+cacheCoreWalk(cacheCore_t * const core, const cacheCoreWalkFunc_t walk)
+{
+  cacheCoreEntry_t *cacheEntry, *nextCacheEntry;
+  size_t q;
+
+  if ((core == NULL) || (walk == NULL))
+    {
+      return false;
+    }
+
+  for (q=0; q<=cacheCoreQueueFrequent; q++)
+    {
+      cacheEntry = cacheCoreQueueHead(core, (cacheCoreQueue_e)q)->next;
+      while (cacheEntry->next != NULL)
+        {
+          nextCacheEntry = cacheEntry->next;
+          if (walk(cacheEntry->entry, core->user) == false)
+            {
+              return false;
+            }
+
+          cacheEntry = nextCacheEntry;
+        }
+    }
+
+  return true;
+}
+
+bool
+cacheCoreCheck(cacheCore_t * const core, const cacheCoreCheckFunc_t check)
+{
+  const cacheCoreEntry_t *cacheEntry;
+  size_t q, count = 0;
+
+  if ((core == NULL) || (core->size > core->space))
+    {
+      return false;
+    }
+
+  /* Check that each entry in the queues is found in the hash index and
+     that only the ghost entries in a hash index have no caller's data */
+  for (q=0; q<cacheCoreQueues; q++)
+    {
+      for (cacheEntry = cacheCoreQueueHead(core, (cacheCoreQueue_e)q)->next;
+           cacheEntry->next != NULL;
+           cacheEntry = cacheEntry->next)
+        {
+          bool ghost = (q >= cacheCoreQueueRecentGhost);
+
+          if ((cacheEntry->entry == NULL) !=
+              (ghost && (core->index != NULL)))
+            {
+              return false;
+            }
+          if ((core->index != NULL) &&
+              (core->index[cacheCoreIndexPlace(core, cacheEntry)]
+               != cacheEntry))
+            {
+              return false;
+            }
+          if ((check != NULL) && (check(cacheEntry, core->owner) == false))
+            {
+              return false;
+            }
+          count = count+1;
+        }
+    }
+
+  return (count == cacheCoreGetEntries(core));
+}
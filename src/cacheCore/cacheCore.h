@@ -0,0 +1,537 @@
+/**
+ * \file cacheCore.h
+ *
+ * Private interface for the entry management shared by the cache types.
+ * A \e cacheCore_t holds the entries of a cache in the queues of its
+ * replacement policy, finds them with an optional hash index, expires
+ * them with a timer wheel, keeps their total cost within a budget and
+ * counts the cache operations. It is not part of the public interface of
+ * any type. Each cache type keeps its own search tree and passes callbacks
+ * that link entries into that tree, unlink them and look them up. The
+ * callbacks are only used if the cache has no hash index.
+ */
+
+#if !defined(CACHE_CORE_H)
+#define CACHE_CORE_H
+
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstdbool>
+#include <cstddef>
+using std::size_t;
+extern "C" {
+#else
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#endif
+
+#include "compare.h"
+
+/**
+ * \e cacheCore_t structure. An opaque type for the entries of a cache.
+ */
+typedef struct cacheCore_t cacheCore_t;
+
+/**
+ * \e cacheCore_t queues.
+ *
+ * The main list holds every entry with the LRU and CLOCK policies. With
+ * the 2Q policy it is the A1in FIFO and with the ARC policy it is the T1
+ * list. The other queues hold the frequently used entries and the ghost
+ * entries that remember the keys of recently evicted entries. Ghost
+ * entries stay in the cache index but are never returned to the caller.
+ * The caller's data of an entry is deleted when it becomes a ghost. A
+ * ghost keeps only the hash of its key in a hash index or a key-only copy
+ * of the caller's data in a search tree.
+ */
+typedef enum cacheCoreQueue_e
+{
+  cacheCoreQueueRecent=0,
+  /**< Main list. 2Q A1in or ARC T1. */
+
+  cacheCoreQueueFrequent,
+  /**< 2Q Am or ARC T2. */
+
+  cacheCoreQueueRecentGhost,
+  /**< 2Q A1out or ARC B1. Ghosts of entries evicted from the main list. */
+
+  cacheCoreQueueFrequentGhost,
+  /**< ARC B2. Ghosts of entries evicted from the frequent queue. */
+
+  cacheCoreQueues
+  /**< Number of queues. */
+}
+  cacheCoreQueue_e;
+
+/**
+ * \e cacheCore_t entry type.
+ *
+ * Internal representation of a cache entry. A cache type with a search
+ * tree may allocate larger entries that start with a \e cacheCoreEntry_t
+ * and continue with its tree links.
+ */
+typedef struct cacheCoreEntry_t
+{
+  void *entry;
+  /**< Pointer to caller's entry data.
+     This memory was allocated by the caller. For a ghost entry it is
+     \e NULL in a hash index or a key-only copy in a search tree. */
+
+  struct cacheCoreEntry_t *next;
+  /**< Pointer to the next entry */
+
+  struct cacheCoreEntry_t *prev;
+  /**< Pointer to the previous entry */
+
+  size_t hash;
+  /**< Hash of the caller's entry data if the cache has a hash index. */
+
+  bool referenced;
+  /**< Reference bit set by a hit if the cache has a CLOCK policy. */
+
+  size_t cost;
+  /**< Cost of the entry when it was inserted. */
+
+  cacheCoreQueue_e queue;
+  /**< Queue holding the entry. */
+
+  size_t expiry;
+  /**< Time at which the entry expires. */
+
+  struct cacheCoreEntry_t *timerNext;
+  /**< Pointer to the next entry in the same timer wheel slot. */
+
+  struct cacheCoreEntry_t **timerPrev;
+  /**< Pointer to the pointer to this entry in the timer wheel slot.
+     \e NULL if the entry does not expire. */
+}
+  cacheCoreEntry_t;
+
+/**
+ * \e cacheCore_t replacement policy.
+ *
+ * The replacement policies of the cache types, in the same order.
+ */
+typedef enum cacheCorePolicy_e
+{
+  cacheCorePolicyLRU=0,
+  /**< Replace the least recently used entry. */
+
+  cacheCorePolicyClock,
+  /**< CLOCK or second-chance replacement. */
+
+  cacheCorePolicyTwoQ,
+  /**< 2Q replacement. */
+
+  cacheCorePolicyARC
+  /**< Adaptive Replacement Cache. */
+}
+  cacheCorePolicy_e;
+
+/**
+ * \e cacheCore_t statistics.
+ *
+ * Counts of the cache operations since the cache was created. If
+ * \e cacheCore.c is compiled with \c CACHE_CORE_NO_STATS defined then the
+ * counters are compiled out.
+ */
+typedef struct cacheCoreStats_t
+{
+  size_t lookups;
+  /**< Number of calls to \e cacheCoreFind(). */
+
+  size_t hits;
+  /**< Number of lookups that found the entry in the cache. */
+
+  size_t misses;
+  /**< Number of lookups that did not find the entry in the cache. */
+
+  size_t insertions;
+  /**< Number of insertions of an entry not in the cache. */
+
+  size_t replacements;
+  /**< Number of insertions that replaced an entry already in the cache. */
+
+  size_t evictions;
+  /**< Number of entries evicted to make room for an insertion. */
+
+  size_t expirations;
+  /**< Number of entries removed because their time to live expired. */
+}
+  cacheCoreStats_t;
+
+/**
+ * \e cacheCore_t memory allocator.
+ *
+ * \param amount of memory requested
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to the memory allocated. \e NULL indicates failure.
+ */
+typedef void *(*cacheCoreAllocFunc_t)(const size_t amount,
+                                      void * const user);
+
+/**
+ * \e cacheCore_t memory de-allocator.
+ *
+ * \param pointer to memory to be deallocated
+ * \param user \e void pointer to user data to be echoed by callbacks
+ */
+typedef void (*cacheCoreDeallocFunc_t)(void * const pointer,
+                                       void * const user);
+
+/**
+ * Duplicate the caller's entry data.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to the copy. \e NULL indicates failure.
+ */
+typedef void *(*cacheCoreDuplicateEntryFunc_t)(void * const entry,
+                                               void * const user);
+
+/**
+ * Delete the caller's entry data.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return \e bool indicating success
+ */
+typedef bool (*cacheCoreDeleteEntryFunc_t)(void * const entry,
+                                           void * const user);
+
+/**
+ * Copy the key of the caller's entry data for a ghost entry.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a copy that holds at least the key of the entry and
+ * is deleted by the \e deleteEntry() callback. \e NULL indicates failure.
+ */
+typedef void *(*cacheCoreKeyEntryFunc_t)(void * const entry,
+                                         void * const user);
+
+/**
+ * Debugging message. Accepts a variable argument list like \e printf().
+ *
+ * \param function name
+ * \param line number
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \param format string
+ * \param ... variable argument list
+ */
+typedef void (*cacheCoreDebugFunc_t)(const char *function,
+                                     const unsigned int line,
+                                     void * const user,
+                                     const char *format,
+                                     ...);
+
+/**
+ * Compare the caller's entry data.
+ *
+ * \param a pointer to an entry defined by the caller
+ * \param b pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return \e compare_e value
+ */
+typedef compare_e (*cacheCoreCompFunc_t)(const void * const a,
+                                         const void * const b,
+                                         void * const user);
+
+/**
+ * Hash the key of the caller's entry data.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return hash of the entry key
+ */
+typedef size_t (*cacheCoreHashFunc_t)(const void * const entry,
+                                      void * const user);
+
+/**
+ * Find the cost of the caller's entry data.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return cost of the entry
+ */
+typedef size_t (*cacheCoreCostFunc_t)(const void * const entry,
+                                      void * const user);
+
+/**
+ * Read the time.
+ *
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return current time
+ */
+typedef size_t (*cacheCoreClockFunc_t)(void * const user);
+
+/**
+ * Operate on the caller's entry data.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return \e bool indicating success
+ */
+typedef bool (*cacheCoreWalkFunc_t)(void * const entry, void * const user);
+
+/**
+ * Add an entry to the search tree of the owning cache.
+ *
+ * \param cacheEntry pointer to the \e cacheCoreEntry_t
+ * \param owner \e void pointer to the owning cache
+ * \return \e bool indicating success
+ */
+typedef bool (*cacheCoreLinkFunc_t)(cacheCoreEntry_t * const cacheEntry,
+                                    void * const owner);
+
+/**
+ * Remove an entry from the search tree of the owning cache.
+ *
+ * \param cacheEntry pointer to the \e cacheCoreEntry_t
+ * \param owner \e void pointer to the owning cache
+ */
+typedef void (*cacheCoreUnlinkFunc_t)(cacheCoreEntry_t * const cacheEntry,
+                                      void * const owner);
+
+/**
+ * Find the entry for the caller's entry data in the search tree of the
+ * owning cache.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param owner \e void pointer to the owning cache
+ * \return pointer to the \e cacheCoreEntry_t. \e NULL if not found.
+ */
+typedef cacheCoreEntry_t *(*cacheCoreLookupFunc_t)(void * const entry,
+                                                   void * const owner);
+
+/**
+ * Check an entry in the search tree of the owning cache.
+ *
+ * \param cacheEntry pointer to the \e cacheCoreEntry_t
+ * \param owner \e void pointer to the owning cache
+ * \return \e bool indicating success
+ */
+typedef bool (*cacheCoreCheckFunc_t)(const cacheCoreEntry_t * const cacheEntry,
+                                     void * const owner);
+
+/**
+ * Create an empty cache core.
+ *
+ * Creates and initialises an empty \e cacheCore_t instance with the LRU
+ * policy, no budget and no timer wheel. If \e hash is not \e NULL then
+ * the entries are found with a hash index of at least twice \e space
+ * slots. Otherwise they are found with the \e link(), \e unlink() and
+ * \e lookup() callbacks. Fails if the hash index would not fit in a
+ * \e size_t.
+ *
+ * \param space maximum number of entries in the cache
+ * \param entrySize size in bytes of each entry. At least the size of a
+ * \e cacheCoreEntry_t.
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for caller's entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param hash entry key hash function callback. \e NULL for a search tree.
+ * \param link search tree insertion callback
+ * \param unlink search tree removal callback
+ * \param lookup search tree lookup callback
+ * \param owner \e void pointer to the owning cache echoed by the search
+ * tree callbacks
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e cacheCore_t. \e NULL indicates failure.
+ */
+cacheCore_t *cacheCoreCreate(const size_t space,
+                             const size_t entrySize,
+                             const cacheCoreAllocFunc_t alloc,
+                             const cacheCoreDeallocFunc_t dealloc,
+                             const cacheCoreDuplicateEntryFunc_t duplicateEntry,
+                             const cacheCoreDeleteEntryFunc_t deleteEntry,
+                             const cacheCoreDebugFunc_t debug,
+                             const cacheCoreCompFunc_t comp,
+                             const cacheCoreHashFunc_t hash,
+                             const cacheCoreLinkFunc_t link,
+                             const cacheCoreUnlinkFunc_t unlink,
+                             const cacheCoreLookupFunc_t lookup,
+                             void * const owner,
+                             void * const user);
+
+/**
+ * Set the replacement policy of an empty cache core.
+ *
+ * With the 2Q and ARC policies the hash index, if any, is enlarged to
+ * hold the ghost entries. Without a hash index these policies need the
+ * \e keyEntry() callback to make the key-only copies kept by the ghost
+ * entries.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param policy \e cacheCorePolicy_e value
+ * \param keyEntry key copy callback for the ghost entries. May be \e NULL
+ * with a hash index or with the LRU and CLOCK policies.
+ * \return \e bool indicating success
+ */
+bool cacheCoreSetPolicy(cacheCore_t * const core,
+                        const cacheCorePolicy_e policy,
+                        const cacheCoreKeyEntryFunc_t keyEntry);
+
+/**
+ * Set the budget of an empty cache core.
+ *
+ * The budget bounds the total cost of the resident entries. The ghost
+ * entries are not counted since they hold no caller's data.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param budget maximum total cost of the entries
+ * \param cost entry cost function callback
+ * \return \e bool indicating success
+ */
+bool cacheCoreSetBudget(cacheCore_t * const core,
+                        const size_t budget,
+                        const cacheCoreCostFunc_t cost);
+
+/**
+ * Set the default time to live of the entries of an empty cache core,
+ * creating its empty timer wheel if necessary.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param ttl default time to live of an entry. \e 0 if entries do not
+ * expire by default.
+ * \param clock time callback
+ * \return \e bool indicating success
+ */
+bool cacheCoreSetTTL(cacheCore_t * const core,
+                     const size_t ttl,
+                     const cacheCoreClockFunc_t clock);
+
+/**
+ * Find an entry.
+ *
+ * Drops the expired entries and then records a lookup of the entry. A
+ * hit is recorded as required by the policy.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param entry pointer to caller's data
+ * \return pointer to the entry found. \e NULL if not found.
+ */
+void *cacheCoreFind(cacheCore_t * const core, void * const entry);
+
+/**
+ * Insert an entry with the default time to live.
+ *
+ * Drops the expired entries, then inserts a copy of the entry, evicting
+ * entries chosen by the policy if necessary, and sets its expiry time.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param entry pointer to caller's data
+ * \return pointer to the entry installed. \e NULL indicates failure.
+ */
+void *cacheCoreInsert(cacheCore_t * const core, void * const entry);
+
+/**
+ * Insert an entry with its own time to live.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param entry pointer to caller's data
+ * \param ttl time to live of the entry. \e 0 if the entry does not expire.
+ * \return pointer to the entry installed. \e NULL indicates failure.
+ */
+void *cacheCoreInsertWithTTL(cacheCore_t * const core,
+                             void * const entry,
+                             const size_t ttl);
+
+/**
+ * Remove and deallocate every entry.
+ *
+ * The search tree callbacks are not called. The owning cache must empty
+ * its search tree itself.
+ *
+ * \param core \e cacheCore_t pointer
+ */
+void cacheCoreClear(cacheCore_t * const core);
+
+/**
+ * Destroy the cache core.
+ *
+ * Deallocates every entry, the hash index, the timer wheel and the cache
+ * core.
+ *
+ * \param core \e cacheCore_t pointer
+ */
+void cacheCoreDestroy(cacheCore_t * const core);
+
+/**
+ * Get the number of entries in the cache.
+ *
+ * \param core \e cacheCore_t pointer
+ * \return number of entries, not counting the ghost entries
+ */
+size_t cacheCoreGetSize(const cacheCore_t * const core);
+
+/**
+ * Get the number of entries in the cache index.
+ *
+ * \param core \e cacheCore_t pointer
+ * \return number of entries, counting the ghost entries
+ */
+size_t cacheCoreGetEntries(const cacheCore_t * const core);
+
+/**
+ * Get the total cost of the entries in the cache.
+ *
+ * \param core \e cacheCore_t pointer
+ * \return total cost of the entries, not counting the ghost entries
+ */
+size_t cacheCoreGetCost(const cacheCore_t * const core);
+
+/**
+ * Get the operation counts of the cache.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param stats pointer to \e cacheCoreStats_t filled in with the counts
+ * \return \e bool indicating success. \e false if the counters are
+ * compiled out.
+ */
+bool cacheCoreGetStats(const cacheCore_t * const core,
+                       cacheCoreStats_t * const stats);
+
+/**
+ * Get the length of the longest probe sequence in the hash index.
+ *
+ * \param core \e cacheCore_t pointer
+ * \return number of slots probed to find the worst-placed entry. \e 0 if
+ * the cache has no hash index.
+ */
+size_t cacheCoreGetDepth(const cacheCore_t * const core);
+
+/**
+ * Walk the entries of the cache from the most to the least recently used
+ * entry of the main list, followed by the frequent queue.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param walk function called on each entry
+ * \return \e bool indicating success
+ */
+bool cacheCoreWalk(cacheCore_t * const core, const cacheCoreWalkFunc_t walk);
+
+/**
+ * Check the cache core.
+ *
+ * Checks the number of entries, that only the ghost entries in a hash
+ * index have no caller's data and that each entry, including the ghost
+ * entries, is found in the hash index or passes the \e check() callback.
+ *
+ * \param core \e cacheCore_t pointer
+ * \param check search tree check callback. \e NULL if not needed.
+ * \return \e bool indicating success
+ */
+bool cacheCoreCheck(cacheCore_t * const core,
+                    const cacheCoreCheckFunc_t check);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
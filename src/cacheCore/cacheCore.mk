@@ -0,0 +1,4 @@
+# No programs in this directory. cacheCore.c is compiled into the programs
+# of the cache types that use it.
+
+VPATH += src/cacheCore
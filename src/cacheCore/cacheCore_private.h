@@ -0,0 +1,184 @@
+/**
+ * \file cacheCore_private.h
+ *
+ * Private definition for the cache core type.
+ */
+
+#if !defined(CACHE_CORE_PRIVATE_H)
+#define CACHE_CORE_PRIVATE_H
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstdbool>
+#include <cstddef>
+using std::size_t;
+extern "C" {
+#else
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#endif
+
+#include "compare.h"
+#include "cacheCore.h"
+
+/**
+ * Dimensions of the \c cacheCore_t timer wheel. Each of the
+ * \c CACHE_CORE_WHEEL_LEVELS levels has \c CACHE_CORE_WHEEL_SLOTS
+ * slots. A slot of level \e l holds the entries expiring in an interval of
+ * \c CACHE_CORE_WHEEL_SLOTS to the power \e l ticks.
+ */
+#define CACHE_CORE_WHEEL_BITS 6
+#define CACHE_CORE_WHEEL_SLOTS ((size_t)1 << CACHE_CORE_WHEEL_BITS)
+#define CACHE_CORE_WHEEL_LEVELS 4
+
+/**
+ * Increment a \c cacheCoreStats_t counter of a cache core. Does nothing if
+ * \c CACHE_CORE_NO_STATS is defined.
+ */
+#if defined(CACHE_CORE_NO_STATS)
+#define CACHE_CORE_COUNT(core, counter) ((void)0)
+#else
+#define CACHE_CORE_COUNT(core, counter) \
+  ((core)->stats.counter = (core)->stats.counter+1)
+#endif
+
+/**
+ * \c cacheCore_t structure.
+ *
+ * Private implementation of \c cacheCore_t. Uses linked lists of entries
+ * for the policy queues and either a hash index or the search tree of the
+ * owning cache. New entries are allocated up to \e space after which the
+ * entry chosen by the policy is re-used or evicted.
+ */
+struct cacheCore_t
+{
+  cacheCoreAllocFunc_t alloc;
+  /**< Memory allocator callback function. */
+
+  cacheCoreDeallocFunc_t dealloc;
+  /**< Memory de-allocator callback function. */
+
+  cacheCoreDuplicateEntryFunc_t duplicateEntry;
+  /**< Entry duplication callback function for the caller's entry data. */
+
+  cacheCoreDeleteEntryFunc_t deleteEntry;
+  /**< Memory deallocator callback function for the caller's entry data. */
+
+  cacheCoreKeyEntryFunc_t keyEntry;
+  /**< Key copy callback function for the ghost entries. \c NULL unless
+     the cache has the 2Q or ARC policy and no hash index. */
+
+  cacheCoreDebugFunc_t debug;
+  /**< Debugging message callback function. */
+
+  cacheCoreCompFunc_t compare;
+  /**< Callback function to compare two entries in the hash index. */
+
+  cacheCoreLinkFunc_t link;
+  /**< Callback function to add an entry to the search tree. */
+
+  cacheCoreUnlinkFunc_t unlink;
+  /**< Callback function to remove an entry from the search tree. */
+
+  cacheCoreLookupFunc_t lookup;
+  /**< Callback function to find an entry in the search tree. */
+
+  void *owner;
+  /**< Owning cache echoed by the search tree callbacks. */
+
+  void *user;
+  /**< Placeholder for user data in callbacks. */
+
+  size_t entrySize;
+  /**< Size of each entry allocated. */
+
+  cacheCoreEntry_t head;
+  /**< First entry. This is a dummy list entry. It never stores a list
+     entry data entry pointer. It simplifies list manipulations. The
+     \e head.prev member is always \c NULL. The \e head.next member
+     points to the first real list entry. If the list is empty then
+     \e head.next points to \e tail.prev . */
+
+  cacheCoreEntry_t tail;
+  /**< Last entry. Also a dummy list entry. The \e tail.next member
+     is always \c NULL. The \e tail.prev member points to the last
+     real list entry. If the list is empty then \e tail.prev
+     points to \e head.next .*/
+
+  size_t size;
+  /**< Number of entries in the cache. */
+
+  size_t space;
+  /**< Maximum number of entries in the cache. */
+
+  cacheCoreHashFunc_t hash;
+  /**< Callback function to hash an entry to a slot in \e index. \c NULL
+     if there is no hash index. */
+
+  cacheCoreEntry_t **index;
+  /**< Open-addressing hash table of entries with linear probing. The
+     table has a power-of-two number of slots, at least twice \e space.
+     \c NULL if the entries are found with the search tree. */
+
+  size_t indexMask;
+  /**< Number of slots in \e index less one. */
+
+  cacheCorePolicy_e policy;
+  /**< Eviction policy. */
+
+  cacheCoreEntry_t *hand;
+  /**< Next entry examined by the CLOCK policy hand. The hand moves from
+     \e tail towards \e head and wraps around. \c NULL if the hand is
+     at \e tail. */
+
+  cacheCoreEntry_t queueHead[cacheCoreQueues-1];
+  /**< Dummy first entries of the queues other than the main list. */
+
+  cacheCoreEntry_t queueTail[cacheCoreQueues-1];
+  /**< Dummy last entries of the queues other than the main list. */
+
+  size_t queueSize[cacheCoreQueues-1];
+  /**< Number of entries in the queues other than the main list. The
+     entries in the main and frequent queues are counted in \e size. */
+
+  size_t target;
+  /**< ARC target length of the main list. */
+
+  cacheCoreStats_t stats;
+  /**< Operation counts. */
+
+  cacheCoreCostFunc_t cost;
+  /**< Callback function to find the cost of an entry. \c NULL if each
+     entry costs one. */
+
+  size_t budget;
+  /**< Maximum total cost of the entries. \c 0 if there is no budget. */
+
+  size_t totalCost;
+  /**< Total cost of the entries in the main and frequent queues. */
+
+  cacheCoreClockFunc_t clock;
+  /**< Callback function to read the time. \c NULL if entries do not
+     expire. */
+
+  size_t ttl;
+  /**< Time to live of the entries inserted by \e cacheCoreInsert(). */
+
+  cacheCoreEntry_t **wheel;
+  /**< Timer wheel. Lists of entries linked through \e timerNext, in
+     \c CACHE_CORE_WHEEL_LEVELS levels of \c CACHE_CORE_WHEEL_SLOTS
+     slots. \c NULL if entries do not expire. */
+
+  size_t wheelTime;
+  /**< Time up to which the timer wheel has been processed. */
+
+  size_t timers;
+  /**< Number of entries in the timer wheel. */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
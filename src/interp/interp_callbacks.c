@@ -134,3 +134,29 @@ compare_e interpComp(const void * const a,
       return compareEqual;
     }
 }
+
+size_t
+interpCost(const void * const entry, void * const user)
+{
+  data_t value;
+
+  (void) user;
+  if (entry == NULL)
+    {
+      interpError(__func__, __LINE__, " NULL pointer!");
+      return 0;
+    }
+
+  value = *(const data_t *)entry;
+  return (value < 0) ? (size_t)(-value) : (size_t)value;
+}
+
+size_t
+interpClock(void * const user)
+{
+  static size_t now = 0;
+
+  (void) user;
+  now = now+1;
+  return now;
+}
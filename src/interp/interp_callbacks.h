@@ -105,6 +105,30 @@ void interpDebug(const char *function,
 compare_e
 interpComp(const void * const a, const void * const b, void * const user);
 
+/**
+ * Interpreter entry cost callback function.
+ *
+ * Data structure entry cost callback function. The cost of an entry is
+ * the magnitude of its value.
+ *
+ * \param entry pointer to the entry
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return cost of the entry
+ */
+size_t interpCost(const void * const entry, void * const user);
+
+/**
+ * Interpreter clock callback function.
+ *
+ * Data structure clock callback function. The clock advances by one
+ * each time it is read so that time is counted in data structure
+ * operations and the output of a script does not depend on the real time.
+ *
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return current time
+ */
+size_t interpClock(void * const user);
+
 /** @}*/
 
 #ifdef __cplusplus
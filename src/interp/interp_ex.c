@@ -266,7 +266,16 @@ data_t ex(nodeType *p)
 
         case CREATE:
           {
-            void *tmp = interpCreate();
+            void *tmp;
+            if (p->opr.nops == 1)
+              {
+                data_t size = ex(op[0]);
+                tmp = interpCreateWithSize((size_t)size);
+              }
+            else
+              {
+                tmp = interpCreate();
+              }
             return (data_t)tmp;
           }
 
@@ -416,6 +425,112 @@ data_t ex(nodeType *p)
             return (data_t)tmp;
           }
 
+        case BUILD:      
+          {
+            data_t key = ex(op[0]);
+            data_t n = ex(op[1]);
+            if (n < 0)
+              {
+                interpError(__func__, __LINE__, "build() with n<0!\n");
+              }
+            bool tmp = interpBuild((void *)key, (size_t)n);
+            return (data_t)tmp;
+          }
+
+        case WALKRANGE:      
+          {
+            data_t key = ex(op[0]);
+            data_t lo = ex(op[1]);
+            data_t hi = ex(op[2]);
+            data_t val = ex(op[3]);
+            interpWalkFunc_t walk = (interpWalkFunc_t)val;
+            if (walk != (interpWalkFunc_t)interpShow)
+              {
+                interpMessage("Bad walk function"); 
+                return 0;
+              }
+            return interpWalkRange((void *)key, (void *)lo, (void *)hi, walk);
+          }
+
+        case REMOVERANGE:      
+          {
+            data_t key = ex(op[0]);
+            data_t lo = ex(op[1]);
+            data_t hi = ex(op[2]);
+            size_t tmp = interpRemoveRange((void *)key, (void *)lo, (void *)hi);
+            return (data_t)tmp;
+          }
+
+        case POLICY:      
+          {
+            data_t key = ex(op[0]);
+            data_t policy = ex(op[1]);
+            if (policy < 0)
+              {
+                interpError(__func__, __LINE__, "policy() with policy<0!\n");
+              }
+            bool tmp = interpSetPolicy((void *)key, (size_t)policy);
+            return (data_t)tmp;
+          }
+
+        case STATS:      
+          {
+            data_t key = ex(op[0]);
+            bool tmp = interpShowStats((void *)key);
+            return (data_t)tmp;
+          }
+
+        case BUDGET:      
+          {
+            data_t key = ex(op[0]);
+            data_t budget = ex(op[1]);
+            if (budget < 0)
+              {
+                interpError(__func__, __LINE__, "budget() with budget<0!\n");
+              }
+            bool tmp = interpSetBudget((void *)key, (size_t)budget);
+            return (data_t)tmp;
+          }
+
+        case TTL:      
+          {
+            data_t key = ex(op[0]);
+            data_t ttl = ex(op[1]);
+            if (ttl < 0)
+              {
+                interpError(__func__, __LINE__, "ttl() with ttl<0!\n");
+              }
+            bool tmp = interpSetTTL((void *)key, (size_t)ttl);
+            return (data_t)tmp;
+          }
+
+        case TOPK:      
+          {
+            data_t key = ex(op[0]);
+            data_t k = ex(op[1]);
+            if (k < 0)
+              {
+                interpError(__func__, __LINE__, "topk() with k<0!\n");
+              }
+            bool tmp = interpSetTopK((void *)key, (size_t)k);
+            return (data_t)tmp;
+          }
+
+        case FINGER:      
+          {
+            data_t key = ex(op[0]);
+            data_t finger = ex(op[1]);
+            bool tmp = interpSetFinger((void *)key, finger != 0);
+            return (data_t)tmp;
+          }
+
+        case COST:    
+          {
+            data_t key = ex(op[0]);
+            data_t tmp = (data_t)interpGetCost((void *)key);
+            return (data_t)tmp;
+          }
+
         case POP:      
           { 
             data_t key = ex(op[0]);
@@ -452,6 +567,14 @@ data_t ex(nodeType *p)
             return (data_t)tmp;
           }
 
+        case MELD:      
+          {
+            data_t key = ex(op[0]);
+            data_t val = ex(op[1]);
+            bool tmp = interpMeld((void *)key, (void *)val);
+            return (data_t)tmp;
+          }
+
         default:
           {
             interpError(__func__, __LINE__, "Invalid operator!"); 
@@ -40,6 +40,22 @@ extern "C" {
  */
 void *interpCreate(void);
 
+/**
+ * Interpreter data structure create function with a size argument.
+ * 
+ * Interpreter function to create a data structure with a size argument.
+ * The size is the one size parameter of the data structure. It does not
+ * change how entries are stored or compared, which is as for
+ * \e interpCreate(). The size is the maximum number of entries of a cache
+ * or skip list, the initial number of entries of a stack, the arity of a
+ * binary heap and, for the binary trees, the number of tree nodes in each
+ * chunk of an arena. A data structure without a size parameter (eg: list)
+ * reports an error.
+ * \param size size argument passed to the data structure \e create function
+ * \return \e void pointer to the data structure created. NULL indicates failure.
+ */
+void *interpCreateWithSize(const size_t size);
+
 /**
  * Interpreter data structure push function.
  * 
@@ -253,6 +269,110 @@ typedef bool (*interpWalkFunc_t)(void * const entry, void * const user);
  */
 bool interpWalk(void * const pointer, const interpWalkFunc_t walk);
 
+/**
+ * Interpreter data structure range walk function.
+ * 
+ * Interpreter function to walk the entries of the data structure not less
+ * than \e lo and less than \e hi running a \e walk() function on each entry.
+ * \param pointer \e void pointer to the data structure
+ * \param lo \e void pointer to the entry at the start of the range
+ * \param hi \e void pointer to the entry at the end of the range
+ * \param walk \e interpWalkFunc_t pointer to a function operating on each entry
+ * \return \e bool indicating success
+ */
+bool interpWalkRange(void * const pointer, 
+                     const void * const lo,
+                     const void * const hi,
+                     const interpWalkFunc_t walk);
+
+/**
+ * Interpreter data structure range remove function.
+ * 
+ * Interpreter function to remove the entries of the data structure not less
+ * than \e lo and less than \e hi.
+ * \param pointer \e void pointer to the data structure
+ * \param lo \e void pointer to the entry at the start of the range
+ * \param hi \e void pointer to the entry at the end of the range
+ * \return number of entries removed
+ */
+size_t interpRemoveRange(void * const pointer,
+                         const void * const lo,
+                         const void * const hi);
+
+/**
+ * Interpreter data structure replacement policy function.
+ * 
+ * Interpreter function to select the replacement policy of an empty cache.
+ * The policies are numbered in the order of the cache policy enumeration,
+ * starting from \e 0 for LRU.
+ * \param pointer \e void pointer to the data structure
+ * \param policy number of the replacement policy
+ * \return \e bool indicating success
+ */
+bool interpSetPolicy(void * const pointer, const size_t policy);
+
+/**
+ * Interpreter data structure statistics function.
+ * 
+ * Interpreter function to print the operation counts of a cache.
+ * \param pointer \e void pointer to the data structure
+ * \return \e bool indicating success
+ */
+bool interpShowStats(void * const pointer);
+
+/**
+ * Interpreter data structure budget function.
+ * 
+ * Interpreter function to bound the total cost of the entries of an empty
+ * cache. The cost of an entry is the magnitude of its value.
+ * \param pointer \e void pointer to the data structure
+ * \param budget maximum total cost of the entries
+ * \return \e bool indicating success
+ */
+bool interpSetBudget(void * const pointer, const size_t budget);
+
+/**
+ * Interpreter data structure time to live function.
+ * 
+ * Interpreter function to make the entries of an empty cache expire. The
+ * time is counted in cache operations.
+ * \param pointer \e void pointer to the data structure
+ * \param ttl time to live of an entry
+ * \return \e bool indicating success
+ */
+bool interpSetTTL(void * const pointer, const size_t ttl);
+
+/**
+ * Interpreter data structure top-K function.
+ * 
+ * Interpreter function to make an empty heap keep only the \e k greatest
+ * entries pushed onto it.
+ * \param pointer \e void pointer to the data structure
+ * \param k maximum number of entries. 0 for an unbounded heap.
+ * \return \e bool indicating success
+ */
+bool interpSetTopK(void * const pointer, const size_t k);
+
+/**
+ * Interpreter data structure finger search function.
+ * 
+ * Interpreter function to select searches that start from the previous
+ * search path.
+ * \param pointer \e void pointer to the data structure
+ * \param finger \e true to select finger search
+ * \return \e bool indicating success
+ */
+bool interpSetFinger(void * const pointer, const bool finger);
+
+/**
+ * Interpreter data structure cost function.
+ * 
+ * Interpreter function to return the total cost of the entries of a cache.
+ * \param pointer \e void pointer to the data structure
+ * \return total cost of the entries
+ */
+size_t interpGetCost(void * const pointer);
+
 /**
  * Interpreter data structure sort function.
  * 
@@ -272,6 +392,17 @@ bool interpSort(void * const pointer);
  */
 bool interpBalance(void * const pointer);
 
+/**
+ * Interpreter data structure build function.
+ * 
+ * Interpreter function to fill an empty data structure with the
+ * entries \e 0 to \e n-1 in a single operation.
+ * \param pointer \e void pointer to the data structure
+ * \param n number of entries
+ * \return \e bool indicating success
+ */
+bool interpBuild(void * const pointer, const size_t n);
+
 /**
  * Interpreter data structure copy function.
  * 
@@ -282,6 +413,16 @@ bool interpBalance(void * const pointer);
  */
 void *interpCopy(void * const dst, void * const src);
 
+/**
+ * Interpreter data structure meld function.
+ * 
+ * Interpreter function to move the entries of one heap into another.
+ * \param dst \e void pointer to the destination data structure
+ * \param src \e void pointer to the source data structure, left empty
+ * \return \e bool indicating success
+ */
+bool interpMeld(void * const dst, void * const src);
+
 /** @}*/
 
 #ifdef __cplusplus
@@ -52,7 +52,9 @@ I*
 %token WHILE IF PRINT UPRINT FOR FREE EXIT
 %token CREATE FIND INSERT REMOVE CLEAR DESTROY DEPTH SIZE 
 %token MIN MAX FIRST LAST NEXT PREVIOUS UPPER LOWER CHECK WALK SORT 
-%token SHOW BALANCE POP PUSH PEEK COPY RAND TIME 
+%token SHOW BALANCE POP PUSH PEEK COPY RAND TIME BUILD
+%token WALKRANGE REMOVERANGE POLICY STATS BUDGET COST TTL MELD TOPK
+%token FINGER
 
 %nonassoc IFX
 %nonassoc ELSE
@@ -127,6 +129,7 @@ INTEGER                            { $$ = con($1); }
 | RAND '(' expr ')'                { $$ = opr(RAND, 1, $3); }
 | TIME '(' expr ')'                { $$ = opr(TIME, 1, $3); }
 | CREATE '(' ')'                   { $$ = opr(CREATE, 0); }
+| CREATE '(' expr ')'              { $$ = opr(CREATE, 1, $3); }
 | FIND '(' expr ',' expr ')'       { $$ = opr(FIND, 2, $3, $5); }
 | INSERT '(' expr ',' expr ')'     { $$ = opr(INSERT, 2, $3, $5); }
 | REMOVE '(' expr ',' expr ')'     { $$ = opr(REMOVE, 2, $3, $5); }
@@ -146,10 +149,23 @@ INTEGER                            { $$ = con($1); }
 | WALK '(' expr ',' expr ')'       { $$ = opr(WALK, 2, $3, $5); }
 | SORT '(' expr ')'                { $$ = opr(SORT, 1, $3); }
 | BALANCE '(' expr ')'             { $$ = opr(BALANCE, 1, $3); }
+| BUILD '(' expr ',' expr ')'      { $$ = opr(BUILD, 2, $3, $5); }
+| WALKRANGE '(' expr ',' expr ',' expr ',' expr ')'
+                                  { $$ = opr(WALKRANGE, 4, $3, $5, $7, $9); }
+| REMOVERANGE '(' expr ',' expr ',' expr ')'
+                                  { $$ = opr(REMOVERANGE, 3, $3, $5, $7); }
+| POLICY '(' expr ',' expr ')'     { $$ = opr(POLICY, 2, $3, $5); }
+| STATS '(' expr ')'               { $$ = opr(STATS, 1, $3); }
+| BUDGET '(' expr ',' expr ')'     { $$ = opr(BUDGET, 2, $3, $5); }
+| TTL '(' expr ',' expr ')'        { $$ = opr(TTL, 2, $3, $5); }
+| TOPK '(' expr ',' expr ')'       { $$ = opr(TOPK, 2, $3, $5); }
+| FINGER '(' expr ',' expr ')'     { $$ = opr(FINGER, 2, $3, $5); }
+| COST '(' expr ')'                { $$ = opr(COST, 1, $3); }
 | POP '(' expr ')'                 { $$ = opr(POP, 1, $3); }
 | PUSH '(' expr ',' expr ')'       { $$ = opr(PUSH, 2, $3, $5); }
 | PEEK '(' expr ')'                { $$ = opr(PEEK, 1, $3); }
 | COPY '(' expr ',' expr ')'       { $$ = opr(COPY, 2, $3, $5); }
+| MELD '(' expr ',' expr ')'       { $$ = opr(MELD, 2, $3, $5); }
 ;
 
 %%
@@ -0,0 +1,824 @@
+/**
+ * \file  pairingHeap.c
+ *
+ * A \e pairingHeap_t implementation.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "pairingHeap.h"
+#include "pairingHeap_private.h"
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Compare the entries of two pairing heap nodes.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param a pointer to a \e pairingHeapNode_t
+ * \param b pointer to a \e pairingHeapNode_t
+ * \return true if the entry of \e a is greater than the entry of \e b
+ */
+static bool
+pairingHeapCompareGreater(const pairingHeap_t * const pairingHeap,
+                          const pairingHeapNode_t * const a,
+                          const pairingHeapNode_t * const b)
+{
+  return (pairingHeap->compare(a->entry, b->entry, pairingHeap->user)
+          == compareGreater);
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Link the trees of two pairing heap nodes that have no parent or
+ * siblings. The node with the greater entry becomes the leftmost child of
+ * the other node. If the entries are equal then \e b becomes the child
+ * of \e a.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param a pointer to a \e pairingHeapNode_t
+ * \param b pointer to a \e pairingHeapNode_t
+ * \return pointer to the root node of the linked tree
+ */
+static pairingHeapNode_t *
+pairingHeapLink(const pairingHeap_t * const pairingHeap,
+                pairingHeapNode_t *a,
+                pairingHeapNode_t *b)
+{
+  if (pairingHeapCompareGreater(pairingHeap, a, b))
+    {
+      pairingHeapNode_t *tmp = a;
+      a = b;
+      b = tmp;
+    }
+
+  b->prev = a;
+  b->sibling = a->child;
+  if (a->child != NULL)
+    {
+      a->child->prev = b;
+    }
+  a->child = b;
+
+  return a;
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Cut the sub-tree of a node that is not the root from the pairing heap
+ * tree.
+ *
+ * \param node pointer to a \e pairingHeapNode_t
+ */
+static void
+pairingHeapCut(pairingHeapNode_t * const node)
+{
+  if (node->prev->child == node)
+    {
+      node->prev->child = node->sibling;
+    }
+  else
+    {
+      node->prev->sibling = node->sibling;
+    }
+  if (node->sibling != NULL)
+    {
+      node->sibling->prev = node->prev;
+    }
+  node->prev = NULL;
+  node->sibling = NULL;
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Combine a list of sibling trees into one tree with the two-pass pairing
+ * method. The first pass links pairs of trees from left to right. The
+ * second pass links each of the resulting trees, from right to left, with
+ * the tree accumulated so far.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param first pointer to the leftmost \e pairingHeapNode_t of the list
+ * \return pointer to the root node of the combined tree. \e NULL if the
+ * list is empty.
+ */
+static pairingHeapNode_t *
+pairingHeapCombine(const pairingHeap_t * const pairingHeap,
+                   pairingHeapNode_t *first)
+{
+  pairingHeapNode_t *pairs = NULL;
+  pairingHeapNode_t *root;
+
+  /* First pass. The linked pairs are pushed onto a list in reverse order */
+  while (first != NULL)
+    {
+      pairingHeapNode_t *a = first;
+      pairingHeapNode_t *b = a->sibling;
+
+      a->prev = NULL;
+      if (b != NULL)
+        {
+          first = b->sibling;
+          b->prev = NULL;
+          b->sibling = NULL;
+          a = pairingHeapLink(pairingHeap, a, b);
+        }
+      else
+        {
+          first = NULL;
+        }
+      a->sibling = pairs;
+      pairs = a;
+    }
+  if (pairs == NULL)
+    {
+      return NULL;
+    }
+
+  /* Second pass */
+  root = pairs;
+  pairs = pairs->sibling;
+  root->sibling = NULL;
+  while (pairs != NULL)
+    {
+      pairingHeapNode_t *next = pairs->sibling;
+
+      pairs->sibling = NULL;
+      root = pairingHeapLink(pairingHeap, root, pairs);
+      pairs = next;
+    }
+
+  return root;
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Find the next node in a pre-order traversal of the pairing heap tree
+ * without recursion. The \e prev member of the leftmost child of a node
+ * leads back to the parent.
+ *
+ * \param node pointer to a \e pairingHeapNode_t
+ * \param depth pointer to the depth of \e node, updated for the next node
+ * \return pointer to the next \e pairingHeapNode_t. \e NULL at the end
+ * of the traversal.
+ */
+static pairingHeapNode_t *
+pairingHeapNext(pairingHeapNode_t *node, size_t * const depth)
+{
+  if (node->child != NULL)
+    {
+      *depth = *depth+1;
+      return node->child;
+    }
+
+  while (node != NULL)
+    {
+      if (node->sibling != NULL)
+        {
+          return node->sibling;
+        }
+
+      /* Climb to the parent */
+      while ((node->prev != NULL) && (node->prev->child != node))
+        {
+          node = node->prev;
+        }
+      node = node->prev;
+      *depth = *depth-1;
+    }
+
+  return NULL;
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Allocate a node for an entry and link it with the root of the pairing
+ * heap.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param entry \e void pointer to caller's entry data
+ * \return pointer to the \e pairingHeapNode_t of the entry. \e NULL
+ * indicates failure.
+ */
+static pairingHeapNode_t *
+pairingHeapPushEntry(pairingHeap_t * const pairingHeap, void * const entry)
+{
+  pairingHeapNode_t *node;
+
+  node = pairingHeap->alloc(sizeof(pairingHeapNode_t), pairingHeap->user);
+  if (node == NULL)
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "Couldn't allocate %zd bytes for node!",
+                         sizeof(pairingHeapNode_t));
+      return NULL;
+    }
+
+  if (pairingHeap->duplicateEntry != NULL)
+    {
+      node->entry = pairingHeap->duplicateEntry(entry, pairingHeap->user);
+      if (node->entry == NULL)
+        {
+          pairingHeap->dealloc(node, pairingHeap->user);
+          pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                             "Couldn't duplicate entry!");
+          return NULL;
+        }
+    }
+  else
+    {
+      node->entry = entry;
+    }
+  node->child = NULL;
+  node->sibling = NULL;
+  node->prev = NULL;
+  node->handle = NULL;
+
+  if (pairingHeap->root == NULL)
+    {
+      pairingHeap->root = node;
+    }
+  else
+    {
+      pairingHeap->root = pairingHeapLink(pairingHeap, pairingHeap->root, node);
+    }
+  pairingHeap->size += 1;
+
+  return node;
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Detach the handle of a node, if it has one, as the entry leaves the
+ * pairing heap. The handle is deallocated when the caller releases it.
+ *
+ * \param node pointer to the \e pairingHeapNode_t
+ */
+static void
+pairingHeapDetachHandle(pairingHeapNode_t * const node)
+{
+  if (node->handle != NULL)
+    {
+      node->handle->node = NULL;
+      node->handle = NULL;
+    }
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Check that a handle belongs to an entry in the pairing heap.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param handle pointer to \e pairingHeapHandle_t
+ * \return \e bool indicating a valid handle
+ */
+static bool
+pairingHeapValidHandle(pairingHeap_t * const pairingHeap,
+                       const pairingHeapHandle_t * const handle)
+{
+  if ((handle == NULL) ||
+      (handle->node == NULL) ||
+      (handle->node->handle != handle))
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "invalid handle!");
+      return false;
+    }
+
+  return true;
+}
+
+/**
+ * Private helper function for pairing heap implementation.
+ *
+ * Take a node out of the pairing heap and deallocate it. The children of
+ * the node are combined and linked with the root. If the \e deleteEntry()
+ * callback has been defined then the caller's entry memory is deallocated.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param node pointer to the \e pairingHeapNode_t
+ * \return pointer to the entry data of the node. NULL if the entry memory
+ * has been deallocated.
+ */
+static void *
+pairingHeapDeleteNode(pairingHeap_t * const pairingHeap,
+                      pairingHeapNode_t * const node)
+{
+  pairingHeapNode_t *children;
+  void *entry;
+
+  if (node == pairingHeap->root)
+    {
+      pairingHeap->root = pairingHeapCombine(pairingHeap, node->child);
+    }
+  else
+    {
+      pairingHeapCut(node);
+      children = pairingHeapCombine(pairingHeap, node->child);
+      if (children != NULL)
+        {
+          pairingHeap->root =
+            pairingHeapLink(pairingHeap, pairingHeap->root, children);
+        }
+    }
+  pairingHeap->size -= 1;
+  pairingHeapDetachHandle(node);
+
+  entry = node->entry;
+  if (pairingHeap->deleteEntry != NULL)
+    {
+      (pairingHeap->deleteEntry)(entry, pairingHeap->user);
+      entry = NULL;
+    }
+  pairingHeap->dealloc(node, pairingHeap->user);
+
+  return entry;
+}
+
+pairingHeap_t *
+pairingHeapCreate(const pairingHeapAllocFunc_t alloc,
+                  const pairingHeapDeallocFunc_t dealloc,
+                  const pairingHeapDuplicateEntryFunc_t duplicateEntry,
+                  const pairingHeapDeleteEntryFunc_t deleteEntry,
+                  const pairingHeapDebugFunc_t debug,
+                  const pairingHeapCompFunc_t compare,
+                  void * const user)
+{
+  pairingHeap_t *pairingHeap = NULL;
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (compare == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid compare() function!");
+      return NULL;
+    }
+
+  /* Allocate pairing heap */
+  pairingHeap = (pairingHeap_t *)alloc(sizeof(pairingHeap_t), user);
+  if (pairingHeap == NULL)
+    {
+      debug(__func__, __LINE__, user,
+            "Couldn't allocate %zd bytes for pairingHeap!",
+            sizeof(pairingHeap_t));
+      return NULL;
+    }
+
+  /* Initalise new pairingHeap_t */
+  pairingHeap->alloc = alloc;
+  pairingHeap->dealloc = dealloc;
+  pairingHeap->duplicateEntry = duplicateEntry;
+  pairingHeap->deleteEntry = deleteEntry;
+  pairingHeap->debug = debug;
+  pairingHeap->compare = compare;
+  pairingHeap->root = NULL;
+  pairingHeap->size = 0;
+  pairingHeap->user = user;
+
+  return pairingHeap;
+}
+
+void *
+pairingHeapPush(pairingHeap_t * const pairingHeap, void * const entry)
+{
+  pairingHeapNode_t *node;
+
+  if (pairingHeap == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "invalid entry == NULL!");
+      return NULL;
+    }
+
+  node = pairingHeapPushEntry(pairingHeap, entry);
+  if (node == NULL)
+    {
+      return NULL;
+    }
+
+  return node->entry;
+}
+
+pairingHeapHandle_t *
+pairingHeapPushHandle(pairingHeap_t * const pairingHeap, void * const entry)
+{
+  pairingHeapHandle_t *handle;
+  pairingHeapNode_t *node;
+
+  if (pairingHeap == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "invalid entry == NULL!");
+      return NULL;
+    }
+
+  handle = pairingHeap->alloc(sizeof(pairingHeapHandle_t), pairingHeap->user);
+  if (handle == NULL)
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "Couldn't allocate %zd bytes for handle!",
+                         sizeof(pairingHeapHandle_t));
+      return NULL;
+    }
+  node = pairingHeapPushEntry(pairingHeap, entry);
+  if (node == NULL)
+    {
+      pairingHeap->dealloc(handle, pairingHeap->user);
+      return NULL;
+    }
+  node->handle = handle;
+  handle->node = node;
+
+  return handle;
+}
+
+void *
+pairingHeapGetEntry(pairingHeap_t * const pairingHeap,
+                    const pairingHeapHandle_t * const handle)
+{
+  if (pairingHeap == NULL)
+    {
+      return NULL;
+    }
+  if (pairingHeapValidHandle(pairingHeap, handle) == false)
+    {
+      return NULL;
+    }
+
+  return handle->node->entry;
+}
+
+bool
+pairingHeapDecreaseKey(pairingHeap_t * const pairingHeap,
+                       pairingHeapHandle_t * const handle)
+{
+  pairingHeapNode_t *node;
+
+  if (pairingHeap == NULL)
+    {
+      return false;
+    }
+  if (pairingHeapValidHandle(pairingHeap, handle) == false)
+    {
+      return false;
+    }
+  node = handle->node;
+  if (node == pairingHeap->root)
+    {
+      return true;
+    }
+
+  pairingHeapCut(node);
+  pairingHeap->root = pairingHeapLink(pairingHeap, pairingHeap->root, node);
+
+  return true;
+}
+
+void *
+pairingHeapRemove(pairingHeap_t * const pairingHeap,
+                  pairingHeapHandle_t * const handle)
+{
+  if (pairingHeap == NULL)
+    {
+      return NULL;
+    }
+  if (pairingHeapValidHandle(pairingHeap, handle) == false)
+    {
+      return NULL;
+    }
+
+  return pairingHeapDeleteNode(pairingHeap, handle->node);
+}
+
+bool
+pairingHeapReleaseHandle(pairingHeap_t * const pairingHeap,
+                         pairingHeapHandle_t * const handle)
+{
+  if ((pairingHeap == NULL) || (handle == NULL))
+    {
+      return false;
+    }
+
+  /* The entry of an attached handle stays in the heap without it */
+  if (handle->node != NULL)
+    {
+      if (pairingHeapValidHandle(pairingHeap, handle) == false)
+        {
+          return false;
+        }
+      handle->node->handle = NULL;
+    }
+  pairingHeap->dealloc(handle, pairingHeap->user);
+
+  return true;
+}
+
+bool
+pairingHeapMeld(pairingHeap_t * const pairingHeap,
+                pairingHeap_t * const other)
+{
+  if (pairingHeap == NULL)
+    {
+      return false;
+    }
+  if ((other == NULL) || (other == pairingHeap))
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "invalid pairing heap to meld!");
+      return false;
+    }
+  if ((other->alloc != pairingHeap->alloc) ||
+      (other->dealloc != pairingHeap->dealloc) ||
+      (other->duplicateEntry != pairingHeap->duplicateEntry) ||
+      (other->deleteEntry != pairingHeap->deleteEntry) ||
+      (other->compare != pairingHeap->compare) ||
+      (other->user != pairingHeap->user))
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "pairing heaps to meld have different callbacks!");
+      return false;
+    }
+  if (other->root == NULL)
+    {
+      return true;
+    }
+
+  if (pairingHeap->root == NULL)
+    {
+      pairingHeap->root = other->root;
+    }
+  else
+    {
+      pairingHeap->root =
+        pairingHeapLink(pairingHeap, pairingHeap->root, other->root);
+    }
+  pairingHeap->size += other->size;
+  other->root = NULL;
+  other->size = 0;
+
+  return true;
+}
+
+void *
+pairingHeapPeek(pairingHeap_t * const pairingHeap)
+{
+  if (pairingHeap == NULL)
+    {
+      return NULL;
+    }
+  if (pairingHeap->root == NULL)
+    {
+      return NULL;
+    }
+
+  return pairingHeap->root->entry;
+}
+
+void *
+pairingHeapPop(pairingHeap_t * const pairingHeap)
+{
+  if (pairingHeap == NULL)
+    {
+      return NULL;
+    }
+  if (pairingHeap->root == NULL)
+    {
+      return NULL;
+    }
+
+  return pairingHeapDeleteNode(pairingHeap, pairingHeap->root);
+}
+
+void
+pairingHeapClear(pairingHeap_t * const pairingHeap)
+{
+  pairingHeapNode_t *node;
+
+  if (pairingHeap == NULL)
+    {
+      return;
+    }
+
+  /* Splice the children of each node into the list of nodes to delete */
+  node = pairingHeap->root;
+  while (node != NULL)
+    {
+      pairingHeapNode_t *next;
+
+      if (node->child != NULL)
+        {
+          pairingHeapNode_t *last = node->child;
+
+          while (last->sibling != NULL)
+            {
+              last = last->sibling;
+            }
+          last->sibling = node->sibling;
+          node->sibling = node->child;
+        }
+
+      next = node->sibling;
+      pairingHeapDetachHandle(node);
+      if (pairingHeap->deleteEntry != NULL)
+        {
+          pairingHeap->deleteEntry(node->entry, pairingHeap->user);
+        }
+      pairingHeap->dealloc(node, pairingHeap->user);
+      node = next;
+    }
+
+  pairingHeap->root = NULL;
+  pairingHeap->size = 0;
+
+  return;
+}
+
+void
+pairingHeapDestroy(pairingHeap_t * const pairingHeap)
+{
+  pairingHeapNode_t *node;
+  size_t depth = 1;
+
+  if (pairingHeap == NULL)
+    {
+      return;
+    }
+
+  /* Deallocate the handles of the entries in the heap */
+  node = pairingHeap->root;
+  while (node != NULL)
+    {
+      if (node->handle != NULL)
+        {
+          pairingHeap->dealloc(node->handle, pairingHeap->user);
+          node->handle = NULL;
+        }
+      node = pairingHeapNext(node, &depth);
+    }
+
+  /* Get rid of all entries */
+  pairingHeapClear(pairingHeap);
+
+  /* Free the pairingHeap_t */
+  (pairingHeap->dealloc)(pairingHeap, pairingHeap->user);
+}
+
+size_t
+pairingHeapGetSize(const pairingHeap_t * const pairingHeap)
+{
+  if (pairingHeap == NULL)
+    {
+      return 0;
+    }
+
+  return pairingHeap->size;
+}
+
+size_t
+pairingHeapGetDepth(const pairingHeap_t * const pairingHeap)
+{
+  pairingHeapNode_t *node;
+  size_t thisDepth = 1;
+  size_t maxDepth = 0;
+
+  if (pairingHeap == NULL)
+    {
+      return 0;
+    }
+
+  node = pairingHeap->root;
+  while (node != NULL)
+    {
+      if (thisDepth > maxDepth)
+        {
+          maxDepth = thisDepth;
+        }
+      node = pairingHeapNext(node, &thisDepth);
+    }
+
+  return maxDepth;
+}
+
+bool
+pairingHeapWalk(pairingHeap_t * const pairingHeap,
+                const pairingHeapWalkFunc_t walk)
+{
+  pairingHeapNode_t *node;
+  size_t depth = 1;
+
+  if (pairingHeap == NULL)
+    {
+      return false;
+    }
+  if (walk == NULL)
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "invalid walk() function!");
+      return false;
+    }
+
+  node = pairingHeap->root;
+  while (node != NULL)
+    {
+      if (walk(node->entry, pairingHeap->user) != true)
+        {
+          pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                             "Walk function failed!");
+          return false;
+        }
+      node = pairingHeapNext(node, &depth);
+    }
+
+  return true;
+}
+
+bool
+pairingHeapCheck(pairingHeap_t * const pairingHeap)
+{
+  pairingHeapNode_t *node;
+  size_t depth = 1;
+  size_t count = 0;
+
+  if (pairingHeap == NULL)
+    {
+      return false;
+    }
+  if ((pairingHeap->root != NULL) &&
+      ((pairingHeap->root->prev != NULL) ||
+       (pairingHeap->root->sibling != NULL)))
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "Root has a parent or sibling!");
+      return false;
+    }
+
+  node = pairingHeap->root;
+  while (node != NULL)
+    {
+      pairingHeapNode_t *child;
+
+      if ((node->handle != NULL) && (node->handle->node != node))
+        {
+          pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                             "Invalid handle at depth %zd!", depth);
+          return false;
+        }
+      for (child = node->child; child != NULL; child = child->sibling)
+        {
+          if (((child == node->child) && (child->prev != node)) ||
+              ((child != node->child) && (child->prev->sibling != child)))
+            {
+              pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                                 "Invalid link at depth %zd!", depth+1);
+              return false;
+            }
+          if (pairingHeapCompareGreater(pairingHeap, node, child))
+            {
+              pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                                 "Compare failed at depth %zd!", depth+1);
+              return false;
+            }
+        }
+      count = count+1;
+      node = pairingHeapNext(node, &depth);
+    }
+
+  if (count != pairingHeap->size)
+    {
+      pairingHeap->debug(__func__, __LINE__, pairingHeap->user,
+                         "Found %zd entries, expected %zd!",
+                         count, pairingHeap->size);
+      return false;
+    }
+
+  return true;
+}
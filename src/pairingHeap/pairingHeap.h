@@ -0,0 +1,356 @@
+/** 
+ * \file pairingHeap.h 
+ *
+ * Public interface for a pairing heap type. A pairing heap is a heap-ordered
+ * multi-way tree. Two pairing heaps are melded in constant time by linking
+ * their roots and the key of an entry is decreased in constant time by
+ * cutting its sub-tree and linking it with the root. The work of restoring
+ * the tree is deferred to \e pairingHeapPop(). See: "The Pairing Heap: A
+ * New Form of Self-Adjusting Heap", M. L. Fredman, R. Sedgewick,
+ * D. D. Sleator and R. E. Tarjan, Algorithmica, 1986, Vol. 1, pp. 111-129.
+ */
+
+#if !defined(PAIRING_HEAP_H)
+#define PAIRING_HEAP_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdarg>
+#include <cstdbool>
+using std::size_t;
+extern "C" {
+#else
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#endif
+
+#include "compare.h"
+
+/**
+ * \e pairingHeap_t structure. An opaque type for a pairing heap.
+ */
+typedef struct pairingHeap_t pairingHeap_t;
+
+/**
+ * \e pairingHeapHandle_t structure. An opaque type for the handle of an
+ * entry in a pairing heap.
+ */
+typedef struct pairingHeapHandle_t pairingHeapHandle_t;
+
+/**
+ * \e pairingHeap_t memory allocator.
+ *
+ * Memory allocation call-back.
+ *
+ * \param amount of memory requested
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to the memory allocated. \e NULL indicates failure.
+ */
+typedef void *(*pairingHeapAllocFunc_t)(const size_t amount, void * const user);
+
+/**
+ * \e pairingHeap_t memory de-allocator.
+ *
+ * Memory deallocation call-back.
+ *
+ * \param pointer to memory to be deallocated
+ * \param user \e void pointer to user data to be echoed by callbacks
+ */
+typedef void (*pairingHeapDeallocFunc_t)(void * const pointer,
+                                         void * const user);
+
+/**
+ * \e pairingHeap_t entry data memory duplicator callback function.
+ *
+ * Pairing heap entry duplicator call-back for caller's entry data.
+ *
+ * \param entry pointer to memory to be duplicated
+ * \param user \e void pointer to user data to be echoed by callbacks
+ */
+typedef void * (*pairingHeapDuplicateEntryFunc_t)(void * const entry, 
+                                                  void * const user);
+
+/**
+ * \e pairingHeap_t entry data memory de-allocator.
+ *
+ * Memory deallocation call-back for caller's entry data.
+ *
+ * \param entry pointer to caller's memory to be deallocated
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return \e bool for compatibility with \e walk.
+ */
+typedef bool (*pairingHeapDeleteEntryFunc_t)(void * const entry, 
+                                             void * const user);
+
+/**
+ * Debugging message.
+ *
+ * Callback function to output a debugging message. Accepts a 
+ * variable argument list. 
+ *
+ * \param function name
+ * \param line number
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \param format string
+ * \param ... variable argument list
+ */
+typedef void (*pairingHeapDebugFunc_t)(const char *function,  
+                                       const unsigned int line,
+                                       void * const user,
+                                       const char *format, ...);
+
+/**
+ * Compare two entries.
+ * 
+ * Callback function to compare two entries in the pairing heap. The entry
+ * type is defined by the caller.
+ *
+ * \param a pointer to an entry defined by the caller
+ * \param b pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return \e compare_e value
+ */
+typedef compare_e (*pairingHeapCompFunc_t)(const void * const a, 
+                                           const void * const b, 
+                                           void * const user);
+
+/**
+ * Operate on entry.
+ * 
+ * Callback function run on an entry by \e pairingHeapWalk().
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return \e bool indicating success.
+ */
+typedef bool (*pairingHeapWalkFunc_t)(void * const entry, void * const user);
+
+/**
+ * Create an empty pairing heap.
+ * 
+ * Creates and initialises an empty \e pairingHeap_t instance
+ *
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for caller's entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e pairingHeap_t. \e NULL indicates failure.
+ */
+pairingHeap_t *pairingHeapCreate
+(const pairingHeapAllocFunc_t alloc, 
+ const pairingHeapDeallocFunc_t dealloc, 
+ const pairingHeapDuplicateEntryFunc_t duplicateEntry, 
+ const pairingHeapDeleteEntryFunc_t deleteEntry, 
+ const pairingHeapDebugFunc_t debug,
+ const pairingHeapCompFunc_t comp,
+ void * const user);
+
+/**
+ * Push an entry onto the pairing heap.
+ *
+ * Allocates an entry and links it with the root of the pairing heap in
+ * constant time. The address of the entry data inserted is returned. 
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param entry \e void pointer to caller's entry data 
+ * \return \e void pointer to the entry data installed. \e NULL indicates
+ * failure.
+ */
+void *pairingHeapPush(pairingHeap_t * const pairingHeap, 
+                      void * const entry);
+
+/**
+ * Push an entry onto the pairing heap and return a handle for it.
+ *
+ * Pushes an entry onto the pairing heap like \e pairingHeapPush(). The
+ * handle refers to the entry while the entry is in the heap, including
+ * after the heap is melded into another heap. When the entry is popped,
+ * removed or cleared from the heap the handle is detached and the handle
+ * functions report it as invalid. The caller deallocates a handle with
+ * \e pairingHeapReleaseHandle(), so a stale handle is never confused with
+ * the handle of a newer entry. \e pairingHeapDestroy() deallocates the
+ * handles of the entries still in the heap.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param entry \e void pointer to caller's entry data 
+ * \return pointer to the \e pairingHeapHandle_t of the entry. \e NULL
+ * indicates failure.
+ */
+pairingHeapHandle_t *pairingHeapPushHandle(pairingHeap_t * const pairingHeap,
+                                           void * const entry);
+
+/**
+ * Get the entry of a handle.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param handle \e pairingHeapHandle_t pointer 
+ * \return pointer to the entry data in the pairing heap. \e NULL
+ * indicates an invalid handle.
+ */
+void *pairingHeapGetEntry(pairingHeap_t * const pairingHeap, 
+                          const pairingHeapHandle_t * const handle);
+
+/**
+ * Restore the position of an entry after its key has been decreased.
+ *
+ * The caller decreases the key of the entry data of a handle in place and
+ * then calls \e pairingHeapDecreaseKey() to cut the sub-tree of the entry
+ * and link it with the root in constant time. The key must not have been
+ * increased. To increase a key, remove the entry with
+ * \e pairingHeapRemove() and push it again.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param handle \e pairingHeapHandle_t pointer of an entry in the heap
+ * \return \e bool indicating success
+ */
+bool pairingHeapDecreaseKey(pairingHeap_t * const pairingHeap, 
+                            pairingHeapHandle_t * const handle);
+
+/**
+ * Remove the entry of a handle from the pairing heap.
+ *
+ * Removes an entry from anywhere in the pairing heap and detaches its
+ * handle. If the \e deleteEntry() callback has been defined then that
+ * function will be called to deallocate the caller's entry memory and
+ * NULL will be returned. Takes amortised time proportional to the
+ * logarithm of the size of the heap.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param handle \e pairingHeapHandle_t pointer of an entry in the heap
+ * \return pointer to removed entry data. NULL if the entry memory has been
+ * deallocated or if the handle is invalid.
+ */
+void *pairingHeapRemove(pairingHeap_t * const pairingHeap, 
+                        pairingHeapHandle_t * const handle);
+
+/**
+ * Release a handle.
+ *
+ * Deallocates a handle returned by \e pairingHeapPushHandle(). If the
+ * entry of the handle is still in the pairing heap then the entry stays
+ * in the heap without a handle.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param handle \e pairingHeapHandle_t pointer 
+ * \return \e bool indicating success
+ */
+bool pairingHeapReleaseHandle(pairingHeap_t * const pairingHeap, 
+                              pairingHeapHandle_t * const handle);
+
+/**
+ * Meld two pairing heaps.
+ *
+ * Moves all the entries of \e other into \e pairingHeap in constant time
+ * by linking the roots of the two heaps. The entries are not duplicated
+ * again and their handles remain valid as handles of \e pairingHeap.
+ * \e other is left empty but is not destroyed. The two heaps must have the
+ * same memory, entry and comparison callbacks and the same user data.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \param other \e pairingHeap_t pointer of the heap to be emptied
+ * \return \e bool indicating success
+ */
+bool pairingHeapMeld(pairingHeap_t * const pairingHeap, 
+                     pairingHeap_t * const other);
+
+/**
+ * Copy the root entry in the pairing heap.
+ *
+ * Copies the root entry in the pairing heap.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer 
+ * \return pointer to \e entry. \e NULL indicates the heap is empty.
+ */
+void *pairingHeapPeek(pairingHeap_t * const pairingHeap);
+
+/**
+ * Pop an entry from the pairing heap.
+ *
+ * Removes the root entry from the pairing heap and then combines the
+ * sub-trees of the root with the two-pass pairing method. If the
+ * \e deleteEntry() callback has been defined then that function will be
+ * called to deallocate the caller's entry memory and NULL will be returned.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer
+ * \return pointer to popped entry data. NULL if the entry memory has been
+ * deallocated.
+ */
+void *pairingHeapPop(pairingHeap_t * const pairingHeap);
+
+/**
+ * Clear the pairingHeap.
+ *
+ * Clears all entries from the pairing heap. The memory used by entry is 
+ * assumed to have been allocated by the caller. If the \e deleteEntry()
+ * callback has been defined then that function will be called to 
+ * deallocate the caller's entry memory when the entries are removed.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer
+ */
+void pairingHeapClear(pairingHeap_t * const pairingHeap);
+
+/** 
+ * Destroy the pairing heap.
+ *
+ * Removes and deallocates all entries from the pairing heap. If the pairing
+ * heap \e deleteEntry() member exists then deallocates the caller's entry
+ * data.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer
+ */
+void pairingHeapDestroy(pairingHeap_t * const pairingHeap);
+
+/**
+ * Get the number of entries in the pairing heap.
+ *
+ * Returns the number of entries in the pairing heap.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer
+ * \return Number of entries in the pairing heap
+ */
+size_t pairingHeapGetSize(const pairingHeap_t * const pairingHeap);
+
+/**
+ * Get the depth of the pairing heap.
+ *
+ * Returns the number of levels of the tree of the pairing heap.
+ *
+ * \param pairingHeap \e pairingHeap_t pointer
+ * \return Depth of the pairing heap
+ */
+size_t pairingHeapGetDepth(const pairingHeap_t * const pairingHeap);
+
+/** 
+ * Operate on each pairing heap entry.
+ *
+ * Traverses the pairing heap in pre-order, from the root, calling a
+ * function for each entry.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \param walk pointer to a callback function to be called for each entry
+ * \return \e bool indicating success
+ */
+bool pairingHeapWalk(pairingHeap_t * const pairingHeap, 
+                     const pairingHeapWalkFunc_t walk);
+
+/** 
+ * Check the pairing heap.
+ *
+ * Traverses the pairing heap checking that the links of the tree and the
+ * number of entries are consistent and that no entry is less than its
+ * parent.
+ *
+ * \param pairingHeap pointer to \e pairingHeap_t
+ * \return \e bool indicating success. 
+ */
+bool pairingHeapCheck(pairingHeap_t * const pairingHeap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,15 @@
+# Programs in this directory
+pairingHeap_PROGRAMS:=pairingHeap_interp pairingHeapHandle_test
+PROGRAMS+=$(pairingHeap_PROGRAMS)
+
+VPATH += src/pairingHeap
+
+pairingHeap_interp_C_SOURCES := pairingHeap.c pairingHeap_wrapper.c
+
+pairingHeap_interp_STATIC_LIBRARIES := interp.a
+
+$(call add_extra_CFLAGS_macro,$(pairingHeap_interp_C_SOURCES),-Isrc/interp)
+
+pairingHeapHandle_test_C_SOURCES := pairingHeapHandle_test.c pairingHeap.c
+
+$(call add_extra_CFLAGS_macro,$(pairingHeapHandle_test_C_SOURCES),-Isrc/interp)
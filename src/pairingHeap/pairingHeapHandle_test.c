@@ -0,0 +1,234 @@
+/*
+ * pairingHeapHandle_test.c
+ *
+ * Decrease the keys of and remove pairing heap entries through their
+ * handles, meld heaps with handles, use handles after their entries have
+ * left the heap and push new entries while stale handles are held and
+ * after they are released.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "pairingHeap.h"
+
+#define ENTRIES 8
+
+static long keys[ENTRIES];
+static pairingHeapHandle_t *handles[ENTRIES];
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  printf("%s: ", function);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+pairingHeap_t *
+Create(void)
+{
+  pairingHeap_t *heap;
+
+  heap = pairingHeapCreate(Alloc, Dealloc, NULL, NULL, Debug, Compare, NULL);
+  if (heap == NULL)
+    {
+      fprintf(stderr, "pairingHeapCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  return heap;
+}
+
+static
+void
+Push(pairingHeap_t * const heap, const size_t h, const long key)
+{
+  keys[h] = key;
+  handles[h] = pairingHeapPushHandle(heap, &keys[h]);
+  if (handles[h] == NULL)
+    {
+      printf("push %zu:%ld: rejected\n", h, key);
+    }
+}
+
+static
+void
+Entry(pairingHeap_t * const heap, const size_t h)
+{
+  long *entry = pairingHeapGetEntry(heap, handles[h]);
+
+  if (entry == NULL)
+    {
+      printf("handle %zu: NULL\n", h);
+    }
+  else
+    {
+      printf("handle %zu: %ld\n", h, *entry);
+    }
+}
+
+static
+void
+Pop(pairingHeap_t * const heap)
+{
+  long *entry;
+
+  printf("check %s pop", pairingHeapCheck(heap) ? "true" : "false");
+  while ((entry = pairingHeapPop(heap)) != NULL)
+    {
+      printf(" %ld", *entry);
+    }
+  printf("\n");
+}
+
+static
+void
+Release(pairingHeap_t * const heap, const size_t lo, const size_t hi)
+{
+  size_t h;
+
+  for (h=lo; h<=hi; h++)
+    {
+      if ((handles[h] != NULL) &&
+          (pairingHeapReleaseHandle(heap, handles[h]) == false))
+        {
+          printf("release %zu failed\n", h);
+        }
+      handles[h] = NULL;
+    }
+}
+
+int main(void)
+{
+  pairingHeap_t *heap;
+  pairingHeap_t *other;
+  long extra = 45;
+  size_t h;
+
+  heap = Create();
+  for (h=0; h<5; h++)
+    {
+      Push(heap, h, (long)(((h*3)%5)+1)*10);
+    }
+  (void)pairingHeapPush(heap, &extra);
+  for (h=0; h<5; h++)
+    {
+      Entry(heap, h);
+    }
+
+  /* Move an inner entry to the root */
+  keys[4] = 5;
+  printf("decrease 4: %s\n",
+         pairingHeapDecreaseKey(heap, handles[4]) ? "ok" : "failed");
+  printf("peek: %ld\n", *(long *)pairingHeapPeek(heap));
+
+  /* Remove the root and an inner entry through handles */
+  printf("remove 4: %ld\n", *(long *)pairingHeapRemove(heap, handles[4]));
+  printf("remove 2: %ld\n", *(long *)pairingHeapRemove(heap, handles[2]));
+  printf("size: %zu check %s\n", pairingHeapGetSize(heap),
+         pairingHeapCheck(heap) ? "true" : "false");
+
+  /* Stale handles of removed and popped entries */
+  printf("pop: %ld\n", *(long *)pairingHeapPop(heap));
+  Entry(heap, 0);
+  Entry(heap, 3);
+  printf("decrease 2: %s\n",
+         pairingHeapDecreaseKey(heap, handles[2]) ? "ok" : "failed");
+  printf("remove 4: %s\n",
+         (pairingHeapRemove(heap, handles[4]) == NULL) ? "NULL" : "entry");
+  Entry(heap, 1);
+
+  /* New entries while the stale handles are held */
+  Push(heap, 5, 15);
+  Push(heap, 6, 25);
+  Entry(heap, 0);
+  Entry(heap, 5);
+  Entry(heap, 6);
+
+  /* Handles stay attached when their heap is melded into another */
+  other = Create();
+  Push(other, 7, 35);
+  printf("meld: %s\n", pairingHeapMeld(heap, other) ? "ok" : "failed");
+  keys[7] = 1;
+  printf("decrease 7: %s\n",
+         pairingHeapDecreaseKey(heap, handles[7]) ? "ok" : "failed");
+  printf("peek: %ld\n", *(long *)pairingHeapPeek(heap));
+  pairingHeapDestroy(other);
+
+  /* Reuse the memory of released handles */
+  Release(heap, 0, 4);
+  Push(heap, 0, 55);
+  Push(heap, 2, 65);
+  Push(heap, 4, 75);
+  Entry(heap, 0);
+  Entry(heap, 2);
+  Entry(heap, 4);
+
+  /* Release handles of entries that stay in the heap */
+  Release(heap, 5, 7);
+  printf("size: %zu\n", pairingHeapGetSize(heap));
+  Pop(heap);
+  Entry(heap, 0);
+  Entry(heap, 2);
+  Release(heap, 0, 4);
+
+  /* Handles cleared from the heap */
+  Push(heap, 0, 10);
+  Push(heap, 1, 20);
+  pairingHeapClear(heap);
+  Entry(heap, 0);
+  Entry(heap, 1);
+  Release(heap, 0, 1);
+
+  /* The handles of entries left in the heap are deallocated with it */
+  Push(heap, 0, 10);
+  Push(heap, 1, 20);
+  pairingHeapDestroy(heap);
+
+  return EXIT_SUCCESS;
+}
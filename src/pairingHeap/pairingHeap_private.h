@@ -0,0 +1,104 @@
+/** 
+ * \file pairingHeap_private.h 
+ *
+ * Private definition for a pairing heap type. 
+ */
+
+#if !defined(PAIRING_HEAP_PRIVATE_H)
+#define PAIRING_HEAP_PRIVATE_H
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstdbool>
+#include <cstddef>
+using std::size_t;
+extern "C" {
+#else
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#endif
+
+#include "compare.h"
+#include "pairingHeap.h"
+
+/**
+ * \e pairingHeapNode_t structure.
+ *
+ * A node of the pairing heap tree. The children of a node are a list
+ * linked by \e sibling from the leftmost child.
+ */
+typedef struct pairingHeapNode_t
+{
+  void *entry;
+  /**< Pointer to the caller's entry data. */
+
+  struct pairingHeapNode_t *child;
+  /**< Leftmost child of the node. */
+
+  struct pairingHeapNode_t *sibling;
+  /**< Next sibling to the right of the node. */
+
+  struct pairingHeapNode_t *prev;
+  /**< Previous sibling to the left of the node or, for the leftmost
+     child, the parent of the node. \c NULL for the root. */
+
+  pairingHeapHandle_t *handle;
+  /**< Handle of the entry. \c NULL if the entry has no handle. */
+}
+pairingHeapNode_t;
+
+/**
+ * \e pairingHeapHandle_t structure.
+ *
+ * The handle of an entry in the pairing heap. The handle is allocated
+ * separately from the node of the entry so that it can outlive the node.
+ */
+struct pairingHeapHandle_t
+{
+  pairingHeapNode_t *node;
+  /**< Node of the entry. \c NULL once the entry has left the heap and
+     the handle is detached. */
+};
+
+/**
+ * \e pairingHeap_t structure.
+ *
+ *  A pairing heap type.
+ */
+struct pairingHeap_t
+{
+  pairingHeapAllocFunc_t alloc; 
+  /**< Memory allocator callback function for \e pairingHeap_t. */
+
+  pairingHeapDeallocFunc_t dealloc;
+  /**< Memory de-allocator callback function for \e pairingHeap_t. */
+
+  pairingHeapDuplicateEntryFunc_t duplicateEntry;
+  /**< Entry duplication callback function for the caller's entry data. */
+
+  pairingHeapDeleteEntryFunc_t deleteEntry;
+  /**< Memory de-allocator callback function for the caller's entry data. */
+
+  pairingHeapDebugFunc_t debug;
+  /**< Debugging message callback function. */
+
+  pairingHeapCompFunc_t compare;
+  /**< Callback function to compare two entries in the pairing heap.  */
+
+  pairingHeapNode_t *root;
+  /**< Root node of the pairing heap. \c NULL if the heap is empty. */
+
+  size_t size;
+  /**< Number of entries in the pairing heap. */
+
+  void *user;
+  /**< Placeholder for user data in callbacks. */
+};
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
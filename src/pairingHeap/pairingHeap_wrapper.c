@@ -0,0 +1,310 @@
+/*
+ * pairingHeap_wrapper.c
+ *
+ * Wrapper functions for simple interpreter interface.
+ */
+
+#include <stdlib.h>
+#include <stdarg.h>
+
+#include "interp_utility.h"
+#include "interp_callbacks.h"
+#include "interp_wrapper.h"
+#include "pairingHeap.h"
+
+void *
+interpCreate(void)
+{
+  return pairingHeapCreate(interpAlloc, 
+                           interpDealloc,
+                           interpDuplicateEntry,
+                           interpDeleteEntry,
+                           interpDebug, 
+                           interpComp, 
+                           NULL);
+}
+
+void *
+interpCreateWithSize(const size_t size)
+{
+  (void)size;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpFind(void * const pairingHeap, void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpInsert(void * const pairingHeap, void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpRemove(void * const pairingHeap, void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void 
+interpClear(void * const pairingHeap)
+{
+  pairingHeapClear(pairingHeap);
+}
+
+void 
+interpDestroy(void * const pairingHeap)
+{
+  pairingHeapDestroy(pairingHeap);
+}
+
+size_t
+interpGetDepth(const void * const pairingHeap)
+{
+  return pairingHeapGetDepth(pairingHeap);
+}
+
+size_t
+interpGetSize(const void * const pairingHeap)
+{
+  return pairingHeapGetSize(pairingHeap);
+}
+
+void *
+interpGetMin(void * const pairingHeap)
+{
+  (void)pairingHeap;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetMax(void * const pairingHeap)
+{
+  (void)pairingHeap;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetFirst(void * const pairingHeap)
+{
+  (void)pairingHeap;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetLast(void * const pairingHeap)
+{
+  (void)pairingHeap;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetNext(void * const pairingHeap, const void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetPrevious(void * const pairingHeap, const void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetUpper(void * const pairingHeap, const void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+void *
+interpGetLower(void * const pairingHeap, const void * const entry)
+{
+  (void)pairingHeap;
+  (void)entry;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+bool
+interpCheck(void * const pairingHeap)
+{
+  return pairingHeapCheck(pairingHeap);
+}
+
+bool
+interpWalk(void * const pairingHeap, const interpWalkFunc_t walk)
+{
+  return pairingHeapWalk(pairingHeap, walk);
+}
+
+bool
+interpSort(void * const pairingHeap)
+{
+  (void)pairingHeap;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpBalance(void * const pairingHeap)
+{
+  (void)pairingHeap;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+void
+interpPop(void * const pairingHeap)
+{
+  pairingHeapPop(pairingHeap);
+  return;
+}
+
+void *
+interpPush(void * const pairingHeap, void * const entry)
+{
+  return pairingHeapPush(pairingHeap, entry);
+}
+
+void *
+interpPeek(void * const pairingHeap)
+{
+  return pairingHeapPeek(pairingHeap);
+}
+
+void *
+interpCopy(void * const dst, void * const src)
+{
+  (void)dst;
+  (void)src;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return NULL;
+}
+
+bool
+interpBuild(void * const tree, const size_t n)
+{
+  (void)tree;
+  (void)n;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpWalkRange(void * const tree,
+                const void * const lo,
+                const void * const hi,
+                const interpWalkFunc_t walk)
+{
+  (void)tree;
+  (void)lo;
+  (void)hi;
+  (void)walk;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+size_t
+interpRemoveRange(void * const tree,
+                  const void * const lo,
+                  const void * const hi)
+{
+  (void)tree;
+  (void)lo;
+  (void)hi;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return 0;
+}
+
+bool
+interpSetPolicy(void * const tree, const size_t policy)
+{
+  (void)tree;
+  (void)policy;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpShowStats(void * const tree)
+{
+  (void)tree;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetBudget(void * const tree, const size_t budget)
+{
+  (void)tree;
+  (void)budget;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+size_t
+interpGetCost(void * const tree)
+{
+  (void)tree;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return 0;
+}
+
+bool
+interpSetTTL(void * const tree, const size_t ttl)
+{
+  (void)tree;
+  (void)ttl;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpMeld(void * const dst, void * const src)
+{
+  return pairingHeapMeld(dst, src);
+}
+
+bool
+interpSetTopK(void * const tree, const size_t k)
+{
+  (void)tree;
+  (void)k;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetFinger(void * const tree, const bool finger)
+{
+  (void)tree;
+  (void)finger;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
@@ -89,8 +89,11 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <threads.h>
 
 #include "redblackTree.h"
+#include "cacheCore.h"
 #include "redblackCache.h"
 #include "redblackCache_private.h"
 
@@ -170,96 +173,223 @@ redblackCacheCompFunc(const void * const a,
                       const void * const b,
                       void * const user)
 {
-  const redblackCacheEntry_t * const A=a;
-  const redblackCacheEntry_t * const B=b;
+  const cacheCoreEntry_t * const A=a;
+  const cacheCoreEntry_t * const B=b;
   redblackCache_t * const cache = user;
 
   return (cache->compare)(A->entry, B->entry, cache->user);
 }
 
 /**
- * Private helper function for red-black tree cache implementation.
+ * Private helper function for red-black cache implementation.
  *
- * Move the cache entry (should be the last in the list) to the head 
- * of the linked list. 
+ * Add a cache entry to the red-black tree.
  *
- * \param cache pointer to \c redblackCache_t
- * \param cacheEntry pointer to \c redblackTreeEntry_t node to be moved
- * \return pointer to \c redblackCache_t. \c NULL indicates failure
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ * \param owner pointer to an instance of \e redblackCache_t
+ * \return \c bool indicating success
  */
 static
-redblackCache_t *
-redblackCacheMoveToHead(redblackCache_t * const cache, 
-                        redblackCacheEntry_t *cacheEntry)
+bool
+redblackCacheLink(cacheCoreEntry_t * const cacheEntry, void * const owner)
 {
-  if (cache == NULL)
-    {
-      return NULL;
-    }
-  if ((cacheEntry->next == NULL) || (cacheEntry->prev == NULL))
-    {
-      return NULL;
-    }
+  redblackCache_t * const cache = owner;
 
-  /* Unlink cacheEntry */
-  (cacheEntry->prev)->next = cacheEntry->next;
-  (cacheEntry->next)->prev = cacheEntry->prev;
+  return (redblackTreeInsert(cache->tree, cacheEntry) != NULL);
+}
 
-  /* Update cacheEntry */
-  cacheEntry->next = (cache->head).next;
-  cacheEntry->prev = &(cache->head);
+/**
+ * Private helper function for red-black cache implementation.
+ *
+ * Remove a cache entry from the red-black tree.
+ *
+ * \param cacheEntry pointer to the \c cacheCoreEntry_t
+ * \param owner pointer to an instance of \e redblackCache_t
+ */
+static
+void
+redblackCacheUnlink(cacheCoreEntry_t * const cacheEntry, void * const owner)
+{
+  redblackCache_t * const cache = owner;
 
-  /* Link cacheEntry */
-  (cacheEntry->next)->prev = (cache->head).next = cacheEntry;
+  redblackTreeRemove(cache->tree, cacheEntry);
+}
 
-  return cache;
+/**
+ * Private helper function for red-black cache implementation.
+ *
+ * Find the cache entry for the caller's data in the red-black tree.
+ *
+ * \param entry pointer to caller's data
+ * \param owner pointer to an instance of \e redblackCache_t
+ * \return pointer to the \c cacheCoreEntry_t. \c NULL if not found.
+ */
+static
+cacheCoreEntry_t *
+redblackCacheLookup(void * const entry, void * const owner)
+{
+  redblackCache_t * const cache = owner;
+  cacheCoreEntry_t dummyCacheEntry;
+
+  dummyCacheEntry.entry = entry;
+  return redblackTreeFind(cache->tree, &dummyCacheEntry);
 }
 
 /**
  * Private helper function for red-black cache implementation.
  *
- *  Duplicate an entry.
+ * Check an unsharded cache or a single shard.
  *
  * \param cache pointer to an instance of \e redblackCache_t
- * \param entry pointer to caller's data 
- * \return pointer to duplicated entry
+ * \return \c bool indicating success
  */
 static
-void *
-redblackCacheDuplicateEntry(redblackCache_t * const cache, void *entry)
+bool
+redblackCacheCheckEntries(redblackCache_t * const cache)
 {
-  void *new_entry;
-  if (cache == NULL)
+  if (cacheCoreCheck(cache->core, NULL) == false)
     {
-      return NULL;
+      return false;
     }
-  if (entry == NULL)
+
+  return (cache->tree == NULL) || redblackTreeCheck(cache->tree);
+}
+
+/**
+ * Private helper function for red-black cache implementation.
+ *
+ * Add the operation counts of an unsharded cache or a single shard.
+ *
+ * \param cache pointer to an instance of \e redblackCache_t
+ * \param stats pointer to \c redblackCacheStats_t
+ * \return \c bool indicating success
+ */
+static
+bool
+redblackCacheAddStats(const redblackCache_t * const cache,
+                      redblackCacheStats_t * const stats)
+{
+  cacheCoreStats_t counts;
+
+  if (cacheCoreGetStats(cache->core, &counts) == false)
     {
-      cache->debug(__func__, __LINE__, cache->user, "Invalid entry==NULL");
-      return NULL;
+      return false;
     }
 
-  if (cache->duplicateEntry != NULL)
+  stats->lookups = stats->lookups + counts.lookups;
+  stats->hits = stats->hits + counts.hits;
+  stats->misses = stats->misses + counts.misses;
+  stats->insertions = stats->insertions + counts.insertions;
+  stats->replacements = stats->replacements + counts.replacements;
+  stats->evictions = stats->evictions + counts.evictions;
+  stats->expirations = stats->expirations + counts.expirations;
+
+  return true;
+}
+
+/**
+ * Private helper function for red-black cache implementation.
+ *
+ * Initialise an unsharded cache or a single shard and create its
+ * \c cacheCore_t and, unless it has a hash index, its red-black tree.
+ * Note that the cache passes itself to the \c redblackTree_t and
+ * \c cacheCore_t callbacks so a shard must not be moved after it has
+ * been initialised.
+ *
+ * \param cache pointer to an instance of \e redblackCache_t
+ * \param space maximum number of entries in the cache
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for callers entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param hash entry key hash function callback. \c NULL for a tree.
+ * \param user \c void pointer to user data to be echoed by callbacks
+ * \return \c bool indicating success
+ */
+static
+bool
+redblackCacheInit(redblackCache_t * const cache,
+                  const size_t space,
+                  const redblackCacheAllocFunc_t alloc,
+                  const redblackCacheDeallocFunc_t dealloc,
+                  const redblackCacheDuplicateEntryFunc_t duplicateEntry,
+                  const redblackCacheDeleteEntryFunc_t deleteEntry,
+                  const redblackCacheDebugFunc_t debug,
+                  const redblackCacheCompFunc_t comp,
+                  const redblackCacheHashFunc_t hash,
+                  void * const user)
+{
+  cache->alloc = alloc;
+  cache->dealloc = dealloc;
+  cache->duplicateEntry = duplicateEntry;
+  cache->debug = debug;
+  cache->compare = comp;
+  cache->user = user;
+  cache->hash = hash;
+  cache->core = NULL;
+  cache->tree = NULL;
+  cache->shards = NULL;
+  cache->numShards = 0;
+
+  /* Create red-black tree.
+   *
+   * Note that cache passes itself to the redblackTree_t callbacks!
+   */
+  if (hash == NULL)
     {
-      new_entry = cache->duplicateEntry(entry, cache->user);
-      if (new_entry == NULL)
+      cache->tree = redblackTreeCreate(redblackCacheAllocFunc,
+                                       redblackCacheDeallocFunc,
+                                       NULL,
+                                       NULL,
+                                       redblackCacheDebugFunc,
+                                       redblackCacheCompFunc,
+                                       cache);
+      if (cache->tree == NULL)
         {
-          cache->debug(__func__, __LINE__, cache->user, 
-                      "Couldn't duplicate entry!");
-          return NULL;
-        }   
+          debug(__func__, __LINE__, user,
+                "Can't create redblackCache_t red-black tree");
+          return false;
+        }
     }
-  else 
+
+  cache->core = cacheCoreCreate(space, sizeof(cacheCoreEntry_t), alloc,
+                                dealloc, duplicateEntry, deleteEntry, debug,
+                                comp, hash, redblackCacheLink,
+                                redblackCacheUnlink, redblackCacheLookup,
+                                cache, user);
+  if (cache->core == NULL)
     {
-      new_entry = entry;
+      redblackTreeDestroy(cache->tree);
+      return false;
     }
 
-  return new_entry;
+  return true;
+}
+
+/**
+ * Private helper function for red-black cache implementation.
+ *
+ * Select the shard of a sharded cache that holds an entry.
+ *
+ * \param cache pointer to an instance of \e redblackCache_t
+ * \param entry pointer to caller's data
+ * \return pointer to the \e redblackCache_t shard
+ */
+static
+redblackCache_t *
+redblackCacheShard(const redblackCache_t * const cache,
+                   const void * const entry)
+{
+  size_t hash = (cache->hash)(entry, cache->user);
+
+  return &(cache->shards[hash % cache->numShards]);
 }
 
 redblackCache_t *
-redblackCacheCreate(const size_t space,   
-                    const redblackCacheAllocFunc_t alloc, 
+redblackCacheCreate(const size_t space,
+                    const redblackCacheAllocFunc_t alloc,
                     const redblackCacheDeallocFunc_t dealloc,
                     const redblackCacheDuplicateEntryFunc_t duplicateEntry,
                     const redblackCacheDeleteEntryFunc_t deleteEntry,
@@ -280,12 +410,12 @@ redblackCacheCreate(const size_t space,
     }
   if (alloc == NULL)
     {
-      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
       return NULL;
     }
   if (dealloc == NULL)
     {
-      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
       return NULL;
     }
   if (comp == NULL)
@@ -299,259 +429,523 @@ redblackCacheCreate(const size_t space,
   if (cache == NULL)
     {
       debug(__func__, __LINE__, user,
-            "Can't allocate %d for redblackCache_t",
+            "Can't allocate %zu for redblackCache_t",
             sizeof(redblackCache_t));
       return NULL;
     }
 
-  if (cache->tree == NULL)
-    {
-      dealloc(cache, user);
-      debug(__func__, __LINE__, user,
-            "Can't create redblackCache_t red-black tree");
-      return NULL;
-    }
-
   /* Initialise cache */
-  cache->head.prev = NULL;
-  cache->head.next = &(cache->tail);
-  cache->head.entry = NULL;
-  cache->tail.prev = &(cache->head);
-  cache->tail.next = NULL;
-  cache->tail.entry = NULL;
-  cache->alloc = alloc;
-  cache->dealloc = dealloc;
-  cache->duplicateEntry = duplicateEntry;
-  cache->deleteEntry = deleteEntry;
-  cache->debug = debug;
-  cache->compare = comp;
-  cache->user = user;
-  cache->space = space;
-  cache->size = 0;
-
-  /* Create red-black tree. 
-   *
-   * Note that cache passes itself to the redblackTree_t callbacks!
-   */
-  cache->tree = redblackTreeCreate(redblackCacheAllocFunc, 
-                                   redblackCacheDeallocFunc,
-                                   NULL,
-                                   NULL,
-                                   redblackCacheDebugFunc, 
-                                   redblackCacheCompFunc,
-                                   cache);
-  if (cache->tree == NULL)
+  if (redblackCacheInit(cache, space, alloc, dealloc, duplicateEntry,
+                        deleteEntry, debug, comp, NULL, user) == false)
     {
       dealloc(cache, user);
-      debug(__func__, __LINE__, user,
-            "Can't create redblackCache_t red-black tree");
       return NULL;
     }
 
   return cache;
 }
 
-void *
-redblackCacheFind(redblackCache_t * const cache, void * const entry)
+redblackCache_t *
+redblackCacheCreateHashed
+(const size_t space,
+ const redblackCacheAllocFunc_t alloc,
+ const redblackCacheDeallocFunc_t dealloc,
+ const redblackCacheDuplicateEntryFunc_t duplicateEntry,
+ const redblackCacheDeleteEntryFunc_t deleteEntry,
+ const redblackCacheDebugFunc_t debug,
+ const redblackCacheCompFunc_t comp,
+ const redblackCacheHashFunc_t hash,
+ void * const user)
 {
-  redblackCacheEntry_t *cacheEntry, dummyCacheEntry;
+  redblackCache_t *cache = NULL;
 
-  if (cache == NULL)
+  if (debug == NULL)
     {
       return NULL;
     }
-  if (entry == NULL)
+  if (space == 0)
+    {
+      debug(__func__, __LINE__, user, "Invalid space==0 requested!");
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (comp == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      return NULL;
+    }
+  if (hash == NULL)
     {
+      debug(__func__, __LINE__, user, "Invalid hash() function!");
       return NULL;
     }
 
-  /* First see if we find the entry in the cache */
-  dummyCacheEntry.entry = entry;
-  if ((cacheEntry = redblackTreeFind(cache->tree, &dummyCacheEntry)) == NULL)
+  /* Allocate space for redblackCache_t */
+  cache = alloc(sizeof(redblackCache_t), user);
+  if (cache == NULL)
     {
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for redblackCache_t",
+            sizeof(redblackCache_t));
       return NULL;
     }
 
-  /* Found! Move it to the head of the list */
-  if (redblackCacheMoveToHead(cache, cacheEntry) == NULL)
+  /* Initialise cache */
+  if (redblackCacheInit(cache, space, alloc, dealloc, duplicateEntry,
+                        deleteEntry, debug, comp, hash, user) == false)
     {
-      cache->debug(__func__, __LINE__, cache->user,
-                   "redblackCacheMoveToHead() failed");
+      dealloc(cache, user);
       return NULL;
     }
 
-  return cacheEntry->entry;
+  return cache;
 }
 
-void *
-redblackCacheInsert(redblackCache_t * const cache, void * const entry)
+redblackCache_t *
+redblackCacheCreateSharded
+(const size_t shards,
+ const size_t space,
+ const redblackCacheAllocFunc_t alloc,
+ const redblackCacheDeallocFunc_t dealloc,
+ const redblackCacheDuplicateEntryFunc_t duplicateEntry,
+ const redblackCacheDeleteEntryFunc_t deleteEntry,
+ const redblackCacheDebugFunc_t debug,
+ const redblackCacheCompFunc_t comp,
+ const redblackCacheHashFunc_t hash,
+ void * const user)
 {
-  redblackCacheEntry_t *cacheEntry, dummyCacheEntry;
+  redblackCache_t *cache = NULL;
+  size_t s;
 
-  if (cache == NULL) 
+  if (debug == NULL)
     {
       return NULL;
     }
-  if (cache->alloc == NULL)
+  if (shards == 0)
     {
-      cache->debug(__func__, __LINE__, cache->user, 
-                   "Invalid cache->compare() function!");
+      debug(__func__, __LINE__, user, "Invalid shards==0 requested!");
       return NULL;
     }
-  if (entry == NULL)
+  if (space < shards)
     {
-      cache->debug(__func__, __LINE__, cache->user, "Invalid entry==NULL");
+      debug(__func__, __LINE__, user,
+            "Invalid space(%zu)<shards(%zu) requested!", space, shards);
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (duplicateEntry == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid duplicateEntry() function!");
+      return NULL;
+    }
+  if (comp == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      return NULL;
+    }
+  if (hash == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid hash() function!");
+      return NULL;
+    }
+  if (shards > (SIZE_MAX/sizeof(redblackCache_t)))
+    {
+      debug(__func__, __LINE__, user, "Too many shards(%zu)!", shards);
       return NULL;
     }
 
-  /* First see if we can find the entry in the tree */
-  dummyCacheEntry.entry = entry;
-  if ((cacheEntry = redblackTreeFind(cache->tree, &dummyCacheEntry)) != NULL)
-    { 
-      /* Move it to the head of the list */
-      if (redblackCacheMoveToHead(cache, cacheEntry) == NULL)
-        {
-          cache->debug(__func__, __LINE__, cache->user,
-                       "redblackCacheMoveToHead() failed");
-          return NULL;
-        }
+  /* Allocate space for redblackCache_t */
+  cache = alloc(sizeof(redblackCache_t), user);
+  if (cache == NULL)
+    {
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for redblackCache_t",
+            sizeof(redblackCache_t));
+      return NULL;
+    }
+  cache->alloc = alloc;
+  cache->dealloc = dealloc;
+  cache->duplicateEntry = duplicateEntry;
+  cache->debug = debug;
+  cache->compare = comp;
+  cache->user = user;
+  cache->hash = hash;
+  cache->core = NULL;
+  cache->tree = NULL;
+  cache->numShards = shards;
+
+  /* Allocate the shards */
+  cache->shards = alloc(shards*sizeof(redblackCache_t), user);
+  if (cache->shards == NULL)
+    {
+      dealloc(cache, user);
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for redblackCache_t shards",
+            shards*sizeof(redblackCache_t));
+      return NULL;
+    }
 
-      /* Callback to delete old entry */
-      if (cache->deleteEntry != NULL)
+  /* Initialise the shards. The first (space%shards) get one extra entry. */
+  for (s=0; s<shards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+      size_t shardSpace = (space/shards) + ((s < (space%shards)) ? 1 : 0);
+
+      if (redblackCacheInit(shard, shardSpace, alloc, dealloc, duplicateEntry,
+                            deleteEntry, debug, comp, NULL, user) == false)
         {
-          (cache->deleteEntry)(cacheEntry->entry, cache->user);
+          break;
         }
-     
-      /* New key/value? */
-      cacheEntry->entry = redblackCacheDuplicateEntry(cache, entry);
-      if (cacheEntry->entry == NULL)
+      if (mtx_init(&(shard->lock), mtx_plain) != thrd_success)
         {
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "Couldn't duplicate entry!");
-              return NULL;
+          cacheCoreDestroy(shard->core);
+          redblackTreeDestroy(shard->tree);
+          debug(__func__, __LINE__, user, "Can't initialise shard lock");
+          break;
         }
-      return cacheEntry->entry;
     }
-
-  /* Entry not found. Install in the cache in new memory. */
-  if (cache->size < cache->space)
+  if (s < shards)
     {
-      /* Allocate memory for redblackCacheEntry_t */
-      if ((cacheEntry = (cache->alloc)(sizeof(redblackCacheEntry_t),
-                                       cache->user)) == NULL)
+      while (s > 0)
         {
-          cache->debug(__func__, __LINE__, cache->user,
-                       "Memory allocation for cacheEntry failed!");
-          return NULL;
+          s = s-1;
+          cacheCoreDestroy(cache->shards[s].core);
+          redblackTreeDestroy(cache->shards[s].tree);
+          mtx_destroy(&(cache->shards[s].lock));
         }
+      dealloc(cache->shards, user);
+      dealloc(cache, user);
+      return NULL;
+    }
 
-      /* Install the new entry */
-      cacheEntry->entry = redblackCacheDuplicateEntry(cache, entry);
-      if (cacheEntry->entry == NULL)
-        {
-          cache->dealloc(cacheEntry, cache->user);
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "Couldn't duplicate entry!");
-          return NULL;
-        }
+  return cache;
+}
+
+bool
+redblackCacheSetPolicy(redblackCache_t * const cache,
+                       const redblackCachePolicy_e policy,
+                       const redblackCacheKeyEntryFunc_t keyEntry)
+{
+  size_t s;
 
-      /* Install in cache */
-      if (redblackTreeInsert(cache->tree, cacheEntry) == NULL)
+  if (cache == NULL)
+    {
+      return false;
+    }
+  if ((unsigned int)policy > (unsigned int)redblackCachePolicyARC)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Invalid policy %d!", (int)policy);
+      return false;
+    }
+  if (redblackCacheGetSize(cache) != 0)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Can't change the policy of a cache that is not empty!");
+      return false;
+    }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreSetPolicy(cache->core, (cacheCorePolicy_e)policy,
+                                keyEntry);
+    }
+
+  for (s=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+      bool set;
+
+      mtx_lock(&(shard->lock));
+      set = cacheCoreSetPolicy(shard->core, (cacheCorePolicy_e)policy,
+                               keyEntry);
+      mtx_unlock(&(shard->lock));
+      if (set == false)
         {
-          cache->debug(__func__, __LINE__, cache->user,
-                       "redblackTreeInsert() failed");
-          return NULL;
+          return false;
         }
+    }
 
-      /* Insert cacheEntry at head of list */
-      cacheEntry->next = (cache->head).next;
-      cacheEntry->prev = &(cache->head);
-      (cacheEntry->next)->prev = (cache->head).next = cacheEntry;
+  return true;
+}
 
-      /* Count the new entry */
-      cache->size = cache->size + 1;
+bool
+redblackCacheSetBudget(redblackCache_t * const cache,
+                       const size_t budget,
+                       const redblackCacheCostFunc_t cost)
+{
+  size_t s;
 
-      /* Done */
-      return cacheEntry->entry;
+  if (cache == NULL)
+    {
+      return false;
+    }
+  if (cost == NULL)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Invalid cost() function!");
+      return false;
+    }
+  if ((budget == 0) || (budget < cache->numShards))
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Invalid budget(%zu)!", budget);
+      return false;
+    }
+  if (redblackCacheGetSize(cache) != 0)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Can't change the budget of a cache that is not empty!");
+      return false;
     }
-  else
+  if (cache->shards == NULL)
     {
-      /* Reuse the last cache entry */
-      cacheEntry = (cache->tail).prev;
-      redblackTreeRemove(cache->tree, cacheEntry);
+      return cacheCoreSetBudget(cache->core, budget, cost);
+    }
 
-      /* Callback to delete old entry */
-      if (cache->deleteEntry != NULL)
+  /* The first (budget%numShards) shards get one extra unit of budget */
+  for (s=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+      size_t shardBudget = (budget/cache->numShards) +
+        ((s < (budget%cache->numShards)) ? 1 : 0);
+      bool set;
+
+      mtx_lock(&(shard->lock));
+      set = cacheCoreSetBudget(shard->core, shardBudget, cost);
+      mtx_unlock(&(shard->lock));
+      if (set == false)
         {
-          (cache->deleteEntry)(cacheEntry->entry, cache->user);
+          return false;
         }
+    }
+
+  return true;
+}
+
+bool
+redblackCacheSetTTL(redblackCache_t * const cache,
+                    const size_t ttl,
+                    const redblackCacheClockFunc_t clock)
+{
+  size_t s;
+
+  if (cache == NULL)
+    {
+      return false;
+    }
+  if (clock == NULL)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Invalid clock() function!");
+      return false;
+    }
+  if (redblackCacheGetSize(cache) != 0)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Can't change the time to live of a cache that "
+                         "is not empty!");
+      return false;
+    }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreSetTTL(cache->core, ttl, clock);
+    }
+
+  for (s=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+      bool set;
 
-      /* Install the new entry */
-      cacheEntry->entry = redblackCacheDuplicateEntry(cache, entry);
-      if (cacheEntry->entry == NULL)
+      mtx_lock(&(shard->lock));
+      set = cacheCoreSetTTL(shard->core, ttl, clock);
+      mtx_unlock(&(shard->lock));
+      if (set == false)
         {
-          cache->dealloc(cacheEntry, cache->user);
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "Couldn't duplicate entry!");
-          return NULL;
+          return false;
         }
-      redblackTreeInsert(cache->tree, cacheEntry);
-      
-      /* Move it to the start of the cache list */
-      if (redblackCacheMoveToHead(cache, cacheEntry) == NULL)
+    }
+
+  return true;
+}
+
+void *
+redblackCacheFind(redblackCache_t * const cache, void * const entry)
+{
+  redblackCache_t *shard;
+  void *found;
+
+  if ((cache == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreFind(cache->core, entry);
+    }
+
+  /* Copy the entry while the shard is locked. Another thread may evict
+     the entry in the cache as soon as the lock is released. */
+  shard = redblackCacheShard(cache, entry);
+  mtx_lock(&(shard->lock));
+  found = cacheCoreFind(shard->core, entry);
+  if (found != NULL)
+    {
+      found = (cache->duplicateEntry)(found, cache->user);
+      if (found == NULL)
         {
           cache->debug(__func__, __LINE__, cache->user,
-                       "redblackCacheMoveToHead() failed");
-          return NULL;
+                       "Couldn't duplicate entry!");
         }
+    }
+  mtx_unlock(&(shard->lock));
+
+  return found;
+}
+
+void *
+redblackCacheInsert(redblackCache_t * const cache, void * const entry)
+{
+  redblackCache_t *shard;
+  void *installed;
 
-      return cacheEntry->entry;
+  if (cache == NULL)
+    {
+      return NULL;
     }
+  if (entry == NULL)
+    {
+      cache->debug(__func__, __LINE__, cache->user, "Invalid entry==NULL");
+      return NULL;
+    }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreInsert(cache->core, entry);
+    }
+
+  shard = redblackCacheShard(cache, entry);
+  mtx_lock(&(shard->lock));
+  installed = cacheCoreInsert(shard->core, entry);
+  mtx_unlock(&(shard->lock));
+
+  /* The installed entry may already have been evicted by another thread */
+  return (installed == NULL) ? NULL : entry;
 }
 
-void 
-redblackCacheClear(redblackCache_t * const cache)
+void *
+redblackCacheInsertWithTTL(redblackCache_t * const cache,
+                           void * const entry,
+                           const size_t ttl)
 {
-  redblackCacheEntry_t *cacheEntry, *nextCacheEntry;
+  redblackCache_t *shard;
+  void *installed;
 
   if (cache == NULL)
     {
-      return;
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      cache->debug(__func__, __LINE__, cache->user, "Invalid entry==NULL");
+      return NULL;
     }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreInsertWithTTL(cache->core, entry, ttl);
+    }
+
+  shard = redblackCacheShard(cache, entry);
+  mtx_lock(&(shard->lock));
+  installed = cacheCoreInsertWithTTL(shard->core, entry, ttl);
+  mtx_unlock(&(shard->lock));
 
-  /* Clear the tree */
+  /* The installed entry may already have been evicted by another thread */
+  return (installed == NULL) ? NULL : entry;
+}
+
+/**
+ * Private helper function for red-black cache implementation.
+ *
+ * Clear an unsharded cache or a single shard.
+ *
+ * \param cache pointer to an instance of \e redblackCache_t
+ */
+static
+void
+redblackCacheClearEntries(redblackCache_t * const cache)
+{
+  /* Clear the tree first. Its nodes point to the cache entries. */
   if (cache->tree != NULL)
     {
       redblackTreeClear(cache->tree);
     }
+  cacheCoreClear(cache->core);
+}
+
+void
+redblackCacheClear(redblackCache_t * const cache)
+{
+  size_t s;
 
-  /* Clear the list */
-  cacheEntry = cache->head.next;
-  while (cacheEntry != &(cache->tail))
+  if (cache == NULL)
     {
-      nextCacheEntry = cacheEntry->next;
-      if (cache->deleteEntry != NULL)
-        {
-          (cache->deleteEntry)(cacheEntry->entry, cache->user);
-        }
-      (cache->dealloc)(cacheEntry, cache->user);
-      cacheEntry = nextCacheEntry;
+      return;
+    }
+  if (cache->shards == NULL)
+    {
+      redblackCacheClearEntries(cache);
+      return;
     }
 
-  cache->head.next = &(cache->tail);
-  cache->tail.prev = &(cache->head);
-  cache->size = 0;
+  for (s=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+
+      mtx_lock(&(shard->lock));
+      redblackCacheClearEntries(shard);
+      mtx_unlock(&(shard->lock));
+    }
 }
 
-void 
+void
 redblackCacheDestroy(redblackCache_t * const cache)
 {
+  size_t s;
+
   if ((cache == NULL) || (cache->dealloc == NULL))
     {
       return;
     }
 
   redblackCacheClear(cache); /* Do this first! */
+  if (cache->shards != NULL)
+    {
+      for (s=0; s<cache->numShards; s++)
+        {
+          cacheCoreDestroy(cache->shards[s].core);
+          redblackTreeDestroy(cache->shards[s].tree);
+          mtx_destroy(&(cache->shards[s].lock));
+        }
+      (cache->dealloc)(cache->shards, cache->user);
+    }
+  cacheCoreDestroy(cache->core);
   redblackTreeDestroy(cache->tree);
   (cache->dealloc)(cache, cache->user);
 
@@ -561,59 +955,185 @@ redblackCacheDestroy(redblackCache_t * const cache)
 size_t
 redblackCacheGetSize(const redblackCache_t * const cache)
 {
+  size_t s, size;
+
+  if (cache == NULL)
+    {
+      return 0;
+    }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreGetSize(cache->core);
+    }
+
+  for (s=0, size=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+
+      mtx_lock(&(shard->lock));
+      size = size + cacheCoreGetSize(shard->core);
+      mtx_unlock(&(shard->lock));
+    }
+
+  return size;
+}
+
+size_t
+redblackCacheGetCost(const redblackCache_t * const cache)
+{
+  size_t s, cost;
+
   if (cache == NULL)
     {
       return 0;
     }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreGetCost(cache->core);
+    }
+
+  for (s=0, cost=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
 
-  return cache->size;
+      mtx_lock(&(shard->lock));
+      cost = cost + cacheCoreGetCost(shard->core);
+      mtx_unlock(&(shard->lock));
+    }
+
+  return cost;
+}
+
+bool
+redblackCacheGetStats(const redblackCache_t * const cache,
+                      redblackCacheStats_t * const stats)
+{
+  if ((cache == NULL) || (stats == NULL))
+    {
+      return false;
+    }
+#if defined(REDBLACK_CACHE_NO_STATS)
+  return false;
+#else
+  size_t s;
+  bool res;
+
+  *stats = (redblackCacheStats_t){ 0 };
+  if (cache->shards == NULL)
+    {
+      return redblackCacheAddStats(cache, stats);
+    }
+
+  for (s=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+
+      mtx_lock(&(shard->lock));
+      res = redblackCacheAddStats(shard, stats);
+      mtx_unlock(&(shard->lock));
+      if (res == false)
+        {
+          return false;
+        }
+    }
+
+  return true;
+#endif
 }
 
 size_t
 redblackCacheGetDepth(const redblackCache_t * const cache)
 {
-  if ((cache == NULL) || (cache->tree == NULL))
+  size_t s, depth, max;
+
+  if (cache == NULL)
     {
       return 0;
     }
+  if (cache->shards == NULL)
+    {
+      if (cache->tree == NULL)
+        {
+          return cacheCoreGetDepth(cache->core);
+        }
+      return redblackTreeGetDepth(cache->tree);
+    }
+
+  for (s=0, max=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
+
+      mtx_lock(&(shard->lock));
+      depth = redblackTreeGetDepth(shard->tree);
+      mtx_unlock(&(shard->lock));
+      if (depth > max)
+        {
+          max = depth;
+        }
+    }
 
-  return redblackTreeGetDepth(cache->tree);
+  return max;
 }
 
 bool
-redblackCacheWalk(redblackCache_t * const cache, 
+redblackCacheWalk(redblackCache_t * const cache,
                   const redblackCacheWalkFunc_t walk)
 {
-  redblackCacheEntry_t *cacheEntry, *nextCacheEntry;
+  size_t s;
+  bool res;
 
   if ((cache == NULL) || (walk == NULL))
     {
       return false;
     }
+  if (cache->shards == NULL)
+    {
+      return cacheCoreWalk(cache->core, walk);
+    }
 
-  cacheEntry = cache->head.next;
-  while (cacheEntry != &(cache->tail))
+  for (s=0; s<cache->numShards; s++)
     {
-      nextCacheEntry = cacheEntry->next;
-      if (walk(cacheEntry->entry, cache->user) == false)
+      redblackCache_t *shard = &(cache->shards[s]);
+
+      mtx_lock(&(shard->lock));
+      res = cacheCoreWalk(shard->core, walk);
+      mtx_unlock(&(shard->lock));
+      if (res == false)
         {
           return false;
         }
-
-      cacheEntry = nextCacheEntry;
     }
 
   return true;
 }
 
-bool 
+bool
 redblackCacheCheck(redblackCache_t * const cache)
 {
-  if ((cache == NULL) || (cache->tree == NULL))
+  size_t s;
+  bool res;
+
+  if (cache == NULL)
     {
       return false;
     }
+  if (cache->shards == NULL)
+    {
+      return redblackCacheCheckEntries(cache);
+    }
 
-  return redblackTreeCheck(cache->tree);
-}
+  for (s=0; s<cache->numShards; s++)
+    {
+      redblackCache_t *shard = &(cache->shards[s]);
 
+      mtx_lock(&(shard->lock));
+      res = redblackCacheCheckEntries(shard);
+      mtx_unlock(&(shard->lock));
+      if (res == false)
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
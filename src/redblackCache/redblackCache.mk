@@ -1,13 +1,36 @@
 # Programs in this directory
-redblackCache_PROGRAMS:=redblackCache_interp
+redblackCache_PROGRAMS:=redblackCache_interp redblackCacheSharded_test \
+redblackCacheHashed_test redblackCacheClock_test
 PROGRAMS+=$(redblackCache_PROGRAMS)
 
 VPATH += src/redblackCache src/redblackTree
 
 redblackCache_interp_C_SOURCES := \
-redblackCache.c redblackCache_wrapper.c redblackTree.c
+redblackCache.c redblackCache_wrapper.c redblackTree.c arena.c \
+cacheCore.c
 
 redblackCache_interp_STATIC_LIBRARIES := interp.a
 
 $(call add_extra_CFLAGS_macro,$(redblackCache_interp_C_SOURCES),\
--Isrc/interp -Isrc/redblackTree)
+-Isrc/interp -Isrc/redblackTree -Isrc/arena -Isrc/cacheCore)
+
+redblackCacheSharded_test_C_SOURCES := \
+redblackCacheSharded_test.c redblackCache.c redblackTree.c arena.c \
+cacheCore.c
+
+$(call add_extra_CFLAGS_macro,$(redblackCacheSharded_test_C_SOURCES),\
+-Isrc/interp -Isrc/redblackTree -Isrc/arena -Isrc/cacheCore)
+
+redblackCacheHashed_test_C_SOURCES := \
+redblackCacheHashed_test.c redblackCache.c redblackTree.c arena.c \
+cacheCore.c
+
+$(call add_extra_CFLAGS_macro,$(redblackCacheHashed_test_C_SOURCES),\
+-Isrc/interp -Isrc/redblackTree -Isrc/arena -Isrc/cacheCore)
+
+redblackCacheClock_test_C_SOURCES := \
+redblackCacheClock_test.c redblackCache.c redblackTree.c arena.c \
+cacheCore.c
+
+$(call add_extra_CFLAGS_macro,$(redblackCacheClock_test_C_SOURCES),\
+-Isrc/interp -Isrc/redblackTree -Isrc/arena -Isrc/cacheCore)
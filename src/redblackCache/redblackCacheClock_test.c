@@ -0,0 +1,199 @@
+/*
+ * redblackCacheClock_test.c
+ *
+ * Eviction order of a red-black cache with the CLOCK policy. A hit only
+ * sets the reference bit of an entry. When the cache is full the clock
+ * hand sweeps from the tail of the list towards the head, clearing the
+ * reference bits it passes, and the first unreferenced entry is replaced
+ * in place. The hand then continues from the entry after it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "redblackCache.h"
+
+#define SPACE 4
+
+static bool quiet;
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void *
+DuplicateEntry(void * const entry, void * const user)
+{
+  long *copy;
+
+  (void)user;
+  copy = malloc(sizeof(long));
+  if (copy != NULL)
+    {
+      *copy = *(long *)entry;
+    }
+  return copy;
+}
+
+static
+bool
+DeleteEntry(void * const entry, void * const user)
+{
+  (void)user;
+  if (quiet == false)
+    {
+      printf(" evict %ld", *(long *)entry);
+    }
+  free(entry);
+  return true;
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+bool
+Show(void * const entry, void * const user)
+{
+  (void)user;
+  printf(" %ld", *(long *)entry);
+  return true;
+}
+
+static
+void
+Insert(redblackCache_t * const cache, long key)
+{
+  printf("insert %ld:", key);
+  if (redblackCacheInsert(cache, &key) == NULL)
+    {
+      printf(" failed");
+    }
+  printf("\n");
+}
+
+static
+void
+Find(redblackCache_t * const cache, long key)
+{
+  printf("find %ld: %s\n", key,
+         (redblackCacheFind(cache, &key) == NULL) ? "miss" : "hit");
+}
+
+static
+void
+State(redblackCache_t * const cache)
+{
+  printf("size %zu check %s list", redblackCacheGetSize(cache),
+         redblackCacheCheck(cache) ? "true" : "false");
+  (void)redblackCacheWalk(cache, Show);
+  printf("\n");
+}
+
+int main(void)
+{
+  redblackCache_t *cache;
+  long k;
+
+  cache = redblackCacheCreate(SPACE, Alloc, Dealloc, DuplicateEntry,
+                              DeleteEntry, Debug, Compare, NULL);
+  if ((cache == NULL) ||
+      (redblackCacheSetPolicy(cache, redblackCachePolicyClock, NULL)
+       == false))
+    {
+      fprintf(stderr, "Can't create a cache with the CLOCK policy\n");
+      exit(EXIT_FAILURE);
+    }
+  for (k=1; k<=SPACE; k++)
+    {
+      Insert(cache, k);
+    }
+  State(cache);
+
+  /* A referenced entry at the tail gets a second chance */
+  Find(cache, 1);
+  Find(cache, 3);
+  Insert(cache, 5);
+  State(cache);
+
+  /* The hand continues from the replaced entry and passes entry 3 */
+  Insert(cache, 6);
+  State(cache);
+
+  /* With every entry referenced the hand sweeps the whole list and
+     replaces the entry it started from */
+  Find(cache, 1);
+  Find(cache, 3);
+  Find(cache, 5);
+  Find(cache, 6);
+  Insert(cache, 7);
+  State(cache);
+
+  /* Second chances were used up by the sweep */
+  Insert(cache, 8);
+  State(cache);
+
+  /* A hit on an entry behind the hand lasts until the hand comes round */
+  Find(cache, 7);
+  Insert(cache, 9);
+  Insert(cache, 10);
+  Insert(cache, 11);
+  State(cache);
+
+  /* Without another hit it is replaced when the hand comes round again */
+  Insert(cache, 12);
+  Insert(cache, 13);
+  Insert(cache, 14);
+  State(cache);
+
+  quiet = true;
+  redblackCacheDestroy(cache);
+
+  return EXIT_SUCCESS;
+}
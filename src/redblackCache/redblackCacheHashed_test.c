@@ -0,0 +1,315 @@
+/*
+ * redblackCacheHashed_test.c
+ *
+ * Hits, misses, replacements, evictions and expirations in a hash-indexed
+ * red-black cache. The hash function only has four values so that most
+ * entries collide and removals from the hash index must move the later
+ * entries of a probe sequence. The ghost entries of the ARC policy must
+ * keep no entry data, in the hash index and in the search tree.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "redblackCache.h"
+
+#define SPACE 8
+
+typedef struct entry_t
+{
+  long key;
+  long value;
+}
+entry_t;
+
+static size_t now;
+
+static size_t live;
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void *
+DuplicateEntry(void * const entry, void * const user)
+{
+  entry_t *copy;
+
+  (void)user;
+  copy = malloc(sizeof(entry_t));
+  if (copy != NULL)
+    {
+      *copy = *(entry_t *)entry;
+      live = live+1;
+    }
+  return copy;
+}
+
+static
+void *
+KeyEntry(void * const entry, void * const user)
+{
+  entry_t *key;
+
+  (void)user;
+  key = malloc(sizeof(entry_t));
+  if (key != NULL)
+    {
+      key->key = ((entry_t *)entry)->key;
+      key->value = 0;
+    }
+  return key;
+}
+
+static
+bool
+DeleteEntry(void * const entry, void * const user)
+{
+  (void)user;
+  if (((entry_t *)entry)->value != 0)
+    {
+      live = live-1;
+    }
+  free(entry);
+  return true;
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = ((const entry_t *)a)->key;
+  long kb = ((const entry_t *)b)->key;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+size_t
+Hash(const void * const entry, void * const user)
+{
+  (void)user;
+  return (size_t)(((const entry_t *)entry)->key%4);
+}
+
+static
+size_t
+Clock(void * const user)
+{
+  (void)user;
+  return now;
+}
+
+static
+bool
+Show(void * const entry, void * const user)
+{
+  (void)user;
+  printf(" %ld", ((entry_t *)entry)->key);
+  return true;
+}
+
+static
+void
+Insert(redblackCache_t * const cache, const long key, const long value)
+{
+  entry_t entry = { key, value };
+
+  if (redblackCacheInsert(cache, &entry) == NULL)
+    {
+      printf("insert %ld failed\n", key);
+    }
+}
+
+static
+void
+Find(redblackCache_t * const cache, const long lo, const long hi)
+{
+  long k;
+
+  printf("find");
+  for (k=lo; k<=hi; k++)
+    {
+      entry_t entry = { k, 0 };
+      entry_t *found = redblackCacheFind(cache, &entry);
+
+      if (found == NULL)
+        {
+          printf(" %ld:miss", k);
+        }
+      else
+        {
+          printf(" %ld:%ld", k, found->value);
+        }
+    }
+  printf("\n");
+}
+
+static
+void
+State(redblackCache_t * const cache)
+{
+  redblackCacheStats_t stats;
+
+  printf("size %zu check %s lru", redblackCacheGetSize(cache),
+         redblackCacheCheck(cache) ? "true" : "false");
+  (void)redblackCacheWalk(cache, Show);
+  printf("\n");
+  if (redblackCacheGetStats(cache, &stats))
+    {
+      printf("hits %zu misses %zu insertions %zu replacements %zu "
+             "evictions %zu expirations %zu\n",
+             stats.hits, stats.misses, stats.insertions, stats.replacements,
+             stats.evictions, stats.expirations);
+    }
+}
+
+int main(void)
+{
+  redblackCache_t *cache;
+  long k;
+
+  cache = redblackCacheCreateHashed(SPACE, Alloc, Dealloc, DuplicateEntry,
+                                    DeleteEntry, Debug, Compare, Hash, NULL);
+  if (cache == NULL)
+    {
+      fprintf(stderr, "redblackCacheCreateHashed() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  /* Hits and misses among colliding keys */
+  printf("insert 0 4 8 12 1 5 9 13\n");
+  for (k=0; k<8; k++)
+    {
+      Insert(cache, ((k%4)*4)+(k/4), k);
+    }
+  Find(cache, 0, 16);
+  State(cache);
+
+  /* Replace an entry in the middle of a probe sequence */
+  printf("replace 8\n");
+  Insert(cache, 8, 80);
+  Find(cache, 8, 8);
+  State(cache);
+
+  /* Evict entries from the middle and the start of probe sequences */
+  printf("insert 16 20\n");
+  Find(cache, 0, 0);
+  Insert(cache, 16, 16);
+  Insert(cache, 20, 20);
+  Find(cache, 0, 20);
+  State(cache);
+
+  /* Evict every entry with the same hash */
+  printf("insert 2 6 10 14 18 22 26 30\n");
+  for (k=2; k<=30; k+=4)
+    {
+      Insert(cache, k, k);
+    }
+  Find(cache, 0, 30);
+  State(cache);
+
+  /* Clear and reuse the hash index */
+  printf("clear\n");
+  redblackCacheClear(cache);
+  Find(cache, 2, 2);
+  Insert(cache, 2, 200);
+  Find(cache, 2, 2);
+  State(cache);
+  redblackCacheDestroy(cache);
+
+  /* Expire colliding entries */
+  cache = redblackCacheCreateHashed(SPACE, Alloc, Dealloc, DuplicateEntry,
+                                    DeleteEntry, Debug, Compare, Hash, NULL);
+  if ((cache == NULL) || (redblackCacheSetTTL(cache, 0, Clock) == false))
+    {
+      fprintf(stderr, "Can't create a hashed cache with a clock\n");
+      exit(EXIT_FAILURE);
+    }
+  printf("insert 1 5 9 13 with ttl 10 20 10 20\n");
+  for (k=1; k<=13; k+=4)
+    {
+      entry_t entry = { k, k };
+      (void)redblackCacheInsertWithTTL(cache, &entry, ((k%8) == 1) ? 10 : 20);
+    }
+  now = 15;
+  Find(cache, 1, 13);
+  State(cache);
+  now = 25;
+  Find(cache, 1, 13);
+  State(cache);
+  redblackCacheDestroy(cache);
+
+  /* Ghosts keep only a hash or a key */
+  for (k=0; k<2; k++)
+    {
+      long j;
+
+      live = 0;
+      cache = (k == 0) ?
+        redblackCacheCreateHashed(SPACE, Alloc, Dealloc, DuplicateEntry,
+                                  DeleteEntry, Debug, Compare, Hash, NULL) :
+        redblackCacheCreate(SPACE, Alloc, Dealloc, DuplicateEntry,
+                            DeleteEntry, Debug, Compare, NULL);
+      if ((cache == NULL) ||
+          (redblackCacheSetPolicy(cache, redblackCachePolicyARC,
+                                  (k == 0) ? NULL : KeyEntry) == false))
+        {
+          fprintf(stderr, "Can't create a cache with the ARC policy\n");
+          exit(EXIT_FAILURE);
+        }
+      printf("%s insert 1 to 16 then 1 2\n", (k == 0) ? "hashed" : "tree");
+      for (j=1; j<=16; j++)
+        {
+          Insert(cache, j, j);
+        }
+      printf("live %zu\n", live);
+      Insert(cache, 1, 100);
+      Insert(cache, 2, 200);
+      Find(cache, 1, 4);
+      State(cache);
+      printf("live %zu\n", live);
+      redblackCacheDestroy(cache);
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,228 @@
+/*
+ * redblackCacheSharded_test.c
+ *
+ * Threads insert and find entries in a sharded red-black cache while
+ * entries are evicted by other threads. Each entry found is a copy that
+ * is checked against its key and freed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <threads.h>
+
+#include "redblackCache.h"
+
+#define THREADS 4
+#define SHARDS 8
+#define SPACE 64
+#define KEYS 256
+#define ROUNDS 20000
+
+typedef struct entry_t
+{
+  size_t key;
+  size_t value;
+}
+entry_t;
+
+typedef struct thread_t
+{
+  redblackCache_t *cache;
+  size_t seed;
+  size_t found;
+  size_t errors;
+}
+thread_t;
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void *
+DuplicateEntry(void * const entry, void * const user)
+{
+  entry_t *copy;
+
+  (void)user;
+  copy = malloc(sizeof(entry_t));
+  if (copy != NULL)
+    {
+      *copy = *(entry_t *)entry;
+    }
+  return copy;
+}
+
+static
+bool
+DeleteEntry(void * const entry, void * const user)
+{
+  (void)user;
+  free(entry);
+  return true;
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)user;
+  va_start(args, format);
+  fprintf(stderr, "%s:%u ", function, line);
+  vfprintf(stderr, format, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  size_t ka = ((const entry_t *)a)->key;
+  size_t kb = ((const entry_t *)b)->key;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+size_t
+Hash(const void * const entry, void * const user)
+{
+  (void)user;
+  return ((const entry_t *)entry)->key*(size_t)0x9e3779b97f4a7c15ULL;
+}
+
+static
+int
+Run(void *arg)
+{
+  thread_t *thread = arg;
+  size_t r;
+
+  for (r=0; r<ROUNDS; r++)
+    {
+      entry_t entry;
+      entry_t *found;
+
+      thread->seed = (thread->seed*6364136223846793005ULL) +
+        1442695040888963407ULL;
+      entry.key = (size_t)(thread->seed>>33)%KEYS;
+      entry.value = entry.key*3;
+      if (((thread->seed>>20) & 1) == 0)
+        {
+          if (redblackCacheInsert(thread->cache, &entry) != &entry)
+            {
+              thread->errors++;
+            }
+          continue;
+        }
+      found = redblackCacheFind(thread->cache, &entry);
+      if (found == NULL)
+        {
+          continue;
+        }
+      if ((found == &entry) || (found->key != entry.key) ||
+          (found->value != entry.value))
+        {
+          thread->errors++;
+        }
+      thread->found++;
+      free(found);
+    }
+
+  return 0;
+}
+
+int main(void)
+{
+  redblackCache_t *cache;
+  redblackCacheStats_t stats;
+  thrd_t threads[THREADS];
+  thread_t thread[THREADS];
+  size_t t;
+  size_t found = 0;
+  size_t errors = 0;
+
+  /* A sharded cache needs a duplicateEntry() callback */
+  cache = redblackCacheCreateSharded(SHARDS, SPACE, Alloc, Dealloc, NULL,
+                                     DeleteEntry, Debug, Compare, Hash, NULL);
+  printf("create without duplicateEntry: %s\n",
+         (cache == NULL) ? "failed" : "succeeded");
+  redblackCacheDestroy(cache);
+
+  cache = redblackCacheCreateSharded(SHARDS, SPACE, Alloc, Dealloc,
+                                     DuplicateEntry, DeleteEntry, Debug,
+                                     Compare, Hash, NULL);
+  if (cache == NULL)
+    {
+      fprintf(stderr, "redblackCacheCreateSharded() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  for (t=0; t<THREADS; t++)
+    {
+      thread[t] = (thread_t){ cache, t+1, 0, 0 };
+      if (thrd_create(&threads[t], Run, &thread[t]) != thrd_success)
+        {
+          fprintf(stderr, "thrd_create() failed\n");
+          exit(EXIT_FAILURE);
+        }
+    }
+  for (t=0; t<THREADS; t++)
+    {
+      thrd_join(threads[t], NULL);
+      found += thread[t].found;
+      errors += thread[t].errors;
+    }
+
+  printf("errors: %zu\n", errors);
+  printf("found: %s\n", (found > 0) ? "some" : "none");
+  printf("size <= space: %s\n",
+         (redblackCacheGetSize(cache) <= SPACE) ? "true" : "false");
+  printf("check: %s\n", redblackCacheCheck(cache) ? "true" : "false");
+#if !defined(REDBLACK_CACHE_NO_STATS)
+  if (redblackCacheGetStats(cache, &stats) == false)
+    {
+      fprintf(stderr, "redblackCacheGetStats() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  printf("lookups: %s\n",
+         ((stats.hits == found) && (stats.hits+stats.misses == stats.lookups))
+         ? "consistent" : "inconsistent");
+#else
+  (void)stats;
+  printf("lookups: consistent\n");
+#endif
+
+  redblackCacheClear(cache);
+  printf("size after clear: %zu\n", redblackCacheGetSize(cache));
+  redblackCacheDestroy(cache);
+
+  return EXIT_SUCCESS;
+}
@@ -19,36 +19,22 @@ extern "C" {
 #include <stddef.h>
 #endif
 
+#include <threads.h>
+
 #include "compare.h"
 #include "redblackTree.h"
+#include "cacheCore.h"
 #include "redblackCache.h"
 
-/**
- * \c redblackCache_t internal entry type. 
- *
- * Internal representation of a \c redblackCache_t entry.
- */
-typedef struct redblackCacheEntry_t
-{
-  void *entry;
-  /**< Pointer to caller's entry data. 
-     This memory was allocated by the caller. */
-
-  struct redblackCacheEntry_t *next;
-  /**< Pointer to the next entry */
-
-  struct redblackCacheEntry_t *prev;
-  /**< Pointer to the previous entry */
-} redblackCacheEntry_t;
-
 /**
  * \c redblackCache_t structure.
  * 
- * Private implementation of \c redblackCache_t. Uses a linked list and a
- * red-black tree.  New entries are allocated up to \e space after
- * which the oldest entry is re-used as the newest cache entry.
+ * Private implementation of \c redblackCache_t. Uses a \c cacheCore_t
+ * for the entries and, unless the cache is hash indexed, a red-black tree
+ * to find them. A sharded cache holds an array of such caches, each
+ * guarded by its own lock.
  *
- * \see \c list_t \c redblackTree_t
+ * \see \c cacheCore_t \c redblackTree_t
  */
 struct redblackCache_t
 {
@@ -61,39 +47,35 @@ struct redblackCache_t
   redblackCacheDuplicateEntryFunc_t duplicateEntry;
   /**< Entry duplication callback function for the caller's entry data. */
 
-  redblackCacheDeleteEntryFunc_t deleteEntry;
-  /**< Memory deallocator callback function for the caller's entry data. */
-
   redblackCacheDebugFunc_t debug;
   /**< Debugging message callback function. */
 
   redblackCacheCompFunc_t compare;
-  /**< Callback function to compare two entries in the splay tree.  */
+  /**< Callback function to compare two entries in the red-black tree. */
 
-  redblackCacheEntry_t head;
-  /**< First entry. This is a dummy list entry. It never stores a list
-     entry data entry pointer. It simplifies list manipulations. The
-     \e head.prev member is always \c NULL. The \e head.next member
-     points to the first real list entry. If the list is empty then 
-     \e head.next points to \e tail.prev . */
+  void *user;
+  /**< Placeholder for user data in callbacks. */
 
-  redblackCacheEntry_t tail;
-  /**< Last entry. Also a dummy list entry. The \e tail.next member
-     is always \c NULL. The \e tail.prev member points to the last
-     real list entry. If the list is empty then \e tail.prev
-     points to \e head.next .*/
+  redblackCacheHashFunc_t hash;
+  /**< Callback function to hash an entry to a shard or to a slot in
+     the hash index. \c NULL if neither is used. */
+
+  cacheCore_t *core;
+  /**< Entries of the cache in the queues of its policy. \c NULL if
+     sharded. */
 
   redblackTree_t *tree;
-  /**< Cache red-black tree. */
+  /**< Cache red-black tree of the \c cacheCoreEntry_t entries in
+     \e core. \c NULL if sharded or hash indexed. */
 
-  size_t size;
-  /**< Number of entries in the cache. */
+  redblackCache_t *shards;
+  /**< Array of independent caches. \c NULL if not sharded. */
 
-  size_t space;
-  /**< Maximum number of entries in the cache. */
+  size_t numShards;
+  /**< Number of caches in \e shards. */
 
-  void *user;
-  /**< Placeholder for user data in callbacks. */
+  mtx_t lock;
+  /**< Lock serialising access to a cache in \e shards. */
 };
 
 #ifdef __cplusplus
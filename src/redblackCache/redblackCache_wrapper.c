@@ -25,6 +25,19 @@ interpCreate(void)
                              NULL);
 }
 
+void *
+interpCreateWithSize(const size_t size)
+{
+  return redblackCacheCreate(size, 
+                             interpAlloc, 
+                             interpDealloc,
+                             interpDuplicateEntry,
+                             interpDeleteEntry,
+                             interpDebug, 
+                             interpComp, 
+                             NULL);
+}
+
 void *
 interpFind(void * const cache, void * const entry)
 {
@@ -199,3 +212,115 @@ interpCopy(void * const dst, void * const src)
   interpError(__func__, __LINE__, "Not implemented!");
   return 0;
 }
+
+bool
+interpBuild(void * const tree, const size_t n)
+{
+  (void)tree;
+  (void)n;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpWalkRange(void * const tree,
+                const void * const lo,
+                const void * const hi,
+                const interpWalkFunc_t walk)
+{
+  (void)tree;
+  (void)lo;
+  (void)hi;
+  (void)walk;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+size_t
+interpRemoveRange(void * const tree,
+                  const void * const lo,
+                  const void * const hi)
+{
+  (void)tree;
+  (void)lo;
+  (void)hi;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return 0;
+}
+
+bool
+interpSetPolicy(void * const cache, const size_t policy)
+{
+  if (policy > (size_t)redblackCachePolicyARC)
+    {
+      interpError(__func__, __LINE__, "Invalid policy!");
+      return false;
+    }
+  /* An interpreter entry is its own key */
+  return redblackCacheSetPolicy(cache, (redblackCachePolicy_e)policy,
+                                interpDuplicateEntry);
+}
+
+bool
+interpShowStats(void * const cache)
+{
+  redblackCacheStats_t stats;
+
+  if (redblackCacheGetStats(cache, &stats) == false)
+    {
+      return false;
+    }
+  interpMessage("lookups %zu", stats.lookups);
+  interpMessage("hits %zu", stats.hits);
+  interpMessage("misses %zu", stats.misses);
+  interpMessage("insertions %zu", stats.insertions);
+  interpMessage("replacements %zu", stats.replacements);
+  interpMessage("evictions %zu", stats.evictions);
+  interpMessage("expirations %zu", stats.expirations);
+  return true;
+}
+
+bool
+interpSetBudget(void * const cache, const size_t budget)
+{
+  return redblackCacheSetBudget(cache, budget, interpCost);
+}
+
+bool
+interpSetTTL(void * const cache, const size_t ttl)
+{
+  return redblackCacheSetTTL(cache, ttl, interpClock);
+}
+
+size_t
+interpGetCost(void * const cache)
+{
+  return redblackCacheGetCost(cache);
+}
+
+bool
+interpMeld(void * const dst, void * const src)
+{
+  (void)dst;
+  (void)src;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetTopK(void * const tree, const size_t k)
+{
+  (void)tree;
+  (void)k;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetFinger(void * const tree, const bool finger)
+{
+  (void)tree;
+  (void)finger;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
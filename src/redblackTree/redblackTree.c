@@ -39,7 +39,10 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
+#include "arena.h"
 #include "redblackTree.h"
 #include "redblackTree_private.h"
 
@@ -258,6 +261,35 @@ redblackTreeHasParent(const redblackTreeNode_t * const node)
     }
 }
 
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Number of nodes in a sub-tree.
+ *
+ * \param node pointer to redblackTreeNode_t at the root of the sub-tree
+ * \return number of nodes in the sub-tree. Zero if \e node is \c NULL.
+ */
+static
+size_t
+redblackTreeCount(const redblackTreeNode_t * const node)
+{
+  return (node == NULL) ? 0 : node->count;
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Set the number of nodes in the sub-tree at a node from its children.
+ *
+ * \param node pointer to redblackTreeNode_t
+ */
+static
+void
+redblackTreeUpdateCount(redblackTreeNode_t * const node)
+{
+  node->count = 1+redblackTreeCount(node->left)+redblackTreeCount(node->right);
+}
+
 /**
  * Private helper function for red-black tree implementation.
  *
@@ -308,6 +340,10 @@ redblackTreeRotateRight(redblackTree_t * const tree, redblackTreeNode_t *y)
   /* x becomes y's parent */
   x->right = y;
   y->parent = x;
+
+  /* x now roots the sub-tree that y rooted */
+  x->count = y->count;
+  redblackTreeUpdateCount(y);
 }
 
 /**
@@ -360,6 +396,10 @@ redblackTreeRotateLeft(redblackTree_t * const tree, redblackTreeNode_t *x)
   /* y becomes x's parent */
   y->left = x;
   x->parent = y;
+
+  /* y now roots the sub-tree that x rooted */
+  y->count = x->count;
+  redblackTreeUpdateCount(x);
 }
 
 /**
@@ -371,12 +411,15 @@ redblackTreeRotateLeft(redblackTree_t * const tree, redblackTreeNode_t *x)
  * 
  * \param tree pointer to redblackTree_t
  * \param node pointer to redblackTreeNode_t that was inserted
+ * \return \c true if a red root was painted black, increasing the
+ * black height of the tree
  */
 static
-void 
+bool
 redblackTreeInsertColour(redblackTree_t * const tree, redblackTreeNode_t *node) 
 {
   redblackTreeNode_t *parent, *gparent, *uncle;
+  bool grown;
 
   while (redblackTreeHasParent(node) && redblackTreeIsRed(node->parent))
     {
@@ -465,7 +508,10 @@ redblackTreeInsertColour(redblackTree_t * const tree, redblackTreeNode_t *node)
   /* 
    *  Root node is always painted black 
    */
+  grown = redblackTreeIsRed(tree->root);
   redblackTreeSetBlack(tree->root);
+
+  return grown;
 }
 
 
@@ -770,6 +816,7 @@ redblackTreeRemoveNode(redblackTree_t * const tree,
       succ->parent = node->parent;
       succ->left = node->left;
       succ->right = node->right;
+      succ->count = node->count;
       redblackTreeCopyColour(succ, node);
 
       /* Fix link from parent of node */
@@ -800,6 +847,12 @@ redblackTreeRemoveNode(redblackTree_t * const tree,
         }     
     }
 
+  /* One fewer node in each sub-tree above the removed position */
+  for (succ = parent; succ != NULL; succ = succ->parent)
+    {
+      succ->count = succ->count-1;
+    }
+
   /*
    *  Now fix the colour. If we are deleting a red node, we 
    *  can simply replace it with its child, which must be black.
@@ -983,6 +1036,144 @@ redblackTreeFindMinMax(redblackTree_t * const tree, const compare_e val)
   return node;
 }
 
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Compare two entries that begin with a \e long key. Used in place of the
+ * \e compare callback by a tree created with \e redblackTreeCompLong().
+ *
+ * \param a pointer to an entry beginning with a \e long key
+ * \param b pointer to an entry beginning with a \e long key
+ * \return \e compare_e value
+ */
+static inline
+compare_e
+redblackTreeCompLongKey(const void * const a, const void * const b)
+{
+  const long x = *(const long *)a;
+  const long y = *(const long *)b;
+
+  return (x < y) ? compareLesser : ((y < x) ? compareGreater : compareEqual);
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Compare two entries with the \e compare callback or, if the tree has
+ * \e long keys, inline.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param a pointer to caller's data
+ * \param b pointer to caller's data
+ * \return \e compare_e value
+ */
+static inline
+compare_e
+redblackTreeCompare(const redblackTree_t * const tree,
+                    const void * const a,
+                    const void * const b)
+{
+  if (tree->longKey)
+    {
+      return redblackTreeCompLongKey(a, b);
+    }
+
+  return (tree->compare)(a, b, tree->user);
+}
+
+/**
+ * Template for the private helper functions that search the tree.
+ *
+ * Expands to a function \e NAME(tree,entry,parent,comp) that compares
+ * entries with \e COMPARE(tree,a,b). The function returns the node
+ * matching \e entry or \e NULL. On return \e *parent is the last node
+ * visited and \e *comp is the result of the last comparison. The search
+ * is instantiated once for the \e compare callback and once for \e long
+ * keys so that the comparison in the \e long key search is inlined.
+ */
+#define REDBLACKTREE_SEARCH_TEMPLATE(NAME, COMPARE)                     \
+static                                                                  \
+redblackTreeNode_t *                                                    \
+NAME(redblackTree_t * const tree,                                       \
+     const void * const entry,                                          \
+     redblackTreeNode_t ** const parent,                                \
+     compare_e * const comp)                                            \
+{                                                                       \
+  redblackTreeNode_t *node = tree->root;                                \
+  redblackTreeNode_t *last = NULL;                                      \
+  compare_e c = compareEqual;                                           \
+                                                                        \
+  while (node != NULL)                                                  \
+    {                                                                   \
+      last = node;                                                      \
+      c = COMPARE(tree, entry, node->entry);                            \
+      if (c == compareLesser)                                           \
+        {                                                               \
+          node = node->left;                                            \
+        }                                                               \
+      else if (c == compareGreater)                                     \
+        {                                                               \
+          node = node->right;                                           \
+        }                                                               \
+      else if (c == compareEqual)                                       \
+        {                                                               \
+          break;                                                        \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          c = compareError;                                             \
+          node = NULL;                                                  \
+          break;                                                        \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+  *parent = last;                                                       \
+  *comp = c;                                                            \
+  return node;                                                          \
+}
+
+/** Compare entries with the caller's \e compare callback. */
+#define REDBLACKTREE_COMPARE_CALLBACK(tree, a, b)       \
+  ((tree)->compare)((a), (b), (tree)->user)
+
+/** Compare entries beginning with a \e long key inline. */
+#define REDBLACKTREE_COMPARE_LONG(tree, a, b)   \
+  redblackTreeCompLongKey((a), (b))
+
+REDBLACKTREE_SEARCH_TEMPLATE(redblackTreeSearchCallback,
+                             REDBLACKTREE_COMPARE_CALLBACK)
+
+REDBLACKTREE_SEARCH_TEMPLATE(redblackTreeSearchLong,
+                             REDBLACKTREE_COMPARE_LONG)
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Search for the node matching an entry. See
+ * \e REDBLACKTREE_SEARCH_TEMPLATE.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param entry pointer to caller's data 
+ * \param parent pointer to the last redblackTreeNode_t visited
+ * \param comp pointer to the result of the last comparison
+ * \return pointer to redblackTreeNode_t found. 
+ * \c NULL if not found.
+ */
+static
+redblackTreeNode_t *
+redblackTreeSearch(redblackTree_t * const tree,
+                   const void * const entry,
+                   redblackTreeNode_t ** const parent,
+                   compare_e * const comp)
+{
+  if (tree->longKey)
+    {
+      return redblackTreeSearchLong(tree, entry, parent, comp);
+    }
+
+  return redblackTreeSearchCallback(tree, entry, parent, comp);
+}
+
 /**
  * Private helper function for red-black tree implementation.
  *
@@ -997,7 +1188,7 @@ static
 redblackTreeNode_t *
 redblackTreeFindNode(redblackTree_t * const tree, const void * const entry)
 {
-  redblackTreeNode_t *node;
+  redblackTreeNode_t *node, *parent;
   compare_e comp;
   
   if ((tree == NULL) || (entry == NULL))
@@ -1005,32 +1196,39 @@ redblackTreeFindNode(redblackTree_t * const tree, const void * const entry)
       return NULL;
     }
 
-  /* Search for node */
-  node = tree->root;
-  while (node != NULL) 
+  node = redblackTreeSearch(tree, entry, &parent, &comp);
+  if (comp == compareError)
     {
-      comp = (tree->compare)(entry, node->entry, tree->user);
-      if (comp == compareLesser) 
-        {
-          node = node->left;
-        }
-      else if (comp == compareGreater)
-        {
-          node = node->right;
-        }
-      else if (comp == compareEqual)
-        {
-          return node;
-        }
-      else
-        {
-          (tree->debug)(__func__, __LINE__, tree->user,
-                        "Illegal compare result!");
-          break;
-        }
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Illegal compare result!");
     }
 
-  return NULL;
+  return node;
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Offset of an entry stored in a redblackTreeNode_t rounded up to the
+ * alignment of any type.
+ */
+static const size_t redblackTreeEntryOffset =
+  ((sizeof(redblackTreeNode_t)+_Alignof(max_align_t)-1)/_Alignof(max_align_t))
+  *_Alignof(max_align_t);
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Get a pointer to the entry stored in a node.
+ *
+ * \param node pointer to redblackTreeNode_t
+ * \return \e void pointer to the entry stored in the node
+ */
+static
+void *
+redblackTreeNodeEntry(redblackTreeNode_t * const node)
+{
+  return (void *)(((unsigned char *)node)+redblackTreeEntryOffset);
 }
 
 /**
@@ -1039,12 +1237,15 @@ redblackTreeFindNode(redblackTree_t * const tree, const void * const entry)
  *  Duplicate an entry.
  *
  * \param tree pointer to redblackTree_t
+ * \param node pointer to the redblackTreeNode_t for the entry
  * \param entry pointer to caller's data 
  * \return pointer to duplicated entry
  */
 static
 void *
-redblackTreeDuplicateEntry(redblackTree_t * const tree, void * const entry)
+redblackTreeDuplicateEntry(redblackTree_t * const tree,
+                           redblackTreeNode_t * const node,
+                           void * const entry)
 {
   void *new_entry;
 
@@ -1053,7 +1254,12 @@ redblackTreeDuplicateEntry(redblackTree_t * const tree, void * const entry)
       return NULL;
     }
 
-  if (tree->duplicateEntry != NULL)
+  if (tree->entrySize != 0)
+    {
+      new_entry = redblackTreeNodeEntry(node);
+      memcpy(new_entry, entry, tree->entrySize);
+    }
+  else if (tree->duplicateEntry != NULL)
     {
       new_entry = tree->duplicateEntry(entry, tree->user);
       if (new_entry == NULL)
@@ -1071,226 +1277,1096 @@ redblackTreeDuplicateEntry(redblackTree_t * const tree, void * const entry)
   return new_entry;
 }
 
-redblackTree_t *
-redblackTreeCreate(const redblackTreeAllocFunc_t alloc, 
-                   const redblackTreeDeallocFunc_t dealloc,
-                   const redblackTreeDuplicateEntryFunc_t duplicateEntry,
-                   const redblackTreeDeleteEntryFunc_t deleteEntry,
-                   const redblackTreeDebugFunc_t debug,
-                   const redblackTreeCompFunc_t comp,
-                   void * const user)
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Allocate a node from the arena, if it exists, or with \e alloc().
+ *
+ * \param tree pointer to redblackTree_t
+ * \return pointer to the new redblackTreeNode_t. \e NULL indicates failure.
+ */
+static
+redblackTreeNode_t *
+redblackTreeAllocNode(redblackTree_t * const tree)
 {
-  redblackTree_t *tree; 
-
-  if (debug == NULL)
-    {
-      return NULL;
-    }
-  if (alloc == NULL)
+  if (tree->arena != NULL)
     {
-      debug(__func__, __LINE__, user, "Invalid alloc() function!");
-      return NULL;
+      return (redblackTreeNode_t *)arenaAlloc(tree->arena);
     }
-  if (dealloc == NULL)
+  else
     {
-      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
-      return NULL;
+      return (redblackTreeNode_t *)(tree->alloc)(tree->nodeSize, tree->user);
     }
-  if (comp == NULL)
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Return a node to the arena, if it exists, or to \e dealloc().
+ *
+ * \param tree pointer to redblackTree_t
+ * \param node pointer to redblackTreeNode_t
+ */
+static
+void
+redblackTreeDeallocNode(redblackTree_t * const tree,
+                        redblackTreeNode_t * const node)
+{
+  if (tree->arena != NULL)
     {
-      debug(__func__, __LINE__, user, "Invalid comp() function!");
-      return NULL;
+      arenaFree(tree->arena, node);
     }
-  
-  tree = alloc(sizeof(redblackTree_t), user);
-  if (tree == NULL)
+  else
     {
-      debug(__func__, __LINE__, user, 
-            "Can't allocate %d for redblackTree_t",
-            sizeof(redblackTree_t));
-      return NULL;
+      (tree->dealloc)(node, tree->user);
     }
-  tree->compare = comp;
-  tree->alloc = alloc;
-  tree->dealloc = dealloc;
-  tree->duplicateEntry = duplicateEntry;
-  tree->deleteEntry = deleteEntry;
-  tree->debug = debug;
-  tree->root = NULL;
-  tree->current = NULL;
-  tree->size = 0;
-  tree->user = user;
-
-  return tree;
 }
 
-void *
-redblackTreeFind(redblackTree_t * const tree, void * const entry)
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Build a balanced subtree from a list of nodes in ascending order. The
+ * nodes are linked through their \e right pointers and are taken in order
+ * so that they are placed in the subtree in order. The nodes at the
+ * deepest level of the whole tree, \e redDepth, are coloured red and all
+ * other nodes are coloured black. 
+ *
+ * \param list pointer to the list of redblackTreeNode_t. On return points
+ * to the first node not used.
+ * \param n number of nodes in the subtree
+ * \param depth depth of the root of the subtree
+ * \param redDepth depth of the nodes coloured red
+ * \return pointer to the redblackTreeNode_t at the root of the subtree
+ */
+static
+redblackTreeNode_t *
+redblackTreeBuildSubtree(redblackTreeNode_t ** const list,
+                         const size_t n,
+                         const size_t depth,
+                         const size_t redDepth)
 {
-  redblackTreeNode_t *node;
+  redblackTreeNode_t *left, *node;
 
-  if (tree == NULL)
+  if (n == 0)
     {
       return NULL;
     }
-  if (entry == NULL)
+
+  left = redblackTreeBuildSubtree(list, n/2, depth+1, redDepth);
+
+  node = *list;
+  *list = node->right;
+  node->left = left;
+  if (left != NULL)
     {
-      return NULL;
+      left->parent = node;
     }
-
-  node = redblackTreeFindNode(tree, entry);
-  if (node == NULL)
+  if ((depth == redDepth) && (depth != 0))
     {
-      return NULL;
+      redblackTreeSetRed(node);
     }
   else
     {
-      tree->current = node;
-      return node->entry;
+      redblackTreeSetBlack(node);
+    }
+
+  node->right = redblackTreeBuildSubtree(list, n-(n/2)-1, depth+1, redDepth);
+  if (node->right != NULL)
+    {
+      node->right->parent = node;
     }
+  node->count = n;
+
+  return node;
 }
 
-void *
-redblackTreeInsert(redblackTree_t * const tree, void * const entry)
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Floor of the base 2 logarithm of the number of nodes. This is the depth
+ * of the deepest level of a tree built by halving.
+ *
+ * \param n number of nodes
+ * \return floor(log2(n)). Zero if \e n is zero.
+ */
+static
+size_t
+redblackTreeLog2(const size_t n)
+{
+  size_t k, lg;
+
+  lg = 0;
+  for (k=n; k>1; k=k/2)
+    {
+      lg = lg+1;
+    }
+
+  return lg;
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Find the first node with an entry not less than the given entry.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param entry pointer to caller's data 
+ * \return pointer to redblackTreeNode_t found. \c NULL if not found.
+ */
+static
+redblackTreeNode_t *
+redblackTreeSeekNode(redblackTree_t * const tree, const void * const entry)
 {
   redblackTreeNode_t *node, *parent;
   compare_e comp;
 
-  if (tree == NULL)
+  node = redblackTreeSearch(tree, entry, &parent, &comp);
+  if (comp == compareError)
     {
-      return NULL;
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Illegal compare result!");
+      node = NULL;
     }
-  if (entry == NULL)
+  else if ((node == NULL) && (comp == compareLesser))
     {
-      return NULL;
+      node = parent;
+    }
+  else if ((node == NULL) && (comp == compareGreater))
+    {
+      node = redblackTreeFindNext(parent);
     }
 
-  /* Search for an existing entry */
-  node = tree->root;
-  parent = NULL;
-  comp = compareEqual;
-  while (node != NULL) 
+  return node;
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Deallocate a node removed from the tree and its entry.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param node pointer to redblackTreeNode_t
+ */
+static
+void
+redblackTreeDeleteNode(redblackTree_t * const tree,
+                       redblackTreeNode_t * const node)
+{
+  if ((tree->deleteEntry != NULL) && (node->entry != NULL))
     {
-      parent = node;
-      comp = (tree->compare)(entry, parent->entry, tree->user);
-      if (comp == compareLesser) 
+      (tree->deleteEntry)(node->entry, tree->user);
+    }
+  redblackTreeDeallocNode(tree, node);
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Traverse a subtree in order, deleting the nodes with in-order index in
+ * [first, last) and appending the other nodes to a list linked through
+ * their \e right pointers. The \e right pointer of each node is read
+ * before the node is appended to the list.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param node pointer to the redblackTreeNode_t at the root of the subtree
+ * \param tail pointer to the link at the end of the list
+ * \param index pointer to the in-order index of the next node
+ * \param first index of the first node deleted
+ * \param last index of the node following the last node deleted
+ */
+static
+void
+redblackTreeRangeList(redblackTree_t * const tree,
+                      redblackTreeNode_t * const node,
+                      redblackTreeNode_t *** const tail,
+                      size_t * const index,
+                      const size_t first,
+                      const size_t last)
+{
+  redblackTreeNode_t *right;
+
+  if (node == NULL)
+    {
+      return;
+    }
+
+  right = node->right;
+  redblackTreeRangeList(tree, node->left, tail, index, first, last);
+  if ((*index >= first) && (*index < last))
+    {
+      redblackTreeDeleteNode(tree, node);
+    }
+  else
+    {
+      **tail = node;
+      *tail = &(node->right);
+    }
+  *index = *index+1;
+  redblackTreeRangeList(tree, right, tail, index, first, last);
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Black height of a sub-tree. The number of black nodes on any path from
+ * the root of the sub-tree to a leaf, including the root.
+ *
+ * \param node pointer to redblackTreeNode_t at the root of the sub-tree
+ * \return black height of the sub-tree. Zero if \e node is \c NULL.
+ */
+static
+size_t
+redblackTreeBlackHeight(const redblackTreeNode_t *node)
+{
+  size_t height;
+
+  height = 0;
+  for ( ; node != NULL; node = node->left)
+    {
+      if (redblackTreeIsBlack(node))
         {
-          node = node->left;
+          height = height+1;
         }
-      else if (comp == compareGreater) 
+    }
+
+  return height;
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Join two sub-trees and a node. All the entries in \e left are less
+ * than the entry of \e node and all the entries in \e right are greater.
+ * The node is attached on the spine of the sub-tree with the greater 
+ * black height at the first black node with the black height of the
+ * other sub-tree and the colour is fixed as after an insertion. The cost
+ * is O(1+|leftHeight-rightHeight|). The \e root of \e tree is used by the
+ * rotations and is overwritten.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param left pointer to redblackTreeNode_t at the root of the left sub-tree
+ * \param leftHeight black height of \e left
+ * \param node pointer to redblackTreeNode_t to join
+ * \param right pointer to redblackTreeNode_t at the root of the right 
+ * sub-tree
+ * \param rightHeight black height of \e right
+ * \param height pointer to the black height of the joined tree
+ * \return pointer to the redblackTreeNode_t at the root of the joined tree
+ */
+static
+redblackTreeNode_t *
+redblackTreeJoinNodes(redblackTree_t * const tree,
+                      redblackTreeNode_t * const left,
+                      size_t leftHeight,
+                      redblackTreeNode_t * const node,
+                      redblackTreeNode_t * const right,
+                      size_t rightHeight,
+                      size_t * const height)
+{
+  redblackTreeNode_t *child, *parent;
+  size_t h;
+
+  /* The roots of the sub-trees are painted black */
+  if (left != NULL)
+    {
+      left->parent = NULL;
+      if (redblackTreeIsRed(left))
         {
-          node = node->right;
+          redblackTreeSetBlack(left);
+          leftHeight = leftHeight+1;
         }
-      else if (comp == compareEqual)
+    }
+  if (right != NULL)
+    {
+      right->parent = NULL;
+      if (redblackTreeIsRed(right))
+        {
+          redblackTreeSetBlack(right);
+          rightHeight = rightHeight+1;
+        }
+    }
+
+  /* Equal black heights */
+  if (leftHeight == rightHeight)
+    {
+      node->parent = NULL;
+      node->left = left;
+      node->right = right;
+      if (left != NULL)
+        {
+          left->parent = node;
+        }
+      if (right != NULL)
+        {
+          right->parent = node;
+        }
+      redblackTreeSetBlack(node);
+      redblackTreeUpdateCount(node);
+      tree->root = node;
+      *height = leftHeight+1;
+      return node;
+    }
+
+  /* Find the black node on the spine of the higher sub-tree */
+  parent = NULL;
+  if (leftHeight > rightHeight)
+    {
+      child = left;
+      h = leftHeight;
+      while ((child != NULL) && 
+             ((h != rightHeight) || redblackTreeIsRed(child)))
         {
-          if (tree->deleteEntry != NULL)
+          if (redblackTreeIsBlack(child))
             {
-              (tree->deleteEntry)(node->entry, tree->user);
+              h = h-1;
             }
-          node->entry = redblackTreeDuplicateEntry(tree, entry);
-          if (node->entry == NULL)
+          parent = child;
+          child = child->right;
+        }
+      node->left = child;
+      node->right = right;
+      parent->right = node;
+      tree->root = left;
+      *height = leftHeight;
+    }
+  else
+    {
+      child = right;
+      h = rightHeight;
+      while ((child != NULL) && 
+             ((h != leftHeight) || redblackTreeIsRed(child)))
+        {
+          if (redblackTreeIsBlack(child))
             {
-              (tree->debug)(__func__, __LINE__, tree->user,
-                            "redblackTreeDuplicateEntry() failed!");
-              return NULL;
+              h = h-1;
             }
-          tree->current = node;
-          return node->entry;
+          parent = child;
+          child = child->left;
         }
-      else
+      node->left = left;
+      node->right = child;
+      parent->left = node;
+      tree->root = right;
+      *height = rightHeight;
+    }
+  node->parent = parent;
+  if (node->left != NULL)
+    {
+      node->left->parent = node;
+    }
+  if (node->right != NULL)
+    {
+      node->right->parent = node;
+    }
+  redblackTreeSetRed(node);
+  redblackTreeUpdateCount(node);
+
+  /* The lower sub-tree and node are added to each sub-tree above */
+  h = redblackTreeCount(node)-redblackTreeCount(child);
+  for ( ; parent != NULL; parent = parent->parent)
+    {
+      parent->count = parent->count+h;
+    }
+
+  /* Fix the red-black property */
+  if (redblackTreeInsertColour(tree, node))
+    {
+      *height = *height+1;
+    }
+
+  return tree->root;
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Split a sub-tree into the nodes with entries less than an entry and the
+ * nodes with entries not less than the entry. The path to the entry is
+ * followed and the sub-trees hanging from the path are joined to the left
+ * or right result. The black heights telescope so that the cost is
+ * O(lg N). The \e root of \e tree is used by the joins and is 
+ * overwritten.
+ *
+ * \param tree pointer to redblackTree_t
+ * \param node pointer to redblackTreeNode_t at the root of the sub-tree
+ * \param height black height of \e node
+ * \param entry pointer to caller's data 
+ * \param left pointer to the root of the lesser nodes
+ * \param leftHeight pointer to the black height of \e left
+ * \param right pointer to the root of the greater or equal nodes
+ * \param rightHeight pointer to the black height of \e right
+ */
+static
+void
+redblackTreeSplitNode(redblackTree_t * const tree,
+                      redblackTreeNode_t * const node,
+                      const size_t height,
+                      const void * const entry,
+                      redblackTreeNode_t ** const left,
+                      size_t * const leftHeight,
+                      redblackTreeNode_t ** const right,
+                      size_t * const rightHeight)
+{
+  redblackTreeNode_t *lower, *higher, *split;
+  size_t childHeight, splitHeight;
+  compare_e comp;
+
+  if (node == NULL)
+    {
+      *left = NULL;
+      *leftHeight = 0;
+      *right = NULL;
+      *rightHeight = 0;
+      return;
+    }
+
+  lower = node->left;
+  higher = node->right;
+  childHeight = redblackTreeIsBlack(node) ? height-1 : height;
+
+  comp = redblackTreeCompare(tree, entry, node->entry);
+  if ((comp != compareLesser) && (comp != compareEqual) && 
+      (comp != compareGreater))
+    {
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Illegal compare result!");
+    }
+  if (comp == compareGreater)
+    {
+      /* Node is less than entry */
+      redblackTreeSplitNode(tree, higher, childHeight, entry, 
+                            &split, &splitHeight, right, rightHeight);
+      *left = redblackTreeJoinNodes(tree, lower, childHeight, node,
+                                    split, splitHeight, leftHeight);
+    }
+  else
+    {
+      /* Node is not less than entry */
+      redblackTreeSplitNode(tree, lower, childHeight, entry, 
+                            left, leftHeight, &split, &splitHeight);
+      *right = redblackTreeJoinNodes(tree, split, splitHeight, node,
+                                     higher, childHeight, rightHeight);
+    }
+}
+
+/**
+ * Private helper function for red-black tree implementation.
+ *
+ * Create an empty tree with the same callbacks and entry storage as an
+ * existing tree. The new tree does not have an arena.
+ *
+ * \param tree pointer to redblackTree_t
+ * \return pointer to the new redblackTree_t. \c NULL indicates failure.
+ */
+static
+redblackTree_t *
+redblackTreeCreateEmpty(const redblackTree_t * const tree)
+{
+  redblackTree_t *empty;
+
+  empty = (tree->alloc)(sizeof(redblackTree_t), tree->user);
+  if (empty == NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, 
+                    "Can't allocate %zu for redblackTree_t",
+                    sizeof(redblackTree_t));
+      return NULL;
+    }
+  *empty = *tree;
+  empty->root = NULL;
+  empty->current = NULL;
+  empty->size = 0;
+  empty->arena = NULL;
+
+  return empty;
+}
+
+compare_e
+redblackTreeCompLong(const void * const a,
+                     const void * const b,
+                     void * const user)
+{
+  (void)user;
+
+  return redblackTreeCompLongKey(a, b);
+}
+
+redblackTree_t *
+redblackTreeCreate(const redblackTreeAllocFunc_t alloc, 
+                   const redblackTreeDeallocFunc_t dealloc,
+                   const redblackTreeDuplicateEntryFunc_t duplicateEntry,
+                   const redblackTreeDeleteEntryFunc_t deleteEntry,
+                   const redblackTreeDebugFunc_t debug,
+                   const redblackTreeCompFunc_t comp,
+                   void * const user)
+{
+  redblackTree_t *tree; 
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (comp == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      return NULL;
+    }
+  
+  tree = alloc(sizeof(redblackTree_t), user);
+  if (tree == NULL)
+    {
+      debug(__func__, __LINE__, user, 
+            "Can't allocate %d for redblackTree_t",
+            sizeof(redblackTree_t));
+      return NULL;
+    }
+  tree->compare = comp;
+  tree->alloc = alloc;
+  tree->dealloc = dealloc;
+  tree->duplicateEntry = duplicateEntry;
+  tree->deleteEntry = deleteEntry;
+  tree->debug = debug;
+  tree->root = NULL;
+  tree->current = NULL;
+  tree->size = 0;
+  tree->nodeSize = sizeof(redblackTreeNode_t);
+  tree->entrySize = 0;
+  tree->arena = NULL;
+  tree->longKey = (comp == redblackTreeCompLong);
+  tree->user = user;
+
+  return tree;
+}
+
+redblackTree_t *
+redblackTreeCreateWithArena(const size_t chunkNodes,
+                            const redblackTreeAllocFunc_t alloc, 
+                            const redblackTreeDeallocFunc_t dealloc,
+                            const redblackTreeDuplicateEntryFunc_t 
+                            duplicateEntry,
+                            const redblackTreeDeleteEntryFunc_t deleteEntry,
+                            const redblackTreeDebugFunc_t debug,
+                            const redblackTreeCompFunc_t comp,
+                            void * const user)
+{
+  redblackTree_t *tree; 
+
+  tree = redblackTreeCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                            debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  tree->arena = arenaCreate(tree->nodeSize, chunkNodes,
+                            alloc, dealloc, debug, user);
+  if (tree->arena == NULL)
+    {
+      debug(__func__, __LINE__, user, "Can't create arena!");
+      redblackTreeDestroy(tree);
+      return NULL;
+    }
+
+  return tree;
+}
+
+redblackTree_t *
+redblackTreeCreateInline(const size_t entrySize,
+                         const size_t chunkNodes,
+                         const redblackTreeAllocFunc_t alloc,
+                         const redblackTreeDeallocFunc_t dealloc,
+                         const redblackTreeDebugFunc_t debug,
+                         const redblackTreeCompFunc_t comp,
+                         void * const user)
+{
+  redblackTree_t *tree; 
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (entrySize == 0)
+    {
+      debug(__func__, __LINE__, user, "Request for entrySize==0!");
+      return NULL;
+    }
+
+  tree = redblackTreeCreate(alloc, dealloc, NULL, NULL, debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  tree->entrySize = entrySize;
+  tree->nodeSize = redblackTreeEntryOffset+entrySize;
+
+  if (chunkNodes != 0)
+    {
+      tree->arena = arenaCreate(tree->nodeSize, chunkNodes,
+                                alloc, dealloc, debug, user);
+      if (tree->arena == NULL)
+        {
+          debug(__func__, __LINE__, user, "Can't create arena!");
+          redblackTreeDestroy(tree);
+          return NULL;
+        }
+    }
+
+  return tree;
+}
+
+void *
+redblackTreeFind(redblackTree_t * const tree, void * const entry)
+{
+  redblackTreeNode_t *node;
+
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      return NULL;
+    }
+
+  node = redblackTreeFindNode(tree, entry);
+  if (node == NULL)
+    {
+      return NULL;
+    }
+  else
+    {
+      tree->current = node;
+      return node->entry;
+    }
+}
+
+void *
+redblackTreeInsert(redblackTree_t * const tree, void * const entry)
+{
+  redblackTreeNode_t *node, *parent;
+  compare_e comp;
+
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      return NULL;
+    }
+
+  /* Search for an existing entry */
+  node = redblackTreeSearch(tree, entry, &parent, &comp);
+  if (comp == compareError)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Illegal compare result!");
+      return NULL;
+    }
+  if (node != NULL)
+    {
+      if (tree->deleteEntry != NULL)
+        {
+          (tree->deleteEntry)(node->entry, tree->user);
+        }
+      node->entry = redblackTreeDuplicateEntry(tree, node, entry);
+      if (node->entry == NULL)
         {
           (tree->debug)(__func__, __LINE__, tree->user,
-                        "Illegal compare result!");
+                        "redblackTreeDuplicateEntry() failed!");
           return NULL;
         }
+      tree->current = node;
+      return node->entry;
+    }
+
+  /* Not found. Create a node for the new entry */
+  node = redblackTreeAllocNode(tree);
+  if (node == NULL)
+    {
+      return NULL;
+    }
+  node->entry = redblackTreeDuplicateEntry(tree, node, entry);
+  if (node->entry == NULL)
+    {
+      redblackTreeDeallocNode(tree, node);
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "redblackTreeDuplicateEntry() failed!");
+      return NULL;
+    }
+  node->parent = parent;
+  node->left = node->right = NULL;
+  node->count = 1;
+  redblackTreeSetRed(node);
+  if (parent != NULL) 
+    {
+      if (comp == compareLesser) 
+        {
+          parent->left = node;
+        }
+      else 
+        {
+          parent->right = node;
+        }
+    }
+  else
+    {
+      tree->root = node;
+    }
+
+  /* One more node in each sub-tree above the new node */
+  for (; parent != NULL; parent = parent->parent)
+    {
+      parent->count = parent->count+1;
+    }
+
+  /* Fix the red-black property */
+  redblackTreeInsertColour(tree, node);
+
+  /* Done */
+  tree->current = node;
+  tree->size = tree->size+1;
+
+  return node->entry;
+}
+
+void *
+redblackTreeRemove(redblackTree_t * const tree, void * const entry) 
+{
+  redblackTreeNode_t *old;
+  void *oldEntry;
+
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  if (entry == NULL)
+    {
+      return NULL;
+    }
+
+  /* Remove node from tree */
+  old = redblackTreeFindNode(tree, entry);
+  if (tree->current == old)
+    {
+      tree->current = NULL;
+    }
+  if (old == NULL)
+    {
+      return entry;
+    }
+  if (redblackTreeRemoveNode(tree, old) == NULL)
+    {
+      return entry;
+    }
+ 
+  /* Deallocate the deleted node and entry */
+  oldEntry = old->entry;
+  redblackTreeDeallocNode(tree, old);
+  if (tree->entrySize != 0)
+    {
+      /* The entry was stored in the deallocated node */
+      return NULL;
+    }
+  else if(tree->deleteEntry != NULL)
+    {
+      (tree->deleteEntry)(oldEntry, tree->user);
+      return NULL;
+    }
+  else
+    {
+      return oldEntry;
+    }
+}
+
+size_t
+redblackTreeRemoveRange(redblackTree_t * const tree,
+                        const void * const lo,
+                        const void * const hi)
+{
+  redblackTreeNode_t *node, *next, *list, **tail;
+  size_t first, last, k, index;
+
+  if ((tree == NULL) || (lo == NULL) || (hi == NULL))
+    {
+      return 0;
+    }
+  if (redblackTreeCompare(tree, lo, hi) != compareLesser)
+    {
+      return 0;
+    }
+
+  /* The sub-tree node counts give the number of entries in the range */
+  first = redblackTreeRank(tree, lo);
+  last = redblackTreeRank(tree, hi);
+  if (last <= first)
+    {
+      return 0;
+    }
+  k = last-first;
+  tree->current = NULL;
+
+  /* 
+   * Removing nodes one at a time costs O(lg N) each. If removing the range
+   * costs more than rebuilding the tree from the remaining nodes in O(N)
+   * then rebuild the tree.
+   */
+  if ((k*(redblackTreeLog2(tree->size)+1)) > tree->size)
+    {
+      list = NULL;
+      tail = &list;
+      index = 0;
+      redblackTreeRangeList(tree, tree->root, &tail, &index, first, last);
+      *tail = NULL;
+      tree->size = tree->size-k;
+      tree->root = redblackTreeBuildSubtree(&list, tree->size, 0, 
+                                            redblackTreeLog2(tree->size));
+      if (tree->root != NULL)
+        {
+          tree->root->parent = NULL;
+        }
+      return k;
+    }
+
+  /* Otherwise step through the range without searching from the root */
+  node = redblackTreeSeekNode(tree, lo);
+  for (index=0; (index<k) && (node != NULL); index++)
+    {
+      next = redblackTreeFindNext(node);
+      if (redblackTreeRemoveNode(tree, node) != NULL)
+        {
+          redblackTreeDeleteNode(tree, node);
+        }
+      node = next;
+    }
+
+  return k;
+}
+
+bool
+redblackTreeBuildFromSorted(redblackTree_t * const tree,
+                            void * const * const entries,
+                            const size_t n)
+{
+  redblackTreeNode_t *list, *last, *node;
+  size_t k, redDepth;
+
+  if (tree == NULL)
+    {
+      return false;
+    }
+  if ((entries == NULL) && (n != 0))
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, "entries == NULL!");
+      return false;
+    }
+  if (tree->root != NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, "tree is not empty!");
+      return false;
+    }
+
+  /* Allocate the nodes and duplicate the entries before building */
+  list = NULL;
+  last = NULL;
+  for (k=0; k<n; k++)
+    {
+      node = NULL;
+      if (entries[k] != NULL)
+        {
+          node = redblackTreeAllocNode(tree);
+        }
+      if (node != NULL)
+        {
+          node->entry = redblackTreeDuplicateEntry(tree, node, entries[k]);
+          if (node->entry == NULL)
+            {
+              redblackTreeDeallocNode(tree, node);
+              node = NULL;
+            }
+        }
+      if (node == NULL)
+        {
+          (tree->debug)(__func__, __LINE__, tree->user,
+                      "Can't create node for entry %zu!", k);
+          while (list != NULL)
+            {
+              node = list;
+              list = list->right;
+              if (tree->deleteEntry != NULL)
+                {
+                  (tree->deleteEntry)(node->entry, tree->user);
+                }
+              redblackTreeDeallocNode(tree, node);
+            }
+          return false;
+        }
+      node->right = NULL;
+      if (last == NULL)
+        {
+          list = node;
+        }
+      else
+        {
+          last->right = node;
+        }
+      last = node;
+    }
+
+  /* The deepest level of a tree built by halving has depth floor(log2(n)) */
+  redDepth = redblackTreeLog2(n);
+
+  tree->root = redblackTreeBuildSubtree(&list, n, 0, redDepth);
+  if (tree->root != NULL)
+    {
+      tree->root->parent = NULL;
     }
+  tree->current = NULL;
+  tree->size = n;
 
-  /* Not found. Create a node for the new entry */
-  node = 
-    (redblackTreeNode_t *)(tree->alloc)(sizeof(redblackTreeNode_t), tree->user);
-  if (node == NULL)
+  return true;
+}
+
+bool
+redblackTreeSplit(redblackTree_t * const tree,
+                  const void * const entry,
+                  redblackTree_t ** const left,
+                  redblackTree_t ** const right)
+{
+  redblackTreeNode_t *leftRoot, *rightRoot;
+  size_t leftHeight, rightHeight;
+
+  if ((tree == NULL) || (entry == NULL) || (left == NULL) || (right == NULL))
     {
-      return NULL;
+      return false;
     }
-  node->entry = redblackTreeDuplicateEntry(tree, entry);
-  if (node->entry == NULL)
+  if (tree->arena != NULL)
     {
-      (tree->dealloc)(node, tree->user);
-      (tree->debug)(__func__, __LINE__, tree->user,
-                    "redblackTreeDuplicateEntry() failed!");
-      return NULL;
+      (tree->debug)(__func__, __LINE__, tree->user, 
+                    "Can't split a tree with an arena!");
+      return false;
     }
-  node->parent = parent;
-  node->left = node->right = NULL;
-  redblackTreeSetRed(node);
-  if (parent != NULL) 
+
+  *left = redblackTreeCreateEmpty(tree);
+  *right = redblackTreeCreateEmpty(tree);
+  if ((*left == NULL) || (*right == NULL))
     {
-      if (comp == compareLesser) 
+      if (*left != NULL)
         {
-          parent->left = node;
+          (tree->dealloc)(*left, tree->user);
         }
-      else 
+      if (*right != NULL)
         {
-          parent->right = node;
+          (tree->dealloc)(*right, tree->user);
         }
+      *left = NULL;
+      *right = NULL;
+      return false;
     }
-  else
+
+  /* Move the nodes to the new trees */
+  redblackTreeSplitNode(tree, tree->root, redblackTreeBlackHeight(tree->root),
+                        entry, &leftRoot, &leftHeight, &rightRoot, &rightHeight);
+  if (leftRoot != NULL)
     {
-      tree->root = node;
+      redblackTreeSetBlack(leftRoot);
+      (*left)->root = leftRoot;
+      (*left)->size = leftRoot->count;
     }
+  if (rightRoot != NULL)
+    {
+      redblackTreeSetBlack(rightRoot);
+      (*right)->root = rightRoot;
+      (*right)->size = rightRoot->count;
+    }
+  tree->root = NULL;
+  tree->current = NULL;
+  tree->size = 0;
 
-  /* Fix the red-black property */
-  redblackTreeInsertColour(tree, node);
-
-  /* Done */
-  tree->current = node;
-  tree->size = tree->size+1;
-
-  return node->entry;
+  return true;
 }
 
-void *
-redblackTreeRemove(redblackTree_t * const tree, void * const entry) 
+bool
+redblackTreeJoin(redblackTree_t * const left, redblackTree_t * const right)
 {
-  redblackTreeNode_t *old;
-  void *oldEntry;
+  redblackTreeNode_t *node, *max;
+  size_t height;
 
-  if (tree == NULL)
+  if ((left == NULL) || (right == NULL) || (left == right))
     {
-      return NULL;
+      return false;
     }
-  if (entry == NULL)
+  if ((left->arena != NULL) || (right->arena != NULL))
     {
-      return NULL;
+      (left->debug)(__func__, __LINE__, left->user, 
+                    "Can't join a tree with an arena!");
+      return false;
     }
-
-  /* Remove node from tree */
-  old = redblackTreeFindNode(tree, entry);
-  if (tree->current == old)
+  if ((left->entrySize != right->entrySize) || 
+      (left->duplicateEntry != right->duplicateEntry) ||
+      (left->deleteEntry != right->deleteEntry))
     {
-      tree->current = NULL;
+      (left->debug)(__func__, __LINE__, left->user, 
+                    "Can't join trees with different entries!");
+      return false;
     }
-  if (old == NULL)
+  if ((left->compare != right->compare) ||
+      (left->alloc != right->alloc) ||
+      (left->dealloc != right->dealloc) ||
+      (left->user != right->user))
     {
-      return entry;
+      (left->debug)(__func__, __LINE__, left->user, 
+                    "Can't join trees with different callbacks!");
+      return false;
     }
-  if (redblackTreeRemoveNode(tree, old) == NULL)
+  if (right->root == NULL)
     {
-      return entry;
+      return true;
     }
- 
-  /* Deallocate the deleted node and entry */
-  oldEntry = old->entry;
-  (tree->dealloc)(old, tree->user);
-  if(tree->deleteEntry != NULL)
+
+  /* Check the order of the trees */
+  if (left->root != NULL)
     {
-      (tree->deleteEntry)(oldEntry, tree->user);
-      return NULL;
+      max = redblackTreeFindMinMax(left, compareGreater);
+      node = redblackTreeFindMinMax(right, compareLesser);
+      if (redblackTreeCompare(left, max->entry, node->entry) != compareLesser)
+        {
+          (left->debug)(__func__, __LINE__, left->user, 
+                        "Entries in left tree not less than right tree!");
+          return false;
+        }
+
+      /* Join the trees at the minimum node of the right tree */
+      (void)redblackTreeRemoveNode(right, node);
+      left->root = redblackTreeJoinNodes(left, 
+                                         left->root,
+                                         redblackTreeBlackHeight(left->root),
+                                         node,
+                                         right->root,
+                                         redblackTreeBlackHeight(right->root),
+                                         &height);
     }
   else
     {
-      return oldEntry;
+      left->root = right->root;
     }
+  left->size = left->root->count;
+  left->current = NULL;
+  right->root = NULL;
+  right->current = NULL;
+  right->size = 0;
+
+  return true;
 }
 
 void
@@ -1316,7 +2392,7 @@ redblackTreeClear(redblackTree_t * const tree)
             {
               (tree->deleteEntry)(node->entry, tree->user);
             }
-          tree->dealloc(node, tree->user);
+          redblackTreeDeallocNode(tree, node);
         }
       node = next;
     }
@@ -1333,6 +2409,7 @@ redblackTreeDestroy(redblackTree_t * const tree)
 
   /* Delete all nodes */
   redblackTreeClear(tree);
+  arenaDestroy(tree->arena);
 
   /* Deallocate tree */
   (tree->dealloc)(tree, tree->user);
@@ -1458,7 +2535,7 @@ redblackTreeGetNext(redblackTree_t * const tree, const void * const entry)
 
   /* Check current node */
   if ((tree->current != NULL) && 
-      ((tree->compare)(entry, tree->current->entry, tree->user) 
+      (redblackTreeCompare(tree, entry, tree->current->entry) 
        == compareEqual))
     {
       node = tree->current;
@@ -1493,7 +2570,7 @@ redblackTreeGetPrevious(redblackTree_t * const tree, const void * const entry)
 
   /* Check current node */
   if ((tree->current != NULL) && 
-      ((tree->compare)(entry, tree->current->entry, tree->user) 
+      (redblackTreeCompare(tree, entry, tree->current->entry) 
        == compareEqual))
     {
       node = tree->current;
@@ -1532,7 +2609,7 @@ redblackTreeGetLower(redblackTree_t * const tree, const void * const entry)
   lower = node;
   while (node != NULL) 
     {
-      comp = (tree->compare)(entry, node->entry, tree->user);
+      comp = redblackTreeCompare(tree, entry, node->entry);
       if (comp == compareLesser) 
         {
           lower = node->left;
@@ -1596,7 +2673,7 @@ redblackTreeGetUpper(redblackTree_t * const tree, const void * const entry)
   upper = node;
   while (node != NULL) 
     {
-      comp = (tree->compare)(entry, node->entry, tree->user);
+      comp = redblackTreeCompare(tree, entry, node->entry);
       if (comp == compareLesser) 
         {
           upper = node->left;
@@ -1640,6 +2717,200 @@ redblackTreeGetUpper(redblackTree_t * const tree, const void * const entry)
     }
 }
 
+void *
+redblackTreeSelect(redblackTree_t * const tree, const size_t k)
+{
+  redblackTreeNode_t *node;
+  size_t i, left;
+
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  if (k >= tree->size)
+    {
+      return NULL;
+    }
+
+  /* Descend, subtracting the nodes to the left of the path */
+  i = k;
+  node = tree->root;
+  while (node != NULL)
+    {
+      left = redblackTreeCount(node->left);
+      if (i < left)
+        {
+          node = node->left;
+        }
+      else if (i > left)
+        {
+          i = i-(left+1);
+          node = node->right;
+        }
+      else
+        {
+          break;
+        }
+    }
+
+  return (node == NULL) ? NULL : node->entry;
+}
+
+size_t
+redblackTreeRank(redblackTree_t * const tree, const void * const entry)
+{
+  redblackTreeNode_t *node;
+  compare_e comp;
+  size_t rank;
+
+  if ((tree == NULL) || (entry == NULL))
+    {
+      return 0;
+    }
+
+  /* Descend, adding the nodes to the left of the path */
+  rank = 0;
+  node = tree->root;
+  while (node != NULL)
+    {
+      comp = redblackTreeCompare(tree, entry, node->entry);
+      if (comp == compareLesser)
+        {
+          node = node->left;
+        }
+      else if (comp == compareGreater)
+        {
+          rank = rank+redblackTreeCount(node->left)+1;
+          node = node->right;
+        }
+      else if (comp == compareEqual)
+        {
+          rank = rank+redblackTreeCount(node->left);
+          break;
+        }
+      else
+        {
+          (tree->debug)(__func__, __LINE__, tree->user,
+                        "Illegal compare result!");
+          break;
+        }
+    }
+
+  return rank;
+}
+
+redblackTreeCursor_t *
+redblackTreeCursorCreate(redblackTree_t * const tree)
+{
+  redblackTreeCursor_t *cursor;
+
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  cursor = (tree->alloc)(sizeof(redblackTreeCursor_t), tree->user);
+  if (cursor == NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Can't allocate %zu for redblackTreeCursor_t",
+                    sizeof(redblackTreeCursor_t));
+      return NULL;
+    }
+  cursor->tree = tree;
+  cursor->node = NULL;
+
+  return cursor;
+}
+
+void
+redblackTreeCursorDestroy(redblackTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return;
+    }
+
+  (cursor->tree->dealloc)(cursor, cursor->tree->user);
+}
+
+void *
+redblackTreeCursorSeek(redblackTreeCursor_t * const cursor,
+                       const void * const entry)
+{
+  if ((cursor == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  cursor->node = redblackTreeSeekNode(cursor->tree, entry);
+
+  return (cursor->node == NULL) ? NULL : cursor->node->entry;
+}
+
+void *
+redblackTreeCursorFirst(redblackTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = redblackTreeFindMinMax(cursor->tree, compareLesser);
+
+  return (cursor->node == NULL) ? NULL : cursor->node->entry;
+}
+
+void *
+redblackTreeCursorLast(redblackTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = redblackTreeFindMinMax(cursor->tree, compareGreater);
+
+  return (cursor->node == NULL) ? NULL : cursor->node->entry;
+}
+
+void *
+redblackTreeCursorNext(redblackTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = redblackTreeFindNext(cursor->node);
+
+  return (cursor->node == NULL) ? NULL : cursor->node->entry;
+}
+
+void *
+redblackTreeCursorPrevious(redblackTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = redblackTreeFindPrevious(cursor->node);
+
+  return (cursor->node == NULL) ? NULL : cursor->node->entry;
+}
+
+void *
+redblackTreeCursorEntry(const redblackTreeCursor_t * const cursor)
+{
+  if ((cursor == NULL) || (cursor->node == NULL))
+    {
+      return NULL;
+    }
+
+  return cursor->node->entry;
+}
+
 bool
 redblackTreeWalk(redblackTree_t * const tree, const redblackTreeWalkFunc_t walk)
 {
@@ -1669,6 +2940,49 @@ redblackTreeWalk(redblackTree_t * const tree, const redblackTreeWalkFunc_t walk)
   return true;
 }
 
+bool
+redblackTreeWalkRange(redblackTree_t * const tree, 
+                      const void * const lo,
+                      const void * const hi,
+                      const redblackTreeWalkFunc_t walk)
+{
+  redblackTreeNode_t *node, *nextNode;
+  compare_e comp;
+
+  if ((tree == NULL) || (lo == NULL) || (hi == NULL))
+    {
+      return false;
+    }
+  if (walk == NULL)
+    {
+      return false;
+    }
+
+  node = redblackTreeSeekNode(tree, lo);
+  while (node != NULL)
+    {
+      comp = redblackTreeCompare(tree, node->entry, hi);
+      if ((comp == compareEqual) || (comp == compareGreater))
+        {
+          break;
+        }
+      else if (comp != compareLesser)
+        {
+          (tree->debug)(__func__, __LINE__, tree->user,
+                        "Illegal compare result!");
+          return false;
+        }
+      nextNode = redblackTreeFindNext(node); 
+      if (walk(node->entry, tree->user) == false)
+        {
+          return false;
+        }
+      node = nextNode; 
+    }
+
+  return true;
+}
+
 bool
 redblackTreeCheck(redblackTree_t * const tree)
 {
@@ -1750,6 +3064,13 @@ redblackTreeCheck(redblackTree_t * const tree)
                         "No link from parent node!");
           return false;
         }
+      if (node->count != 
+          1+redblackTreeCount(node->left)+redblackTreeCount(node->right))
+        {
+          (tree->debug)(__func__, __LINE__, tree->user,
+                        "Wrong sub-tree node count!");
+          return false;
+        }
 
       node = redblackTreeFindNext(node);
     }
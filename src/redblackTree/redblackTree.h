@@ -75,7 +75,12 @@ using std::size_t;
 /**
  * \e redblackTree_t structure. An opaque type for a red-black tree.
  */
-typedef struct redblackTree_t redblackTree_t; 
+typedef struct redblackTree_t redblackTree_t;
+
+/**
+ * \e redblackTreeCursor_t structure. An opaque type for a position in a tree.
+ */
+typedef struct redblackTreeCursor_t redblackTreeCursor_t; 
 
 /**
  * \e redblackTree_t memory allocator.
@@ -165,6 +170,22 @@ typedef compare_e (*redblackTreeCompFunc_t)(const void * const a,
  */
 typedef bool (*redblackTreeWalkFunc_t)(void * const entry, void * const user);
 
+/**
+ * Compare two entries with \e long keys.
+ * 
+ * Compares entries that begin with a \e long key. A tree created with
+ * this function as the \e comp callback does not call it. Instead the
+ * tree uses a specialisation of the search that compares the keys inline.
+ *
+ * \param a pointer to an entry beginning with a \e long key
+ * \param b pointer to an entry beginning with a \e long key
+ * \param user \e void pointer to user data (unused)
+ * \return \e compare_e value
+ */
+compare_e redblackTreeCompLong(const void * const a,
+                               const void * const b,
+                               void * const user);
+
 /**
  * Create an empty red-black tree.
  * 
@@ -188,6 +209,64 @@ redblackTree_t *redblackTreeCreate
  const redblackTreeCompFunc_t comp,
  void * const user);
 
+/**
+ * Create an empty red-black tree with an arena for the tree nodes.
+ * 
+ * Creates and initialises an empty \e redblackTree_t instance. The tree
+ * nodes are allocated in chunks of \e chunkNodes nodes and nodes that
+ * are removed are recycled by later insertions. The chunks are
+ * deallocated when the tree is destroyed.
+ *
+ * \param chunkNodes number of tree nodes allocated in each chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for callers entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e redblackTree_t. \e NULL indicates failure
+ */
+redblackTree_t *redblackTreeCreateWithArena
+(const size_t chunkNodes,
+ const redblackTreeAllocFunc_t alloc, 
+ const redblackTreeDeallocFunc_t dealloc,
+ const redblackTreeDuplicateEntryFunc_t duplicateEntry,
+ const redblackTreeDeleteEntryFunc_t deleteEntry,
+ const redblackTreeDebugFunc_t debug,
+ const redblackTreeCompFunc_t comp,
+ void * const user);
+
+/**
+ * Create an empty red-black tree storing entries in the tree nodes.
+ * 
+ * Creates and initialises an empty \e redblackTree_t instance that copies
+ * each entry of \e entrySize bytes into the tree node rather than storing
+ * a pointer to the caller's entry data. The entry pointers returned by the
+ * tree refer to the copy in the node and are valid until that entry is
+ * removed. A removed entry is not returned to the caller. There are no
+ * \e duplicateEntry and \e deleteEntry callbacks. If \e chunkNodes is
+ * not zero then the tree nodes are allocated from an arena with
+ * \e chunkNodes nodes in each chunk.
+ *
+ * \param entrySize size in bytes of each entry
+ * \param chunkNodes number of tree nodes allocated in each arena chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e redblackTree_t. \e NULL indicates failure
+ */
+redblackTree_t *redblackTreeCreateInline
+(const size_t entrySize,
+ const size_t chunkNodes,
+ const redblackTreeAllocFunc_t alloc, 
+ const redblackTreeDeallocFunc_t dealloc,
+ const redblackTreeDebugFunc_t debug,
+ const redblackTreeCompFunc_t comp,
+ void * const user);
+
 /**
  * Find an entry in the red-black tree.
  *
@@ -239,6 +318,77 @@ void *redblackTreeInsert(redblackTree_t * const tree, void * const entry);
  */
 void *redblackTreeRemove(redblackTree_t * const tree, void * const entry);
 
+/**
+ * Remove a range of entries from the tree.
+ *
+ * Removes the entries not less than \e lo and less than \e hi. Each
+ * entry removed is deleted as by \e redblackTreeRemove() with a 
+ * \e deleteEntry() callback. A small range is removed by stepping through
+ * it from \e lo. If that would cost more than O(N) the tree is rebuilt 
+ * from the remaining entries instead.
+ *
+ * \param tree pointer to \e redblackTree_t
+ * \param lo \e void pointer to caller's entry data for the start of the range
+ * \param hi \e void pointer to caller's entry data for the end of the range
+ * \return number of entries removed
+ */
+size_t redblackTreeRemoveRange(redblackTree_t * const tree,
+                               const void * const lo,
+                               const void * const hi);
+
+/**
+ * Build a balanced red-black tree from sorted entries.
+ *
+ * Inserts \e n entries into an empty tree in O(n) time without comparing
+ * entries. The entries must be in strictly ascending order. Each entry is
+ * duplicated as by \e redblackTreeInsert(). On failure the tree is left
+ * empty.
+ *
+ * \param tree pointer to an empty \e redblackTree_t
+ * \param entries array of pointers to caller's entries in ascending order
+ * \param n number of entries
+ * \return \e true if the tree was built. \e false indicates failure.
+ */
+bool redblackTreeBuildFromSorted(redblackTree_t * const tree,
+                                 void * const * const entries,
+                                 const size_t n);
+
+/**
+ * Split the tree at an entry.
+ *
+ * Moves the entries less than \e entry to a new tree, \e left, and the 
+ * entries not less than \e entry to a new tree, \e right. The new trees
+ * have the same callbacks as \e tree and \e tree is left empty. The
+ * nodes are moved by joining the sub-trees hanging from the path to
+ * \e entry in O(lg N). A tree with an arena can not be split.
+ *
+ * \param tree pointer to \e redblackTree_t
+ * \param entry \e void pointer to caller's entry data
+ * \param left pointer to the new \e redblackTree_t of lesser entries
+ * \param right pointer to the new \e redblackTree_t of other entries
+ * \return \e true if the tree was split. \e false indicates failure.
+ */
+bool redblackTreeSplit(redblackTree_t * const tree,
+                       const void * const entry,
+                       redblackTree_t ** const left,
+                       redblackTree_t ** const right);
+
+/**
+ * Join two trees.
+ *
+ * Moves all the entries of \e right to \e left. All the entries in 
+ * \e left must be less than all the entries in \e right. The trees are
+ * joined at the minimum entry of \e right in O(lg N). On return \e right
+ * is empty. Trees with an arena, or with different entry sizes, callbacks
+ * or user data, can not be joined.
+ *
+ * \param left pointer to \e redblackTree_t of lesser entries
+ * \param right pointer to \e redblackTree_t of greater entries
+ * \return \e true if the trees were joined. \e false indicates failure.
+ */
+bool redblackTreeJoin(redblackTree_t * const left, 
+                      redblackTree_t * const right);
+
 /**
  * Clear the red-black tree.
  *
@@ -361,6 +511,115 @@ void *redblackTreeGetUpper(redblackTree_t * const tree,
 void *redblackTreeGetLower(redblackTree_t * const tree,
                            const void * const entry);
 
+/** 
+ * Select an entry by rank in the red-black tree.
+ *
+ * Returns the entry with \e k entries less than it, ie: the \e k'th
+ * smallest entry counting from zero. Each node records the number of
+ * nodes in its sub-tree so this takes O(lg N) time.
+ *
+ * \param tree pointer to \e redblackTree_t
+ * \param k rank of the entry
+ * \return \e void pointer to the entry. \e NULL if \e k is not less than
+ * the number of entries in the tree.
+ */
+void *redblackTreeSelect(redblackTree_t * const tree, const size_t k);
+
+/** 
+ * Get the rank of an entry in the red-black tree.
+ *
+ * Returns the number of entries in the tree that are less than \e entry.
+ * The entry passed need not refer to an entry actually in the tree. This
+ * takes O(lg N) time.
+ *
+ * \param tree pointer to \e redblackTree_t
+ * \param entry \e void pointer to caller's entry data
+ * \return number of entries less than \e entry
+ */
+size_t redblackTreeRank(redblackTree_t * const tree, 
+                        const void * const entry);
+
+/**
+ * Create a cursor for the red-black tree.
+ *
+ * A cursor refers to an entry in the tree and is moved to the next or
+ * previous entry by following the node links rather than searching for
+ * the entry again. Any number of cursors may traverse the same tree.
+ * Searches, insertions and the removal of other entries do not
+ * invalidate a cursor. A cursor referring to an entry is invalidated when
+ * that entry is removed. A new cursor does not refer to an entry.
+ *
+ * \param tree pointer to \e redblackTree_t
+ * \return pointer to a \e redblackTreeCursor_t. \e NULL indicates failure.
+ */
+redblackTreeCursor_t *redblackTreeCursorCreate(redblackTree_t * const tree);
+
+/**
+ * Destroy a red-black tree cursor.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ */
+void redblackTreeCursorDestroy(redblackTreeCursor_t * const cursor);
+
+/**
+ * Move a red-black tree cursor to an entry.
+ *
+ * Moves the cursor to the least entry in the tree that is not less
+ * than \e entry.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ * \param entry \e void pointer to caller's entry data
+ * \return \e void pointer to the entry at the cursor. \e NULL if all the
+ * entries in the tree are less than \e entry.
+ */
+void *redblackTreeCursorSeek(redblackTreeCursor_t * const cursor, 
+                        const void * const entry);
+
+/**
+ * Move a red-black tree cursor to the minimum entry.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * tree is empty.
+ */
+void *redblackTreeCursorFirst(redblackTreeCursor_t * const cursor);
+
+/**
+ * Move a red-black tree cursor to the maximum entry.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * tree is empty.
+ */
+void *redblackTreeCursorLast(redblackTreeCursor_t * const cursor);
+
+/**
+ * Move a red-black tree cursor to the next entry.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor was at the maximum entry or did not refer to an entry.
+ */
+void *redblackTreeCursorNext(redblackTreeCursor_t * const cursor);
+
+/**
+ * Move a red-black tree cursor to the previous entry.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor was at the minimum entry or did not refer to an entry.
+ */
+void *redblackTreeCursorPrevious(redblackTreeCursor_t * const cursor);
+
+/**
+ * Get the entry at a red-black tree cursor.
+ *
+ * \param cursor pointer to \e redblackTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor does not refer to an entry.
+ */
+void *redblackTreeCursorEntry(const redblackTreeCursor_t * const cursor);
+
 /** 
  * Operate on each tree entry.
  *
@@ -373,6 +632,24 @@ void *redblackTreeGetLower(redblackTree_t * const tree,
 bool redblackTreeWalk(redblackTree_t * const tree, 
                       const redblackTreeWalkFunc_t walk);
 
+/** 
+ * Operate on a range of tree entries.
+ *
+ * Traverses the entries not less than \e lo and less than \e hi in 
+ * increasing order calling a function for each entry. Only the nodes in
+ * the range and on the path to \e lo are visited.
+ *
+ * \param tree pointer to \e redblackTree_t
+ * \param lo \e void pointer to caller's entry data for the start of the range
+ * \param hi \e void pointer to caller's entry data for the end of the range
+ * \param walk pointer to a callback function to be called for each entry
+ * \return \e bool indicating sucess
+ */
+bool redblackTreeWalkRange(redblackTree_t * const tree, 
+                           const void * const lo,
+                           const void * const hi,
+                           const redblackTreeWalkFunc_t walk);
+
 /** 
  * Check the colour property of the tree.
  *
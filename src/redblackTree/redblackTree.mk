@@ -1,11 +1,31 @@
 # Programs in this directory
-redblackTree_PROGRAMS:=redblackTree_interp
+redblackTree_PROGRAMS:=redblackTree_interp redblackTreeCursor_test \
+redblackTreeRank_test redblackTreeInline_test
 PROGRAMS+=$(redblackTree_PROGRAMS)
 
 VPATH += src/redblackTree
 
-redblackTree_interp_C_SOURCES := redblackTree.c redblackTree_wrapper.c
+redblackTree_interp_C_SOURCES := redblackTree.c redblackTree_wrapper.c arena.c
 
 redblackTree_interp_STATIC_LIBRARIES := interp.a
 
-$(call add_extra_CFLAGS_macro,$(redblackTree_interp_C_SOURCES),-Isrc/interp)
+$(call add_extra_CFLAGS_macro,$(redblackTree_interp_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
+
+redblackTreeCursor_test_C_SOURCES := \
+redblackTreeCursor_test.c redblackTree.c arena.c
+
+$(call add_extra_CFLAGS_macro,$(redblackTreeCursor_test_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
+
+redblackTreeRank_test_C_SOURCES := \
+redblackTreeRank_test.c redblackTree.c arena.c
+
+$(call add_extra_CFLAGS_macro,$(redblackTreeRank_test_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
+
+redblackTreeInline_test_C_SOURCES := \
+redblackTreeInline_test.c redblackTree.c arena.c
+
+$(call add_extra_CFLAGS_macro,$(redblackTreeInline_test_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
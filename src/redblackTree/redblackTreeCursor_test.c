@@ -0,0 +1,209 @@
+/*
+ * redblackTreeCursor_test.c
+ *
+ * Step red-black tree cursors forwards and backwards, then insert and
+ * remove entries on either side of a cursor and step again.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "redblackTree.h"
+
+static long keys[] = { 10, 20, 30, 40, 45, 50, 55, 60, 70, 80, 90, 100 };
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+long *
+Key(const long key)
+{
+  size_t k;
+
+  for (k=0; k<(sizeof(keys)/sizeof(keys[0])); k++)
+    {
+      if (keys[k] == key)
+        {
+          return &keys[k];
+        }
+    }
+  fprintf(stderr, "No key %ld\n", key);
+  exit(EXIT_FAILURE);
+}
+
+static
+void
+Show(const char *what, const void * const entry)
+{
+  if (entry == NULL)
+    {
+      printf("%s: NULL\n", what);
+    }
+  else
+    {
+      printf("%s: %ld\n", what, *(const long *)entry);
+    }
+}
+
+int main(void)
+{
+  redblackTree_t *tree;
+  redblackTreeCursor_t *cursor;
+  redblackTreeCursor_t *other;
+  void *entry;
+
+  tree = redblackTreeCreate(Alloc, Dealloc, NULL, NULL, Debug, Compare, NULL);
+  if (tree == NULL)
+    {
+      fprintf(stderr, "redblackTreeCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  cursor = redblackTreeCursorCreate(tree);
+  other = redblackTreeCursorCreate(tree);
+  if ((cursor == NULL) || (other == NULL))
+    {
+      fprintf(stderr, "redblackTreeCursorCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  /* Empty tree */
+  Show("new", redblackTreeCursorEntry(cursor));
+  Show("next", redblackTreeCursorNext(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("first", redblackTreeCursorFirst(cursor));
+  Show("last", redblackTreeCursorLast(cursor));
+  Show("seek 10", redblackTreeCursorSeek(cursor, Key(10)));
+
+  (void)redblackTreeInsert(tree, Key(10));
+  (void)redblackTreeInsert(tree, Key(20));
+  (void)redblackTreeInsert(tree, Key(30));
+  (void)redblackTreeInsert(tree, Key(40));
+  (void)redblackTreeInsert(tree, Key(50));
+  (void)redblackTreeInsert(tree, Key(60));
+  (void)redblackTreeInsert(tree, Key(70));
+  (void)redblackTreeInsert(tree, Key(80));
+  (void)redblackTreeInsert(tree, Key(90));
+  (void)redblackTreeInsert(tree, Key(100));
+
+  /* Forwards and backwards */
+  printf("forwards:");
+  for (entry = redblackTreeCursorFirst(cursor);
+       entry != NULL;
+       entry = redblackTreeCursorNext(cursor))
+    {
+      printf(" %ld", *(long *)entry);
+    }
+  printf("\n");
+  Show("next after last", redblackTreeCursorNext(cursor));
+  printf("backwards:");
+  for (entry = redblackTreeCursorLast(cursor);
+       entry != NULL;
+       entry = redblackTreeCursorPrevious(cursor))
+    {
+      printf(" %ld", *(long *)entry);
+    }
+  printf("\n");
+  Show("previous before first", redblackTreeCursorPrevious(cursor));
+
+  /* Two cursors in opposite directions */
+  (void)redblackTreeCursorFirst(cursor);
+  (void)redblackTreeCursorLast(other);
+  printf("meet:");
+  while (Compare(redblackTreeCursorEntry(cursor),
+                 redblackTreeCursorEntry(other), NULL) == compareLesser)
+    {
+      printf(" %ld/%ld", *(long *)redblackTreeCursorEntry(cursor),
+             *(long *)redblackTreeCursorEntry(other));
+      (void)redblackTreeCursorNext(cursor);
+      (void)redblackTreeCursorPrevious(other);
+    }
+  printf("\n");
+
+  /* Insert around the cursor */
+  Show("seek 45", redblackTreeCursorSeek(cursor, Key(45)));
+  (void)redblackTreeInsert(tree, Key(45));
+  (void)redblackTreeInsert(tree, Key(55));
+  Show("entry", redblackTreeCursorEntry(cursor));
+  Show("next", redblackTreeCursorNext(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+
+  /* Remove around the cursor */
+  Show("next", redblackTreeCursorNext(cursor));
+  Show("remove 40", redblackTreeRemove(tree, Key(40)));
+  Show("remove 55", redblackTreeRemove(tree, Key(55)));
+  Show("remove 10", redblackTreeRemove(tree, Key(10)));
+  Show("remove 100", redblackTreeRemove(tree, Key(100)));
+  Show("entry", redblackTreeCursorEntry(cursor));
+  Show("next", redblackTreeCursorNext(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+
+  /* Seek past a removed entry */
+  Show("remove 50", redblackTreeRemove(tree, Key(50)));
+  Show("seek 50", redblackTreeCursorSeek(cursor, Key(50)));
+  Show("previous", redblackTreeCursorPrevious(cursor));
+  Show("last", redblackTreeCursorLast(cursor));
+  Show("seek 100", redblackTreeCursorSeek(cursor, Key(100)));
+  printf("check: %s\n", redblackTreeCheck(tree) ? "true" : "false");
+
+  redblackTreeCursorDestroy(other);
+  redblackTreeCursorDestroy(cursor);
+  redblackTreeDestroy(tree);
+
+  return EXIT_SUCCESS;
+}
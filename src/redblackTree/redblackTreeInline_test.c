@@ -0,0 +1,173 @@
+/*
+ * redblackTreeInline_test.c
+ *
+ * Red-black trees that copy each entry into the tree node, with and
+ * without an arena for the nodes, and with keys compared by a callback or
+ * inline as long keys.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "redblackTree.h"
+
+typedef struct entry_t
+{
+  long key;
+  long value;
+}
+entry_t;
+
+static unsigned long seed;
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = ((const entry_t *)a)->key;
+  long kb = ((const entry_t *)b)->key;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+bool
+Show(void * const entry, void * const user)
+{
+  (void)user;
+  printf(" %ld:%ld", ((entry_t *)entry)->key, ((entry_t *)entry)->value);
+  return true;
+}
+
+static
+long
+Random(const long n)
+{
+  seed = (seed*1103515245UL)+12345UL;
+  return (long)((seed>>16)%(unsigned long)n);
+}
+
+static
+void
+Run(const char *name, const size_t chunkNodes,
+    const redblackTreeCompFunc_t comp)
+{
+  redblackTree_t *tree;
+  entry_t entry;
+  entry_t *found;
+  long k;
+
+  printf("%s\n", name);
+  tree = redblackTreeCreateInline(sizeof(entry_t), chunkNodes, Alloc,
+                                  Dealloc, Debug, comp, NULL);
+  if (tree == NULL)
+    {
+      fprintf(stderr, "redblackTreeCreateInline() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  /* Every entry is inserted from the same automatic variable */
+  for (k=0; k<20; k++)
+    {
+      entry.key = (k*7)%20;
+      entry.value = entry.key*10;
+      found = redblackTreeInsert(tree, &entry);
+      if ((found == NULL) || (found == &entry))
+        {
+          printf("insert %ld: not copied\n", entry.key);
+        }
+    }
+  entry.key = 7;
+  entry.value = 0;
+  found = redblackTreeInsert(tree, &entry);
+  printf("insert existing: %ld:%ld\n", found->key, found->value);
+  printf("size: %zu check %s\n", redblackTreeGetSize(tree),
+         redblackTreeCheck(tree) ? "true" : "false");
+  entry.key = 13;
+  found = redblackTreeFind(tree, &entry);
+  printf("find: %ld:%ld\n", found->key, found->value);
+  printf("remove: %s\n",
+         (redblackTreeRemove(tree, &entry) == NULL) ? "NULL" : "entry");
+  printf("find removed: %s\n",
+         (redblackTreeFind(tree, &entry) == NULL) ? "NULL" : "entry");
+  found = redblackTreeGetUpper(tree, &entry);
+  printf("upper: %ld\n", found->key);
+  found = redblackTreeGetLower(tree, &entry);
+  printf("lower: %ld\n", found->key);
+  for (k=0; k<20; k+=2)
+    {
+      entry.key = k;
+      (void)redblackTreeRemove(tree, &entry);
+    }
+  printf("walk:");
+  (void)redblackTreeWalk(tree, Show);
+  printf("\n");
+
+  /* Recycle the removed nodes */
+  seed = 1;
+  for (k=0; k<2000; k++)
+    {
+      entry.key = Random(1000);
+      entry.value = k;
+      (void)redblackTreeInsert(tree, &entry);
+      entry.key = Random(1000);
+      (void)redblackTreeRemove(tree, &entry);
+    }
+  printf("size: %zu check %s\n", redblackTreeGetSize(tree),
+         redblackTreeCheck(tree) ? "true" : "false");
+  redblackTreeClear(tree);
+  printf("size after clear: %zu\n", redblackTreeGetSize(tree));
+  redblackTreeDestroy(tree);
+}
+
+int main(void)
+{
+  Run("callback comparison", 0, Compare);
+  Run("callback comparison with an arena", 8, Compare);
+  Run("long key comparison", 0, redblackTreeCompLong);
+  Run("long key comparison with an arena", 8, redblackTreeCompLong);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+/*
+ * redblackTreeRank_test.c
+ *
+ * Select entries by rank and find the ranks of entries in a red-black
+ * tree at the ends of the tree, out of range and after removals.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "redblackTree.h"
+
+#define KEYS 1000
+
+static long keys[KEYS];
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+void
+Select(redblackTree_t * const tree, const size_t k)
+{
+  long *entry = redblackTreeSelect(tree, k);
+
+  if (entry == NULL)
+    {
+      printf("select %zu: NULL\n", k);
+    }
+  else
+    {
+      printf("select %zu: %ld\n", k, *entry);
+    }
+}
+
+static
+void
+Rank(redblackTree_t * const tree, const long key)
+{
+  printf("rank %ld: %zu\n", key, redblackTreeRank(tree, &key));
+}
+
+/*
+ * Check that selecting each rank in turn gives the entries in order and
+ * that the rank of each entry is the rank it was selected by.
+ */
+static
+void
+Order(redblackTree_t * const tree)
+{
+  size_t size = redblackTreeGetSize(tree);
+  long *prev = NULL;
+  size_t k;
+
+  for (k=0; k<size; k++)
+    {
+      long *entry = redblackTreeSelect(tree, k);
+
+      if ((entry == NULL) || ((prev != NULL) && (*prev >= *entry)) ||
+          (redblackTreeRank(tree, entry) != k))
+        {
+          printf("order: wrong at rank %zu\n", k);
+          return;
+        }
+      prev = entry;
+    }
+  printf("order: %zu entries, check %s\n", size,
+         redblackTreeCheck(tree) ? "true" : "false");
+}
+
+int main(void)
+{
+  redblackTree_t *tree;
+  long k;
+
+  tree = redblackTreeCreate(Alloc, Dealloc, NULL, NULL, Debug,
+                            redblackTreeCompLong, NULL);
+  if (tree == NULL)
+    {
+      fprintf(stderr, "redblackTreeCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  /* Empty tree */
+  Select(tree, 0);
+  Rank(tree, 0);
+
+  /* The even keys from 0 to 2*(KEYS-1) */
+  for (k=0; k<KEYS; k++)
+    {
+      keys[k] = 2*k;
+      (void)redblackTreeInsert(tree, &keys[k]);
+    }
+  Select(tree, 0);
+  Select(tree, 1);
+  Select(tree, KEYS-1);
+  Select(tree, KEYS);
+  Select(tree, (size_t)KEYS*KEYS);
+  Rank(tree, -1);
+  Rank(tree, 0);
+  Rank(tree, 1);
+  Rank(tree, 2);
+  Rank(tree, 2*(KEYS-1));
+  Rank(tree, 2*KEYS);
+  Order(tree);
+
+  /* Remove the minimum, the maximum and every third key */
+  (void)redblackTreeRemove(tree, &keys[0]);
+  (void)redblackTreeRemove(tree, &keys[KEYS-1]);
+  for (k=3; k<KEYS-1; k+=3)
+    {
+      (void)redblackTreeRemove(tree, &keys[k]);
+    }
+  Select(tree, 0);
+  Select(tree, redblackTreeGetSize(tree)-1);
+  Select(tree, redblackTreeGetSize(tree));
+  Rank(tree, 0);
+  Rank(tree, 2);
+  Rank(tree, 6);
+  Rank(tree, 8);
+  Rank(tree, 2*(KEYS-2));
+  Rank(tree, 2*(KEYS-1));
+  Order(tree);
+
+  /* Remove the remaining keys and insert one again */
+  for (k=1; k<KEYS-1; k++)
+    {
+      if ((k%3) != 0)
+        {
+          (void)redblackTreeRemove(tree, &keys[k]);
+        }
+    }
+  (void)redblackTreeInsert(tree, &keys[500]);
+  Select(tree, 0);
+  Select(tree, 1);
+  Rank(tree, 1000);
+  Rank(tree, 1001);
+  Order(tree);
+
+  redblackTreeDestroy(tree);
+
+  return EXIT_SUCCESS;
+}
@@ -20,6 +20,7 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "arena.h"
 #include "redblackTree.h"
 
 /**
@@ -54,6 +55,9 @@ typedef struct redblackTreeNode_t
 
   redblackTreeColour_e colour;
   /**< Colour of node. */
+
+  size_t count;
+  /**< Number of nodes in the sub-tree rooted at this node. */
 } redblackTreeNode_t;
 
 /**
@@ -87,6 +91,10 @@ struct redblackTree_t
   redblackTreeCompFunc_t compare;
   /**< Callback function to compare two entries in the tree.  */
 
+  bool longKey;
+  /**< \e compare is \e redblackTreeCompLong(). The search is specialised
+       to compare \e long keys inline. */
+
   redblackTreeNode_t *root;
   /**< Root entry in the tree. */
 
@@ -96,10 +104,35 @@ struct redblackTree_t
   size_t size;
   /**< Number of entries in the redblackTree. */
 
+  arena_t *arena;
+  /**< Arena for redblackTreeNode_t. \e NULL if nodes use \e alloc(). */
+
+  size_t nodeSize;
+  /**< Size of each redblackTreeNode_t including any entry stored in the node. */
+
+  size_t entrySize;
+  /**< Size of the entry stored in each node. Zero if the node stores
+       a pointer to the caller's entry data. */
+
   void *user;
   /**< Placeholder for user data in callbacks. */
 };
 
+/**
+ * redblackTreeCursor_t structure.
+ *
+ * Private implementation of redblackTreeCursor_t. The parent pointers in
+ * redblackTreeNode_t allow the cursor to move without a stack.
+ */
+struct redblackTreeCursor_t
+{
+  redblackTree_t *tree;
+  /**< The tree traversed by the cursor. */
+
+  redblackTreeNode_t *node;
+  /**< Node at the cursor. \e NULL if the cursor does not refer to a node. */
+};
+
 #ifdef __cplusplus
 }
 #endif
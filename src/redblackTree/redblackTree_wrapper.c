@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 
+#include "interp_data.h"
 #include "interp_utility.h"
 #include "interp_callbacks.h"
 #include "interp_wrapper.h"
@@ -24,6 +25,19 @@ interpCreate(void)
                             NULL);
 }
 
+void *
+interpCreateWithSize(const size_t size)
+{
+  return redblackTreeCreateWithArena(size,
+                                     interpAlloc,
+                                     interpDealloc,
+                                     interpDuplicateEntry,
+                                     interpDeleteEntry,
+                                     interpDebug,
+                                     interpComp,
+                                     NULL);
+}
+
 void *
 interpFind(void * const tree, void * const entry)
 {
@@ -179,3 +193,113 @@ interpCopy(void * const dst, void * const src)
   interpError(__func__, __LINE__, "Not implemented!");
   return 0;
 }
+
+bool
+interpBuild(void * const tree, const size_t n)
+{
+  data_t *data;
+  void **entries;
+  size_t k;
+  bool res;
+
+  data = interpAlloc((n+1)*sizeof(data_t), NULL);
+  entries = interpAlloc((n+1)*sizeof(void *), NULL);
+  for (k=0; k<n; k++)
+    {
+      data[k] = (data_t)k;
+      entries[k] = &data[k];
+    }
+
+  res = redblackTreeBuildFromSorted(tree, entries, n);
+
+  interpDealloc(entries, NULL);
+  interpDealloc(data, NULL);
+  return res;
+}
+
+bool
+interpWalkRange(void * const tree,
+                const void * const lo,
+                const void * const hi,
+                const interpWalkFunc_t walk)
+{
+  return redblackTreeWalkRange(tree, lo, hi, walk);
+}
+
+size_t
+interpRemoveRange(void * const tree,
+                  const void * const lo,
+                  const void * const hi)
+{
+  return redblackTreeRemoveRange(tree, lo, hi);
+}
+
+bool
+interpSetPolicy(void * const tree, const size_t policy)
+{
+  (void)tree;
+  (void)policy;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpShowStats(void * const tree)
+{
+  (void)tree;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetBudget(void * const tree, const size_t budget)
+{
+  (void)tree;
+  (void)budget;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+size_t
+interpGetCost(void * const tree)
+{
+  (void)tree;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return 0;
+}
+
+bool
+interpSetTTL(void * const tree, const size_t ttl)
+{
+  (void)tree;
+  (void)ttl;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpMeld(void * const dst, void * const src)
+{
+  (void)dst;
+  (void)src;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetTopK(void * const tree, const size_t k)
+{
+  (void)tree;
+  (void)k;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
+
+bool
+interpSetFinger(void * const tree, const bool finger)
+{
+  (void)tree;
+  (void)finger;
+  interpError(__func__, __LINE__, "Not implemented!");
+  return false;
+}
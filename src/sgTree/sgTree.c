@@ -12,9 +12,55 @@
 
 #include "compare.h"
 #include "stack.h"
+#include "arena.h"
 #include "sgTree.h"
 #include "sgTree_private.h"
 
+/**
+ * Private helper function for scapegoat tree implementation.
+ *
+ * Allocate a node from the arena, if it exists, or with \e alloc().
+ *
+ * \param tree pointer to sgTree_t
+ * \return pointer to the new sgTreeNode_t. \e NULL indicates failure.
+ */
+static
+sgTreeNode_t *
+sgTreeAllocNode(sgTree_t * const tree)
+{
+  if (tree->arena != NULL)
+    {
+      return (sgTreeNode_t *)arenaAlloc(tree->arena);
+    }
+  else
+    {
+      return (sgTreeNode_t *)
+        (tree->alloc)(sizeof(sgTreeNode_t), tree->user);
+    }
+}
+
+/**
+ * Private helper function for scapegoat tree implementation.
+ *
+ * Return a node to the arena, if it exists, or to \e dealloc().
+ *
+ * \param tree pointer to sgTree_t
+ * \param node pointer to sgTreeNode_t
+ */
+static
+void
+sgTreeDeallocNode(sgTree_t * const tree, sgTreeNode_t * const node)
+{
+  if (tree->arena != NULL)
+    {
+      arenaFree(tree->arena, node);
+    }
+  else
+    {
+      (tree->dealloc)(node, tree->user);
+    }
+}
+
 /**
  * Private helper function for scapegoat tree implementation.
  *
@@ -297,7 +343,7 @@ sgTreeRecurseInsertNode(sgTree_t * const tree,
 
   if ((*node) == NULL)
     {
-      (*node) = (sgTreeNode_t *)(tree->alloc(sizeof(sgTreeNode_t), tree->user));
+      (*node) = sgTreeAllocNode(tree);
       if ((*node) == NULL)
         {
           tree->debug(__func__, __LINE__, tree->user, 
@@ -310,7 +356,7 @@ sgTreeRecurseInsertNode(sgTree_t * const tree,
       (*node)->entry = sgTreeDuplicateEntry(tree, entry);
       if ((*node)->entry == NULL)
         {
-          (tree->dealloc)(*node, tree->user);
+          sgTreeDeallocNode(tree, *node);
           (tree->debug)(__func__, __LINE__, tree->user,
                         "sgTreeDuplicateEntry() failed!");
           return NULL;
@@ -588,10 +634,7 @@ sgTreeRecurseClear(sgTree_t * const tree, sgTreeNode_t * const node)
     }
 
   /* Deallocate node */
-  if (tree->dealloc != NULL)
-    {
-      (tree->dealloc)(node, tree->user);
-    }
+  sgTreeDeallocNode(tree, node);
   tree->size = tree->size - 1;
 
   return;
@@ -711,11 +754,43 @@ sgTree_t *sgTreeCreate
   tree->ln_alpha = log(tree->alpha);
   tree->use_alpha_weight_balance = false;
   tree->use_recursize_size_node = true;
+  tree->arena = NULL;
   tree->user = user;
 
   return tree;
 }
 
+sgTree_t *sgTreeCreateWithArena
+(const size_t chunkNodes,
+ const sgTreeAllocFunc_t alloc,
+ const sgTreeDeallocFunc_t dealloc,
+ const sgTreeDuplicateEntryFunc_t duplicateEntry,
+ const sgTreeDeleteEntryFunc_t deleteEntry,
+ const sgTreeDebugFunc_t debug,
+ const sgTreeCompFunc_t comp,
+ void * const user)
+{
+  sgTree_t *tree; 
+
+  tree = sgTreeCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                      debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  tree->arena = arenaCreate(sizeof(sgTreeNode_t), chunkNodes,
+                            alloc, dealloc, debug, user);
+  if (tree->arena == NULL)
+    {
+      debug(__func__, __LINE__, user, "Can't create arena!");
+      sgTreeDestroy(tree);
+      return NULL;
+    }
+
+  return tree;
+}
+
 void *sgTreeFind(sgTree_t * const tree, void * const entry)
 {
   if ((tree == NULL) || (entry == NULL))
@@ -856,7 +931,7 @@ sgTreeRemove(sgTree_t * const tree, void * const entry)
     {
       (tree->deleteEntry)(removed_entry, tree->user);
     }
-  (tree->dealloc)(removed, tree->user);
+  sgTreeDeallocNode(tree, removed);
 
   /* Adjust size */
   tree->size = tree->size-1;
@@ -905,6 +980,7 @@ void sgTreeDestroy(sgTree_t * const tree)
   
   /* Free all the nodes in the tree */
   sgTreeClear(tree);
+  arenaDestroy(tree->arena);
   
   /* Free the tree */
   tree->dealloc(tree, tree->user);
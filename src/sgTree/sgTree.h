@@ -202,6 +202,34 @@ extern "C" {
    const sgTreeCompFunc_t comp,
    void * const user);
 
+  /**
+   * Create an empty scapegoat tree with an arena for the tree nodes.
+   * 
+   * Creates and initialises an empty \e sgTree_t instance. The tree
+   * nodes are allocated in chunks of \e chunkNodes nodes and nodes that
+   * are removed are recycled by later insertions. The chunks are
+   * deallocated when the tree is destroyed.
+   *
+   * \param chunkNodes number of tree nodes allocated in each chunk
+   * \param alloc memory allocator callback
+   * \param dealloc memory deallocator callback
+   * \param duplicateEntry entry duplication callback for caller's entry data
+   * \param deleteEntry memory deallocator callback for callers entry data
+   * \param debug message function callback
+   * \param comp entry key comparison function callback
+   * \param user \e void pointer to user data to be echoed by callbacks
+   * \return pointer to a \e sgTree_t. \e NULL indicates failure
+   */
+  sgTree_t *sgTreeCreateWithArena
+  (const size_t chunkNodes,
+   const sgTreeAllocFunc_t alloc, 
+   const sgTreeDeallocFunc_t dealloc,
+   const sgTreeDuplicateEntryFunc_t duplicateEntry,
+   const sgTreeDeleteEntryFunc_t deleteEntry,
+   const sgTreeDebugFunc_t debug,
+   const sgTreeCompFunc_t comp,
+   void * const user);
+
   /**
    * Find an entry in the scapegoat tree.
    *
@@ -20,6 +20,7 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "arena.h"
 #include "sgTree.h"
 
 /**
@@ -78,6 +79,9 @@ struct sgTree_t
   size_t size;
   /**< Number of entries in the sgTree. */
 
+  arena_t *arena;
+  /**< Arena for sgTreeNode_t. \e NULL if nodes use \e alloc(). */
+
   size_t max_size;
   /**< Maximum size of the sgTree since the last time the tree was completely
    *    rebuilt.
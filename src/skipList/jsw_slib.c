@@ -18,32 +18,73 @@
 #ifdef __cplusplus
 
 #include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 
 using std::malloc;
 using std::free;
 using std::size_t;
+using std::uint64_t;
 
 #else
 
 #include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #endif
 
 /** 
  * Private \e jsw_node_t structure used by the \e jsw_skip_t skip list. 
+ *
+ * The links are stored in the node so that a node is a single allocation
+ * and following a link costs one load. The node is allocated with room for
+ * \e height links. \e next is declared with one element rather than as a
+ * flexible array member so that the file also compiles as C++.
  */
-typedef struct jsw_node {
+struct jsw_node {
   void             *item;
   /**< Data item with combined key/value */
 
   size_t            height; 
   /**< Column height of this node */
 
-  struct jsw_node **next;   
-  /**< Dynamic array of next links */
-} jsw_node_t;
+  struct jsw_node  *prev;
+  /**< Previous node at level 0. The header node for the first node */
+
+  struct jsw_node  *next[1];
+  /**< Array of \e height next links */
+};
+
+/** 
+ * Private \e jsw_long_node_t structure. 
+ *
+ * If the skip list has \e long keys then each node is allocated inside a
+ * \e jsw_long_node_t that keeps a copy of the key of the item just before
+ * the node, so that a search compares keys without loading the items.
+ * Skip lists with a \e cmp callback do not store the key.
+ */
+typedef struct jsw_long_node {
+  long              key;
+  /**< Copy of the \e long key of the item */
+
+  struct jsw_node   node;
+  /**< The node. Must be the last member. */
+} jsw_long_node_t;
+
+/** Size of a node with \e height links */
+#define NODE_SIZE(height) \
+  ( offsetof ( jsw_node_t, next ) + ( (height) * sizeof ( jsw_node_t * ) ) )
+
+/** Offset of the node in a \e jsw_long_node_t */
+#define LONG_NODE_OFFSET offsetof ( jsw_long_node_t, node )
+
+/** The copy of the \e long key of the item of a node */
+#define NODE_KEY(node) \
+  ( ( (const jsw_long_node_t *) \
+      ( (const void *)( (const char *)(node) - LONG_NODE_OFFSET ) ) )->key )
 
 /** 
  * \e Opaque definition of a \e jsw_skip_t structure. 
@@ -68,7 +109,7 @@ struct jsw_skip {
   /**< Number of items at level 0 */
 
   cmp_f cmp;  
-  /**< User defined item compare function */
+  /**< User defined item compare function. \e NULL for \e long keys */
 
   dup_f dup;  
   /**< User defined item copy function */
@@ -78,43 +119,63 @@ struct jsw_skip {
 
   void *priv; 
   /**< User private data passed to the user defined functions */
+
+  uint64_t rng;
+  /**< State of the random level generator */
+
+  int finger;
+  /**< Non-zero if searches start from the previous search path in \e fix */
 };
 
+/** 
+ * Private function to generate a random number.
+ *
+ * SplitMix64: a Weyl sequence with a 64-bit output mixing function. The
+ * state belongs to the skip list so that skip lists used by different
+ * threads do not share a generator.
+ * \param skip pointer to a \e jsw_skip_t instance
+ * \return a random number
+ */
+static uint64_t jsw_srand ( jsw_skip_t * const skip )
+{
+  uint64_t z = ( skip->rng += 0x9e3779b97f4a7c15ULL );
+
+  z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+  z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+
+  return z ^ ( z >> 31 );
+}
+
 /** 
  * Private function to generate a weighted random 
  * level with probability 1/2.
  *
  * Weighted random level with probability 1/2.
- * (For better distribution, modify with 1/3)
- * Implements a tuned bit stream algorithm.
- * \param max maximum height of the skip list
- * \return a random height less than \e max
+ * The level is one more than the number of trailing zero bits of a
+ * random number.
+ * \param skip pointer to a \e jsw_skip_t instance
+ * \return a random height less than the maximum height of the skip list
  */
-static size_t rlevel ( size_t max )
+static size_t rlevel ( jsw_skip_t * const skip )
 {
-  static size_t bits = 0;
-  static size_t reset = 0;
-  size_t h, found = 0;
-
-  for ( h = 0; !found; h++ ) {
-    if ( reset == 0 ) {
-      bits = jsw_rand();
-      reset = sizeof ( size_t ) * CHAR_BIT - 1;
-    }
-
-    /*
-      For 1/3 change to:
+  uint64_t bits = jsw_srand ( skip );
+  size_t h;
 
-      found = bits % 3;
-      bits = bits / 3;
-    */
-    found = bits & 1;
-    bits = bits >> 1;
-    --reset;
+  if ( bits == 0 ) {
+    h = 64;
+  }
+  else {
+#if defined(__GNUC__)
+    h = (size_t)__builtin_ctzll ( bits );
+#else
+    for ( h = 0; ( bits & 1 ) == 0; h++ )
+      bits >>= 1;
+#endif
   }
+  h = h + 1;
 
-  if ( h >= max )
-    h = max - 1;
+  if ( h >= skip->maxh )
+    h = skip->maxh - 1;
 
   return h;
 }
@@ -123,28 +184,40 @@ static size_t rlevel ( size_t max )
  * Private function to create a new node in the \e jsw_skip_t skip list.
  *
  * Create a new node in the \e jsw_skip_t skip list at the given
- * height. This function does not make a copy of the item.
+ * height. This function does not make a copy of the item. If the skip
+ * list has \e long keys then the key of the item, or 0 for the header, is
+ * copied in front of the node.
+ * \param skip pointer to a \e jsw_skip_t instance
  * \param item \e void pointer to memory to be duplicated
  * \param height level in the skip list
  * \return pointer to an instance of \e jsw_node_t
  */
-static jsw_node_t *new_node ( void *item, size_t height )
+static jsw_node_t *new_node ( const jsw_skip_t * const skip, 
+                              void *item, size_t height )
 {
-  jsw_node_t *node = (jsw_node_t *)malloc ( sizeof *node );
+  jsw_node_t *node;
   size_t i;
 
-  if ( node == NULL )
-    return NULL;
+  if ( skip->cmp == NULL ) {
+    jsw_long_node_t *long_node = 
+      (jsw_long_node_t *)malloc ( LONG_NODE_OFFSET + NODE_SIZE ( height ) );
 
-  node->next = (jsw_node_t **)malloc ( height * sizeof *node->next );
+    if ( long_node == NULL )
+      return NULL;
 
-  if ( node->next == NULL ) {
-    free ( node );
-    return NULL;
+    long_node->key = ( item == NULL ) ? 0 : *(const long *)item;
+    node = &long_node->node;
+  }
+  else {
+    node = (jsw_node_t *)malloc ( NODE_SIZE ( height ) );
+
+    if ( node == NULL )
+      return NULL;
   }
 
   node->item = item;
   node->height = height;
+  node->prev = NULL;
 
   for ( i = 0; i < height; i++ )
     node->next[i] = NULL;
@@ -157,19 +230,149 @@ static jsw_node_t *new_node ( void *item, size_t height )
  *
  * Delete a node in the \e jsw_skip_t skip list. This function
  * does not release the items memory.
+ * \param skip pointer to a \e jsw_skip_t instance
  * \param node pointer to the node memory to be deleted
  */
-static void delete_node ( jsw_node_t *node )
+static void delete_node ( const jsw_skip_t * const skip, jsw_node_t *node )
+{
+  if ( skip->cmp == NULL )
+    free ( (char *)node - LONG_NODE_OFFSET );
+  else
+    free ( node );
+}
+
+/** 
+ * Private function to compare two items beginning with a \e long key.
+ *
+ * Used in place of the \e cmp callback by a skip list created with
+ * \e cmp equal to \e NULL.
+ * \param a \e void pointer to an item beginning with a \e long key
+ * \param b \e void pointer to an item beginning with a \e long key
+ * \return \e -1, \e 0 or \e 1 as for \e cmp_f
+ */
+static inline int cmp_long ( const void * const a, const void * const b )
+{
+  const long x = *(const long *)a;
+  const long y = *(const long *)b;
+
+  return ( x > y ) - ( x < y );
+}
+
+/** 
+ * Private function to compare two items with the \e cmp callback or,
+ * if the skip list has \e long keys, inline.
+ * \param skip pointer to a \e jsw_skip_t instance
+ * \param a \e void pointer to an item
+ * \param b \e void pointer to an item
+ * \return \e -1, \e 0 or \e 1 as for \e cmp_f
+ */
+static inline int cmp_item ( const jsw_skip_t * const skip, 
+                             const void * const a, 
+                             const void * const b )
 {
-  free ( node->next );
-  free ( node );
+  if ( skip->cmp == NULL )
+    return cmp_long ( a, b );
+
+  return skip->cmp ( a, b, skip->priv );
+}
+
+/** Compare an item with the item of a node with the caller's \e cmp 
+ * callback. */
+#define CMP_CALLBACK(skip, a, node) \
+  ( (skip)->cmp ( (a), (node)->item, (skip)->priv ) )
+
+/** Compare an item beginning with a \e long key with the key copied into a
+ * node inline. */
+#define CMP_LONG(skip, a, node) cmp_long ( (a), &NODE_KEY ( node ) )
+
+/** 
+ * Template for the private functions to locate an existing item in the 
+ * \e jsw_skip_t skip list.
+ *
+ * Expands to a function \e NAME(skip,item) that compares items with
+ * \e CMP(skip,item,node). The function locates an existing item in the 
+ * \e jsw_skip_t skip list or the position before which it would be
+ * inserted. It returns a pointer to the node containing the item or the
+ * node before which it would be inserted. The search is instantiated
+ * once for the \e cmp callback and once for \e long keys so that the
+ * comparison in the \e long key search is inlined.
+ */
+#define LOCATE_TEMPLATE(NAME, CMP)                                      \
+static jsw_node_t *NAME ( jsw_skip_t * const skip,                      \
+                          const void * const item )                     \
+{                                                                       \
+  jsw_node_t *p = skip->head;                                           \
+  size_t i;                                                             \
+                                                                        \
+  for ( i = skip->curh; i < (size_t)-1; i-- ) {                         \
+    while ( p->next[i] != NULL ) {                                      \
+      if ( CMP ( skip, item, p->next[i] ) <= 0 )                        \
+        break;                                                          \
+                                                                        \
+      p = p->next[i];                                                   \
+    }                                                                   \
+                                                                        \
+    skip->fix[i] = p;                                                   \
+  }                                                                     \
+                                                                        \
+  return p;                                                             \
+}
+
+LOCATE_TEMPLATE ( locate_callback, CMP_CALLBACK )
+
+LOCATE_TEMPLATE ( locate_long, CMP_LONG )
+
+/** 
+ * Template for the private functions to locate an existing item in the 
+ * \e jsw_skip_t skip list starting from the previous search path.
+ *
+ * Expands to a function \e NAME(skip,item) that behaves as the function
+ * expanded from \e LOCATE_TEMPLATE. \e fix always holds the search path
+ * of the previous search, adjusted by any insertion or erasure since. The
+ * search climbs from level 0 to the lowest level at which the node in
+ * \e fix precedes the item and the next node does not, then descends
+ * from that node. The nodes in \e fix above that level already precede
+ * the item in the same way. An item at distance \e d from the previous
+ * item is located in expected \e O(lg \e d) time. At level \e curh the
+ * node in \e fix is the header so the climb always stops.
+ */
+#define LOCATE_FINGER_TEMPLATE(NAME, CMP)                               \
+static jsw_node_t *NAME ( jsw_skip_t * const skip,                      \
+                          const void * const item )                     \
+{                                                                       \
+  jsw_node_t *p;                                                        \
+  size_t i;                                                             \
+                                                                        \
+  for ( i = 0; i < skip->curh; i++ ) {                                  \
+    p = skip->fix[i];                                                   \
+    if ( ( p == skip->head || CMP ( skip, item, p ) > 0 ) &&            \
+         ( p->next[i] == NULL || CMP ( skip, item, p->next[i] ) <= 0 ) ) \
+      break;                                                            \
+  }                                                                     \
+                                                                        \
+  p = skip->fix[i];                                                     \
+  for ( ; i < (size_t)-1; i-- ) {                                       \
+    while ( p->next[i] != NULL ) {                                      \
+      if ( CMP ( skip, item, p->next[i] ) <= 0 )                        \
+        break;                                                          \
+                                                                        \
+      p = p->next[i];                                                   \
+    }                                                                   \
+                                                                        \
+    skip->fix[i] = p;                                                   \
+  }                                                                     \
+                                                                        \
+  return p;                                                             \
 }
 
+LOCATE_FINGER_TEMPLATE ( locate_finger_callback, CMP_CALLBACK )
+
+LOCATE_FINGER_TEMPLATE ( locate_finger_long, CMP_LONG )
+
 /** 
  * Private function to locate an existing item in the \e jsw_skip_t skip list
  *
- * Locate an existing item in the \e jsw_skip_t skip list or the 
- * position before which it would be inserted.
+ * See \e LOCATE_TEMPLATE.
  * \param skip pointer to a \e jsw_skip_t instance
  * \param item \e void pointer to the key/value to be found
  * \return pointer to the node containing the item or the node before
@@ -177,21 +380,17 @@ static void delete_node ( jsw_node_t *node )
  */
 static jsw_node_t *locate ( jsw_skip_t * const skip, const void * const item )
 {
-  jsw_node_t *p = skip->head;
-  size_t i;
+  if ( skip->finger ) {
+    if ( skip->cmp == NULL )
+      return locate_finger_long ( skip, item );
 
-  for ( i = skip->curh; i < (size_t)-1; i-- ) {
-    while ( p->next[i] != NULL ) {
-      if ( skip->cmp ( item, p->next[i]->item, skip->priv ) <= 0 )
-        break;
-
-      p = p->next[i];
-    }
-
-    skip->fix[i] = p;
+    return locate_finger_callback ( skip, item );
   }
 
-  return p;
+  if ( skip->cmp == NULL )
+    return locate_long ( skip, item );
+
+  return locate_callback ( skip, item );
 }
 
 jsw_skip_t *jsw_snew ( size_t max, 
@@ -201,11 +400,13 @@ jsw_skip_t *jsw_snew ( size_t max,
                        void * const priv )
 {
   jsw_skip_t *skip = (jsw_skip_t *)malloc ( sizeof *skip );
+  size_t i;
 
   if ( skip == NULL )
     return NULL;
 
-  skip->head = new_node ( NULL, ++max );
+  skip->cmp = cmp;
+  skip->head = new_node ( skip, NULL, ++max );
 
   if ( skip->head == NULL ) {
     free ( skip );
@@ -215,21 +416,24 @@ jsw_skip_t *jsw_snew ( size_t max,
   skip->fix = (jsw_node_t **)malloc ( max * sizeof *skip->fix );
 
   if ( skip->fix == NULL ) {
-    delete_node ( skip->head );
+    delete_node ( skip, skip->head );
     free ( skip );
     return NULL;
   }
 
+  for ( i = 0; i < max; i++ )
+    skip->fix[i] = skip->head;
+
   skip->curl = NULL;
   skip->maxh = max;
   skip->curh = 0;
   skip->size = 0;
-  skip->cmp = cmp;
   skip->dup = dup;
   skip->rel = rel;
   skip->priv = priv;
 
-  jsw_seed ( jsw_time_seed() );
+  skip->rng = jsw_time_seed();
+  skip->finger = 0;
 
   return skip;
 }
@@ -242,20 +446,30 @@ void jsw_sdelete ( jsw_skip_t * const skip )
   while ( it != NULL ) {
     save = it->next[0];
     skip->rel ( it->item, skip->priv );
-    delete_node ( it );
+    delete_node ( skip, it );
     it = save;
   }
 
-  delete_node ( skip->head );
+  delete_node ( skip, skip->head );
   free ( skip->fix );
   free ( skip );
 }
 
+void jsw_sseed ( jsw_skip_t * const skip, const uint64_t seed )
+{
+  skip->rng = seed;
+}
+
+void jsw_sfinger ( jsw_skip_t * const skip, const int finger )
+{
+  skip->finger = finger;
+}
+
 void *jsw_sfind ( jsw_skip_t * const skip, const void * const item )
 {
   jsw_node_t *p = locate ( skip, item )->next[0];
 
-  if ( p != NULL && skip->cmp ( item, p->item, skip->priv ) == 0 )
+  if ( p != NULL && cmp_item ( skip, item, p->item ) == 0 )
     return p->item;
 
   return NULL;
@@ -266,19 +480,19 @@ int jsw_sinsert ( jsw_skip_t * const skip, void * const item )
   void *p = locate ( skip, item )->item;
 
   if ( p != NULL &&
-       skip->cmp ( item, p, skip->priv ) == 0 ) {
+       cmp_item ( skip, item, p ) == 0 ) {
     return 0;
   }
 
   /* Try to allocate before making changes */
-  size_t h = rlevel ( skip->maxh );
+  size_t h = rlevel ( skip );
   void *dup = skip->dup ( item, skip->priv );
   jsw_node_t *it;
 
   if ( dup == NULL )
     return 0;
 
-  it = new_node ( dup, h );
+  it = new_node ( skip, dup, h );
 
   if ( it == NULL ) {
     skip->rel ( dup, skip->priv );
@@ -303,9 +517,12 @@ int jsw_sinsert ( jsw_skip_t * const skip, void * const item )
 
     /* Node not used ?? (Memory leak noted by scan-build.) */
     if ( it_assigned == 1 ) {
+      it->prev = skip->fix[0];
+      if ( it->next[0] != NULL )
+        it->next[0]->prev = it;
       ++skip->size;
     } else {
-      delete_node( it );
+      delete_node ( skip, it );
     }
   }
 
@@ -316,7 +533,7 @@ int jsw_serase ( jsw_skip_t * const skip, void *item )
 {
   jsw_node_t *p = locate ( skip, item )->next[0];
 
-  if ( p == NULL || skip->cmp ( item, p->item, skip->priv ) != 0 )
+  if ( p == NULL || cmp_item ( skip, item, p->item ) != 0 )
     return 0;
   else {
     size_t i;
@@ -329,8 +546,11 @@ int jsw_serase ( jsw_skip_t * const skip, void *item )
       skip->fix[i]->next[i] = p->next[i];
     }
 
+    if ( p->next[0] != NULL )
+      p->next[0]->prev = p->prev;
+
     skip->rel ( p->item, skip->priv );
-    delete_node ( p );
+    delete_node ( skip, p );
 
     /* Lower height if necessary */
     while ( skip->curh > 0 ) {
@@ -349,6 +569,55 @@ int jsw_serase ( jsw_skip_t * const skip, void *item )
   return 1;
 }
 
+size_t jsw_serase_range ( jsw_skip_t * const skip, 
+                          const void * const lo, 
+                          const void * const hi )
+{
+  jsw_node_t *first = locate ( skip, lo )->next[0];
+  jsw_node_t *end = NULL;
+  jsw_node_t *p, *save;
+  size_t i, n = 0;
+
+  /* Splice out the columns in the range at each level */
+  for ( i = 0; i < skip->curh; i++ ) {
+    p = skip->fix[i]->next[i];
+
+    while ( p != NULL && cmp_item ( skip, p->item, hi ) < 0 )
+      p = p->next[i];
+
+    skip->fix[i]->next[i] = p;
+
+    if ( i == 0 )
+      end = p;
+  }
+
+  if ( end != NULL )
+    end->prev = skip->fix[0];
+
+  /* Release the unlinked nodes */
+  for ( p = first; p != end; p = save ) {
+    save = p->next[0];
+    skip->rel ( p->item, skip->priv );
+    delete_node ( skip, p );
+    ++n;
+  }
+
+  /* Lower height if necessary */
+  while ( skip->curh > 0 ) {
+    if ( skip->head->next[skip->curh - 1] != NULL )
+      break;
+
+    --skip->curh;
+  }
+
+  /* Erasure invalidates traversal markers */
+  jsw_sreset ( skip );
+
+  skip->size -= n;
+
+  return n;
+}
+
 size_t jsw_ssize ( const jsw_skip_t * const skip )
 {
   return skip->size;
@@ -368,3 +637,55 @@ int jsw_snext ( jsw_skip_t * const skip )
 {
   return ( skip->curl = skip->curl->next[0] ) != NULL;
 }
+
+jsw_node_t *jsw_sfind_node ( jsw_skip_t * const skip, const void * const item )
+{
+  jsw_node_t *p = locate ( skip, item )->next[0];
+
+  if ( p != NULL && cmp_item ( skip, item, p->item ) == 0 )
+    return p;
+
+  return NULL;
+}
+
+jsw_node_t *jsw_sseek ( jsw_skip_t * const skip, const void * const item )
+{
+  return locate ( skip, item )->next[0];
+}
+
+jsw_node_t *jsw_sfirst ( const jsw_skip_t * const skip )
+{
+  return skip->head->next[0];
+}
+
+jsw_node_t *jsw_slast ( const jsw_skip_t * const skip )
+{
+  jsw_node_t *p = skip->head;
+  size_t i;
+
+  for ( i = skip->curh; i < (size_t)-1; i-- ) {
+    while ( p->next[i] != NULL )
+      p = p->next[i];
+  }
+
+  return p == skip->head ? NULL : p;
+}
+
+jsw_node_t *jsw_snode_next ( const jsw_node_t * const node )
+{
+  return node == NULL ? NULL : node->next[0];
+}
+
+jsw_node_t *jsw_snode_prev ( const jsw_skip_t * const skip,
+                             const jsw_node_t * const node )
+{
+  if ( node == NULL || node->prev == skip->head )
+    return NULL;
+
+  return node->prev;
+}
+
+void *jsw_snode_item ( const jsw_node_t * const node )
+{
+  return node == NULL ? NULL : node->item;
+}
@@ -9,6 +9,9 @@
  *  - addition of a pointer to user private data
  *  - addition of \e const qualifiers
  *  - the addition of \e doxygen comments
+ *  - a random level generator for each skip list
+ *  - links and \e long keys stored in the node
+ *  - finger search
  * 
  * The original file comments follow :
  *
@@ -35,15 +38,21 @@
 
 #ifdef __cplusplus
 #include <cstddef>
+#include <cstdint>
 using std::size_t;
+using std::uint64_t;
 extern "C" {
 #else
 #include <stddef.h>
+#include <stdint.h>
 #endif
 
   /** \e jsw_skip_t structure. An opaque type for a skip list. */
   typedef struct jsw_skip jsw_skip_t;
 
+  /** \e jsw_node_t structure. An opaque type for a skip list node. */
+  typedef struct jsw_node jsw_node_t;
+
   /** Compare two items in the \e jsw_skip_t.
    * 
    * Callback function to compare two items in the jsw_skip_t skip list. 
@@ -83,7 +92,8 @@ extern "C" {
    *
    * Create a new skip list with a maximum height of \e max.
    * \param max maximum height of the skip list
-   * \param cmp item key comparison callback function 
+   * \param cmp item key comparison callback function. If \e NULL then 
+   * each item begins with a \e long key that is compared inline.
    * \param dup item duplication callback function 
    * \param rel item deletion callback function 
    * \param priv \e void pointer to private data to be echoed by callbacks
@@ -102,6 +112,28 @@ extern "C" {
    */
   void jsw_sdelete ( jsw_skip_t *skip );
 
+  /** Seed the random level generator of a \e jsw_skip_t skip list
+   *
+   * Each skip list has its own random level generator. It is seeded from
+   * the current time when the skip list is created. Seeding it with a
+   * fixed value makes the heights of the inserted nodes reproducible.
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \param seed random level generator seed
+   */
+  void jsw_sseed ( jsw_skip_t * const skip, const uint64_t seed );
+
+  /** Select finger search in a \e jsw_skip_t skip list
+   *
+   * With finger search each search starts from the search path of the
+   * previous search instead of from the top of the skip list. Searching
+   * for an item at distance \e d from the previous item costs 
+   * \e O(lg \e d) rather than \e O(lg \e n). It suits near-sequential
+   * access and costs up to twice as many comparisons for random access.
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \param finger non-zero to select finger search
+   */
+  void jsw_sfinger ( jsw_skip_t * const skip, const int finger );
+
   /** Find an item in a \e jsw_skip_t skip list
    *
    * Given a pointer to an item representing the key to be found, search
@@ -131,6 +163,21 @@ extern "C" {
   */
   int jsw_serase ( jsw_skip_t * const skip, void *item );
 
+  /** Remove a range of items from a \e jsw_skip_t skip list
+   *
+   * Remove the items not less than \e lo and less than \e hi from the
+   * skip list and deallocate the memory for the items. The range is 
+   * located once and spliced out of each level so that the cost is 
+   * O(lg N + k) for \e k items removed.
+   * \param skip pointer to a \e jsw_skip_t instance of a skip list
+   * \param lo \e void pointer to a key for the start of the range
+   * \param hi \e void pointer to a key for the end of the range
+   * \return number of items removed
+   */
+  size_t jsw_serase_range ( jsw_skip_t * const skip, 
+                            const void * const lo, 
+                            const void * const hi );
+
   /** Get the size of the \e jsw_skip_t skip list.
    *
    * Returns the number of entries in the skip list at height 0
@@ -163,6 +210,67 @@ extern "C" {
    */
   int jsw_snext ( jsw_skip_t * const skip );
 
+  /** Find the node containing an item in a \e jsw_skip_t skip list
+   *
+   * Given a pointer to an item representing the key to be found, search
+   * the skip list for the node containing the item. Unlike \e jsw_sfind()
+   * the node can be used to traverse the skip list without changing the
+   * traversal markers.
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \param item \e void pointer to a key representing the item to be found.
+   * \return A pointer to the node found. \e NULL if not found.
+   */
+  jsw_node_t *jsw_sfind_node ( jsw_skip_t * const skip, 
+                               const void * const item );
+
+  /** Find the first node not less than an item in a \e jsw_skip_t skip list
+   *
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \param item \e void pointer to a key representing the item to be found.
+   * \return A pointer to the first node with an item not less than
+   * \e item. \e NULL if there is no such node.
+   */
+  jsw_node_t *jsw_sseek ( jsw_skip_t * const skip, const void * const item );
+
+  /** Get the first node in a \e jsw_skip_t skip list
+   *
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \return A pointer to the first node. \e NULL if the list is empty.
+   */
+  jsw_node_t *jsw_sfirst ( const jsw_skip_t * const skip );
+
+  /** Get the last node in a \e jsw_skip_t skip list
+   *
+   * Descends the columns from the header so that the cost is logarithmic.
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \return A pointer to the last node. \e NULL if the list is empty.
+   */
+  jsw_node_t *jsw_slast ( const jsw_skip_t * const skip );
+
+  /** Get the next node in a \e jsw_skip_t skip list
+   *
+   * \param node pointer to a \e jsw_node_t in the skip list
+   * \return A pointer to the next node. \e NULL if \e node is the last.
+   */
+  jsw_node_t *jsw_snode_next ( const jsw_node_t * const node );
+
+  /** Get the previous node in a \e jsw_skip_t skip list
+   *
+   * \param skip pointer to a \e jsw_skip_t instance
+   * \param node pointer to a \e jsw_node_t in the skip list
+   * \return A pointer to the previous node. \e NULL if \e node is the 
+   * first.
+   */
+  jsw_node_t *jsw_snode_prev ( const jsw_skip_t * const skip,
+                               const jsw_node_t * const node );
+
+  /** Get the item in a \e jsw_skip_t skip list node
+   *
+   * \param node pointer to a \e jsw_node_t in the skip list
+   * \return A pointer to the item. \e NULL if \e node is \e NULL.
+   */
+  void *jsw_snode_item ( const jsw_node_t * const node );
+
 #ifdef __cplusplus
 }
 #endif
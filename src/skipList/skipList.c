@@ -80,6 +80,19 @@ static void skipList_rel(void * const item, void * const priv)
   return;
 }
 
+compare_e
+skipListCompLong(const void * const a,
+                 const void * const b,
+                 void * const user)
+{
+  const long x = *(const long *)a;
+  const long y = *(const long *)b;
+
+  (void)user;
+
+  return (x < y) ? compareLesser : ((y < x) ? compareGreater : compareEqual);
+}
+
 skipList_t *
 skipListCreate(const size_t space,
                const skipListAllocFunc_t alloc, 
@@ -121,7 +134,9 @@ skipListCreate(const size_t space,
       return NULL;
     }
 
-  skip->skip = jsw_snew(space, skipList_cmp, skipList_dup, skipList_rel, skip);
+  skip->skip = jsw_snew(space, 
+                        (comp == skipListCompLong) ? NULL : skipList_cmp,
+                        skipList_dup, skipList_rel, skip);
   if (skip->skip == NULL)
     {
       dealloc(skip, user);
@@ -140,6 +155,38 @@ skipListCreate(const size_t space,
   return skip;
 }
 
+void
+skipListSeed(skipList_t * const skip, const uint64_t seed)
+{
+  if (skip == NULL)
+    {
+      return;
+    }
+  if (skip->skip == NULL)
+    {
+      skip->debug(__func__, __LINE__, skip->user, "skip->skip == NULL!");
+      return;
+    }
+
+  jsw_sseed(skip->skip, seed);
+}
+
+void
+skipListSetFinger(skipList_t * const skip, const bool finger)
+{
+  if (skip == NULL)
+    {
+      return;
+    }
+  if (skip->skip == NULL)
+    {
+      skip->debug(__func__, __LINE__, skip->user, "skip->skip == NULL!");
+      return;
+    }
+
+  jsw_sfinger(skip->skip, finger ? 1 : 0);
+}
+
 void *
 skipListFind(skipList_t * const skip, void * const entry)
 {
@@ -201,9 +248,33 @@ skipListRemove(skipList_t * const skip, void * const entry)
       return NULL;
     }
 
+  /* jsw_serase() has deleted the entry */
+  if (skip->deleteEntry != NULL)
+    {
+      return NULL;
+    }
+
   return found;
 }
 
+size_t
+skipListRemoveRange(skipList_t * const skip, 
+                    const void * const lo,
+                    const void * const hi)
+{
+  if ((skip == NULL) || (lo == NULL) || (hi == NULL))
+    {
+      return 0;
+    }
+  if (skip->skip == NULL)
+    {
+      skip->debug(__func__, __LINE__, skip->user, "skip->skip == NULL!");
+      return 0;
+    }
+
+  return jsw_serase_range(skip->skip, lo, hi);
+}
+
 void
 skipListClear(skipList_t * const skip)
 {
@@ -281,13 +352,7 @@ skipListGetMax(skipList_t * const skip)
       return NULL;
     }
 
-  jsw_sreset(skip->skip);
-  void *item = jsw_sitem(skip->skip);
-  while(jsw_snext(skip->skip))
-    {
-      item = jsw_sitem(skip->skip);
-    }
-  return item;
+  return jsw_snode_item(jsw_slast(skip->skip));
 }
 
 void *
@@ -324,15 +389,14 @@ skipListGetNext(skipList_t * const skip, const void * const entry)
       return NULL;
     }
 
-  void *this_item = jsw_sfind(skip->skip, entry);
-  if (this_item == NULL)
+  jsw_node_t *node = jsw_sfind_node(skip->skip, entry);
+  if (node == NULL)
     {
       skip->debug(__func__, __LINE__, skip->user, "entry not found!!");
       return NULL;
     }
 
-  jsw_snext(skip->skip);
-  return jsw_sitem(skip->skip);
+  return jsw_snode_item(jsw_snode_next(node));
 }
 
 void *
@@ -352,26 +416,120 @@ skipListGetPrevious(skipList_t * const skip, const void * const entry)
       return NULL;
     }
 
-  void *this_item = jsw_sfind(skip->skip, entry);
-  if (this_item == NULL)
+  jsw_node_t *node = jsw_sfind_node(skip->skip, entry);
+  if (node == NULL)
     {
       skip->debug(__func__, __LINE__, skip->user, "entry not found!!");
       return NULL;
     }
 
-  jsw_sreset(skip->skip);
-  void *prev_item = jsw_sitem(skip->skip);
-  while(jsw_snext(skip->skip))
+  return jsw_snode_item(jsw_snode_prev(skip->skip, node));
+}
+
+skipListCursor_t *
+skipListCursorCreate(skipList_t * const skip)
+{
+  skipListCursor_t *cursor;
+
+  if (skip == NULL)
     {
-      void *next_item = jsw_sitem(skip->skip);
-      if (next_item == this_item)
-        {
-          return prev_item;
-        }
-      prev_item = next_item;
+      return NULL;
+    }
+
+  cursor = (skip->alloc)(sizeof(skipListCursor_t), skip->user);
+  if (cursor == NULL)
+    {
+      skip->debug(__func__, __LINE__, skip->user, 
+                  "Can't allocate %zu for skipListCursor_t",
+                  sizeof(skipListCursor_t));
+      return NULL;
     }
+  cursor->list = skip;
+  cursor->node = NULL;
 
-  return NULL;
+  return cursor;
+}
+
+void
+skipListCursorDestroy(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return;
+    }
+
+  (cursor->list->dealloc)(cursor, cursor->list->user);
+}
+
+void *
+skipListCursorSeek(skipListCursor_t * const cursor, const void * const entry)
+{
+  if ((cursor == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  cursor->node = jsw_sseek(cursor->list->skip, entry);
+  return jsw_snode_item(cursor->node);
+}
+
+void *
+skipListCursorFirst(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = jsw_sfirst(cursor->list->skip);
+  return jsw_snode_item(cursor->node);
+}
+
+void *
+skipListCursorLast(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = jsw_slast(cursor->list->skip);
+  return jsw_snode_item(cursor->node);
+}
+
+void *
+skipListCursorNext(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = jsw_snode_next(cursor->node);
+  return jsw_snode_item(cursor->node);
+}
+
+void *
+skipListCursorPrevious(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  cursor->node = jsw_snode_prev(cursor->list->skip, cursor->node);
+  return jsw_snode_item(cursor->node);
+}
+
+void *
+skipListCursorEntry(const skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  return jsw_snode_item(cursor->node);
 }
 
 bool
@@ -401,6 +559,41 @@ skipListWalk(skipList_t * const skip, const skipListWalkFunc_t walk)
   return true;
 }
 
+bool
+skipListWalkRange(skipList_t * const skip,
+                  const void * const lo,
+                  const void * const hi,
+                  const skipListWalkFunc_t walk)
+{
+  if ((skip == NULL) || (lo == NULL) || (hi == NULL) || (walk == NULL))
+    {
+      return false;
+    }
+  if (skip->skip == NULL)
+    {
+      skip->debug(__func__, __LINE__, skip->user, "skip->skip == NULL!");
+      return false;
+    }
+
+  jsw_node_t *node = jsw_sseek(skip->skip, lo);
+  while (node != NULL)
+    {
+      jsw_node_t *next = jsw_snode_next(node);
+      void *item = jsw_snode_item(node);
+      if (skip->compare(item, hi, skip->user) != compareLesser)
+        {
+          break;
+        }
+      if (walk(item, skip->user) == false)
+        {
+          return false;
+        }
+      node = next;
+    }
+
+  return true;
+}
+
 bool
 skipListCheck(skipList_t * const skip)
 {
@@ -414,18 +607,39 @@ skipListCheck(skipList_t * const skip)
       return false;
     }
 
-  jsw_sreset(skip->skip);
-  void *b = jsw_sitem(skip->skip);
-  while((b != NULL) && jsw_snext(skip->skip))
+  /* Check the order and the previous node links at level 0 */
+  jsw_node_t *prev = NULL;
+  jsw_node_t *node = jsw_sfirst(skip->skip);
+  size_t count = 0;
+  while (node != NULL)
     {
-      void *a = jsw_sitem(skip->skip);
-      if (skip->compare(a,b,skip->user) == compareLesser)
+      if (jsw_snode_prev(skip->skip, node) != prev)
+        {
+          skip->debug(__func__, __LINE__, skip->user, 
+                      "previous node link failed!");
+          return false;
+        }
+      if ((prev != NULL) && 
+          (skip->compare(jsw_snode_item(node), jsw_snode_item(prev),
+                         skip->user) == compareLesser))
         {
           skip->debug(__func__, __LINE__, skip->user, 
                       "skip->compare() failed!");
           return false;
         }
-      b=a;
+      prev = node;
+      node = jsw_snode_next(node);
+      count = count+1;
+    }
+  if (jsw_slast(skip->skip) != prev)
+    {
+      skip->debug(__func__, __LINE__, skip->user, "last node failed!");
+      return false;
+    }
+  if (count != jsw_ssize(skip->skip))
+    {
+      skip->debug(__func__, __LINE__, skip->user, "size failed!");
+      return false;
     }
 
   return true;
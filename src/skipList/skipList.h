@@ -6,6 +6,14 @@
  * [1] "Skip Lists: A Probabilistic Alternative to Balanced Trees", William
  *     Pugh, Commun. ACM, June 1990, Vol. 33, No. 6, pp 668-676
  * [2] http://eternallyconfuzzled.com/tuts/datastructures/jsw_tut_skip.aspx
+ *
+ * The same interface is implemented by the lock-free skip list in
+ * skipListLockFree.c. Its skipListFind(), skipListGetMin(),
+ * skipListGetMax(), skipListGetNext() and skipListGetPrevious() return a
+ * pointer to the entry in the skip list. If \e deleteEntry() exists,
+ * another thread removing that entry may delete it as soon as the call
+ * returns, so the pointer is only safe to use while no other thread can
+ * remove the entry. A cursor keeps the entry at the cursor alive.
  */
 
 #if !defined(SKIP_LIST_H)
@@ -17,13 +25,16 @@
 #include <cstdlib>
 #include <cstdbool>
 #include <cstddef>
+#include <cstdint>
 using std::size_t;
+using std::uint64_t;
 extern "C" {
 #else
 #include <stdarg.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #endif
 
 #include "compare.h"
@@ -33,6 +44,12 @@ extern "C" {
  */
 typedef struct skipList_t skipList_t; 
 
+/**
+ * \e skipListCursor_t structure. An opaque type for a position in a
+ * skip list.
+ */
+typedef struct skipListCursor_t skipListCursor_t; 
+
 /**
  * \e skipList_t memory allocator.
  *
@@ -122,6 +139,23 @@ typedef compare_e (*skipListCompFunc_t)(const void * const a,
  */
 typedef bool (*skipListWalkFunc_t)(void *entry, void * const user);
 
+/**
+ * Compare two entries with \e long keys.
+ * 
+ * Compares entries that begin with a \e long key. A skip list created
+ * with this function as the \e comp callback does not call it when
+ * searching. Instead the skip list uses a specialisation of the search
+ * that compares the keys inline.
+ *
+ * \param a pointer to an entry beginning with a \e long key
+ * \param b pointer to an entry beginning with a \e long key
+ * \param user \e void pointer to user data (unused)
+ * \return \e compare_e value
+ */
+compare_e skipListCompLong(const void * const a,
+                           const void * const b,
+                           void * const user);
+
 /**
  * Create an empty skip list.
  * 
@@ -146,6 +180,35 @@ skipList_t *skipListCreate(const size_t space,
                            const skipListCompFunc_t comp,
                            void * const user);
 
+/**
+ * Seed the random level generator of the skip list.
+ *
+ * Each skip list has its own generator for the heights of the inserted
+ * nodes. Seeding it with a fixed value makes the shape of the skip list,
+ * and so the cost of each operation, reproducible for a given sequence of
+ * operations.
+ *
+ * \param list \e skipList_t pointer
+ * \param seed random level generator seed
+ */
+void skipListSeed(skipList_t * const list, const uint64_t seed);
+
+/**
+ * Select finger search in the skip list.
+ *
+ * With finger search each search starts from the search path of the
+ * previous search rather than from the top of the skip list. Finding,
+ * inserting or removing an entry near the previous one, for example when
+ * entries arrive in nearly sorted order, then costs \e O(lg \e d) for a
+ * distance of \e d entries instead of \e O(lg \e n). Random access costs
+ * up to twice as many comparisons. Finger search is a hint and does not
+ * change the result of any operation.
+ *
+ * \param list \e skipList_t pointer
+ * \param finger \e true to select finger search
+ */
+void skipListSetFinger(skipList_t * const list, const bool finger);
+
 /**
  * Find an entry in the skip list.
  *
@@ -197,6 +260,24 @@ void *skipListInsert(skipList_t * const list, void * const entry);
  */
 void *skipListRemove(skipList_t * const list, void * const entry);
 
+/** 
+ * Remove a range of entries from the skip list.
+ *
+ * Removes the entries not less than \e lo and less than \e hi. The range 
+ * is located once and spliced out of each level of the skip list in
+ * O(lg N + k) for \e k entries removed. If the \e deleteEntry() callback
+ * has been defined then that function will be called to deallocate the
+ * caller's entry memory when the entries are removed.
+ *
+ * \param list \e skipList_t pointer
+ * \param lo \e void pointer to caller's entry data for the start of the range
+ * \param hi \e void pointer to caller's entry data for the end of the range
+ * \return number of entries removed
+ */
+size_t skipListRemoveRange(skipList_t * const list, 
+                           const void * const lo,
+                           const void * const hi);
+
 /**
  * Clear the skip list.
  *
@@ -277,6 +358,86 @@ void *skipListGetNext(skipList_t * const list, const void * const entry);
  */
 void *skipListGetPrevious(skipList_t * const list, const void * const entry);
 
+/**
+ * Create a cursor for the skip list.
+ *
+ * A cursor refers to an entry in the skip list. Moving a cursor to the
+ * next or previous entry follows a pointer rather than searching the skip
+ * list. Any number of cursors may refer to the same skip list. A cursor
+ * referring to an entry is invalidated when that entry is removed. A new
+ * cursor does not refer to an entry.
+ *
+ * \param list pointer to \e skipList_t
+ * \return pointer to a \e skipListCursor_t. \e NULL indicates failure.
+ */
+skipListCursor_t *skipListCursorCreate(skipList_t * const list);
+
+/**
+ * Destroy a skip list cursor.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ */
+void skipListCursorDestroy(skipListCursor_t * const cursor);
+
+/**
+ * Move a skip list cursor to an entry.
+ *
+ * Moves the cursor to the first entry in the skip list that is not less
+ * than \e entry.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ * \param entry \e void pointer to caller's entry data
+ * \return \e void pointer to the entry at the cursor. \e NULL if all the
+ * entries in the skip list are less than \e entry.
+ */
+void *skipListCursorSeek(skipListCursor_t * const cursor,
+                         const void * const entry);
+
+/**
+ * Move a skip list cursor to the minimum entry.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * skip list is empty.
+ */
+void *skipListCursorFirst(skipListCursor_t * const cursor);
+
+/**
+ * Move a skip list cursor to the maximum entry.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * skip list is empty.
+ */
+void *skipListCursorLast(skipListCursor_t * const cursor);
+
+/**
+ * Move a skip list cursor to the next entry.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor was at the maximum entry or did not refer to an entry.
+ */
+void *skipListCursorNext(skipListCursor_t * const cursor);
+
+/**
+ * Move a skip list cursor to the previous entry.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor was at the minimum entry or did not refer to an entry.
+ */
+void *skipListCursorPrevious(skipListCursor_t * const cursor);
+
+/**
+ * Get the entry at a skip list cursor.
+ *
+ * \param cursor pointer to \e skipListCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor does not refer to an entry.
+ */
+void *skipListCursorEntry(const skipListCursor_t * const cursor);
+
 /** 
  * Operate on each skip list entry.
  *
@@ -288,6 +449,23 @@ void *skipListGetPrevious(skipList_t * const list, const void * const entry);
  */
 bool skipListWalk(skipList_t * const list, const skipListWalkFunc_t walk);
 
+/** 
+ * Operate on a range of skip list entries.
+ *
+ * Traverses the entries not less than \e lo and less than \e hi in 
+ * increasing order calling a function for each entry.
+ *
+ * \param list pointer to \e skipList_t
+ * \param lo \e void pointer to caller's entry data for the start of the range
+ * \param hi \e void pointer to caller's entry data for the end of the range
+ * \param walk pointer to a callback function to be called for each entry
+ * \return \e bool indicating sucess
+ */
+bool skipListWalkRange(skipList_t * const list, 
+                       const void * const lo,
+                       const void * const hi,
+                       const skipListWalkFunc_t walk);
+
 /** 
  * Check the skip list.
  *
@@ -1,11 +1,51 @@
 # Programs in this directory
-skipList_PROGRAMS:=skipList_interp
+skipList_PROGRAMS:=skipList_interp skipListLockFree_interp \
+  skipListLockFree_test skipListSeed_test skipListLockFreeSeed_test \
+  skipListCompLong_test skipListLockFreeCompLong_test
 PROGRAMS+=$(skipList_PROGRAMS)
 
 VPATH += src/skipList
 
+# Suppress sanitizer warnings like:
+#   src/skipList/jsw_slib.c:223:15: \
+#     runtime error: index 1 out of bounds for type 'jsw_node *[1]'
+$(call add_extra_CFLAGS_macro,jsw_slib.c,-fno-sanitize=bounds-strict)
+
 skipList_interp_C_SOURCES := jsw_slib.c jsw_rand.c skipList.c skipList_wrapper.c
 
 skipList_interp_STATIC_LIBRARIES := interp.a
 
 $(call add_extra_CFLAGS_macro,$(skipList_interp_C_SOURCES),-Isrc/interp)
+
+skipListLockFree_interp_C_SOURCES := skipListLockFree.c skipList_wrapper.c
+
+skipListLockFree_interp_STATIC_LIBRARIES := interp.a
+
+$(call add_extra_CFLAGS_macro,$(skipListLockFree_interp_C_SOURCES),-Isrc/interp)
+
+skipListLockFree_test_C_SOURCES := skipListLockFree_test.c skipListLockFree.c
+
+$(call add_extra_CFLAGS_macro,$(skipListLockFree_test_C_SOURCES),-Isrc/interp)
+$(call add_extra_LIBS_macro,skipListLockFree_test,-lpthread)
+
+skipListSeed_test_C_SOURCES := skipListSeed_test.c jsw_slib.c jsw_rand.c \
+  skipList.c
+
+$(call add_extra_CFLAGS_macro,$(skipListSeed_test_C_SOURCES),-Isrc/interp)
+
+skipListLockFreeSeed_test_C_SOURCES := skipListSeed_test.c skipListLockFree.c
+
+$(call add_extra_CFLAGS_macro,$(skipListLockFreeSeed_test_C_SOURCES),\
+-Isrc/interp)
+
+skipListCompLong_test_C_SOURCES := skipListCompLong_test.c jsw_slib.c \
+  jsw_rand.c skipList.c
+
+$(call add_extra_CFLAGS_macro,$(skipListCompLong_test_C_SOURCES),\
+-Isrc/interp)
+
+skipListLockFreeCompLong_test_C_SOURCES := skipListCompLong_test.c \
+  skipListLockFree.c
+
+$(call add_extra_CFLAGS_macro,$(skipListLockFreeCompLong_test_C_SOURCES),\
+-Isrc/interp)
@@ -0,0 +1,181 @@
+/*
+ * skipListCompLong_test.c
+ *
+ * A skip list created with skipListCompLong() compares the long keys at
+ * the start of the entries inline rather than through a callback.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "skipList.h"
+
+typedef struct entry_t
+{
+  long key;
+  long value;
+}
+entry_t;
+
+static unsigned long seed;
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void *
+DuplicateEntry(void * const entry, void * const user)
+{
+  entry_t *copy;
+
+  (void)user;
+  copy = malloc(sizeof(entry_t));
+  if (copy != NULL)
+    {
+      *copy = *(entry_t *)entry;
+    }
+  return copy;
+}
+
+static
+bool
+DeleteEntry(void * const entry, void * const user)
+{
+  (void)user;
+  free(entry);
+  return true;
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+bool
+Show(void * const entry, void * const user)
+{
+  (void)user;
+  printf(" %ld:%ld", ((entry_t *)entry)->key, ((entry_t *)entry)->value);
+  return true;
+}
+
+static
+long
+Random(const long n)
+{
+  seed = (seed*1103515245UL)+12345UL;
+  return (long)((seed>>16)%(unsigned long)n);
+}
+
+int main(void)
+{
+  skipList_t *list;
+  skipListCursor_t *cursor;
+  entry_t entry;
+  entry_t *found;
+  size_t count;
+  long k;
+
+  list = skipListCreate(8, Alloc, Dealloc, DuplicateEntry, DeleteEntry,
+                        Debug, skipListCompLong, NULL);
+  if (list == NULL)
+    {
+      fprintf(stderr, "skipListCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  skipListSeed(list, 1);
+
+  for (k=0; k<20; k++)
+    {
+      entry.key = (k*7)%20;
+      entry.value = entry.key*10;
+      if (skipListInsert(list, &entry) == NULL)
+        {
+          printf("insert %ld failed\n", entry.key);
+        }
+    }
+  printf("size: %zu check %s\n", skipListGetSize(list),
+         skipListCheck(list) ? "true" : "false");
+  entry.key = 13;
+  found = skipListFind(list, &entry);
+  printf("find: %ld:%ld\n", found->key, found->value);
+  entry.key = 21;
+  printf("find missing: %s\n",
+         (skipListFind(list, &entry) == NULL) ? "NULL" : "entry");
+  entry.key = 13;
+  (void)skipListRemove(list, &entry);
+  printf("find removed: %s\n",
+         (skipListFind(list, &entry) == NULL) ? "NULL" : "entry");
+  entry.key = 12;
+  found = skipListGetNext(list, &entry);
+  printf("next: %ld\n", found->key);
+  entry.key = 14;
+  found = skipListGetPrevious(list, &entry);
+  printf("previous: %ld\n", found->key);
+  for (k=0; k<20; k+=2)
+    {
+      entry.key = k;
+      (void)skipListRemove(list, &entry);
+    }
+  printf("walk:");
+  (void)skipListWalk(list, Show);
+  printf("\n");
+
+  seed = 1;
+  for (k=0; k<2000; k++)
+    {
+      entry.key = Random(1000);
+      entry.value = k;
+      (void)skipListInsert(list, &entry);
+      entry.key = Random(1000);
+      (void)skipListRemove(list, &entry);
+    }
+  printf("check: %s\n", skipListCheck(list) ? "true" : "false");
+  cursor = skipListCursorCreate(list);
+  count = 0;
+  printf("ordered:");
+  for (found = skipListCursorFirst(cursor);
+       found != NULL;
+       found = skipListCursorNext(cursor))
+    {
+      if ((count > 0) && (found->key < entry.key))
+        {
+          printf(" %ld after %ld", found->key, entry.key);
+        }
+      entry = *found;
+      count++;
+    }
+  printf(" %s\n", (count == skipListGetSize(list)) ? "all" : "not all");
+  skipListCursorDestroy(cursor);
+  skipListClear(list);
+  printf("size after clear: %zu\n", skipListGetSize(list));
+  skipListDestroy(list);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,1357 @@
+/**
+ * \file skipListLockFree.c
+ *
+ * A lock-free skipList_t implementation.
+ *
+ * The links of the skip list are updated with compare-and-swap so that
+ * the operations of several threads sharing a skip list need no lock. A
+ * node is removed by marking the low bit of its links, from the top level
+ * down to level 0. The thread that marks level 0 removes the entry. Marked
+ * nodes are unlinked by later searches. An unlinked node may still be in
+ * use by another thread so it is not deallocated until the epoch of the
+ * skip list has advanced twice, by which time every operation that might
+ * have referred to it has finished. An operation in progress announces
+ * the epoch at which it started in an epoch slot of the skip list.
+ *
+ * The callback functions must be safe to call from several threads.
+ * skipListRemoveRange() and skipListClear() remove entries one by one.
+ * skipListSeed(), skipListCheck() and skipListDestroy() must not run
+ * concurrently with other operations. skipListSetFinger() has no effect
+ * because a search path shared by threads would be stale as soon as it
+ * was stored. A cursor occupies an epoch slot only during each call and
+ * keeps the node at the cursor from being deallocated between calls.
+ *
+ * skipListFind(), skipListGetMin(), skipListGetMax(), skipListGetNext()
+ * and skipListGetPrevious() return a pointer to the entry held by the
+ * skip list, not a copy, and no longer occupy an epoch slot when they
+ * return. If \e deleteEntry() exists then another thread that removes the
+ * entry may cause it to be deleted at any time after the call returns, so
+ * the pointer may only be used while no other thread can remove the
+ * entry. Otherwise the caller owns the entries and decides their lifetime.
+ * A cursor keeps its entry from being deleted while the cursor is at it.
+ * skipListRemove() returns \e NULL if \e deleteEntry() exists because the
+ * entry is deleted when its node is deallocated.
+ */
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "skipList.h"
+#include "skipListLockFree_private.h"
+
+/**
+ * Mark bit of a link to the next node.
+ */
+#define SKIP_LIST_LOCK_FREE_MARK ((uintptr_t)1)
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Get the node referred to by a marked link.
+ *
+ * \param link marked link
+ * \return pointer to the node
+ */
+static skipListNode_t *
+skipListLink(const uintptr_t link)
+{
+  return (skipListNode_t *)(link & ~SKIP_LIST_LOCK_FREE_MARK);
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Test the mark bit of a link.
+ *
+ * \param link marked link
+ * \return \e true if the link is marked
+ */
+static bool
+skipListMarked(const uintptr_t link)
+{
+  return (link & SKIP_LIST_LOCK_FREE_MARK) != 0;
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Test whether a node has been removed from the skip list.
+ *
+ * \param node pointer to the node
+ * \return \e true if the link of the node at level 0 is marked
+ */
+static bool
+skipListRemoved(skipListNode_t * const node)
+{
+  return skipListMarked(atomic_load(&node->next[0]));
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Get the first node at level 0 after a node that has not been removed.
+ *
+ * \param node pointer to the node
+ * \return pointer to the next node. \e NULL if there is none.
+ */
+static skipListNode_t *
+skipListNextNode(skipListNode_t * const node)
+{
+  skipListNode_t *next = skipListLink(atomic_load(&node->next[0]));
+
+  while ((next != NULL) && skipListRemoved(next))
+    {
+      next = skipListLink(atomic_load(&next->next[0]));
+    }
+
+  return next;
+}
+
+/**
+ * Mask of the count of operations occupying an epoch slot.
+ */
+#define SKIP_LIST_LOCK_FREE_SLOT_MASK \
+  (((size_t)1<<SKIP_LIST_LOCK_FREE_SLOT_BITS)-1)
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Occupy an epoch slot and announce the current epoch in it. The search
+ * for a free slot starts at a slot chosen from the stack address of the
+ * caller so that threads tend to use different slots. If every slot is
+ * occupied then the caller shares a slot with the operations occupying it
+ * rather than waiting for a slot to be freed.
+ *
+ * \param skip pointer to skip list
+ * \return index of the slot
+ */
+static size_t
+skipListPin(skipList_t * const skip)
+{
+  char here;
+  uintptr_t addr = (uintptr_t)&here;
+  size_t start = (size_t)((addr>>12)^(addr>>20))%SKIP_LIST_LOCK_FREE_SLOTS;
+  size_t epoch = atomic_load(&skip->epoch);
+
+  /* Look for a free slot */
+  for (size_t s = 0; s < SKIP_LIST_LOCK_FREE_SLOTS; s++)
+    {
+      size_t slot = (start+s)%SKIP_LIST_LOCK_FREE_SLOTS;
+      size_t expected = 0;
+
+      if (atomic_compare_exchange_strong(&skip->slots[slot].state, &expected,
+                                         (epoch<<SKIP_LIST_LOCK_FREE_SLOT_BITS)
+                                         |1))
+        {
+          return slot;
+        }
+    }
+
+  /* Share a slot */
+  for (size_t slot = start; ; slot = (slot+1)%SKIP_LIST_LOCK_FREE_SLOTS)
+    {
+      size_t state = atomic_load(&skip->slots[slot].state);
+
+      while ((state&SKIP_LIST_LOCK_FREE_SLOT_MASK) !=
+             SKIP_LIST_LOCK_FREE_SLOT_MASK)
+        {
+          size_t next = state+1;
+          if (state == 0)
+            {
+              epoch = atomic_load(&skip->epoch);
+              next = (epoch<<SKIP_LIST_LOCK_FREE_SLOT_BITS)|1;
+            }
+          if (atomic_compare_exchange_weak(&skip->slots[slot].state, &state,
+                                           next))
+            {
+              return slot;
+            }
+        }
+    }
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Leave an epoch slot. The slot is free when the last operation occupying
+ * it leaves.
+ *
+ * \param skip pointer to skip list
+ * \param slot index of the slot
+ */
+static void
+skipListUnpin(skipList_t * const skip, const size_t slot)
+{
+  size_t state = atomic_load(&skip->slots[slot].state);
+
+  while (!atomic_compare_exchange_weak(&skip->slots[slot].state, &state,
+                                       ((state&SKIP_LIST_LOCK_FREE_SLOT_MASK)
+                                        == 1) ? 0 : state-1))
+    {
+    }
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Deallocate a node and delete its entry.
+ *
+ * \param skip pointer to skip list
+ * \param node pointer to the node
+ */
+static void
+skipListDeleteNode(skipList_t * const skip, skipListNode_t * const node)
+{
+  if ((skip->deleteEntry != NULL) && (node->entry != NULL))
+    {
+      skip->deleteEntry(node->entry, skip->user);
+    }
+  skip->dealloc(node, skip->user);
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Advance the epoch if every occupied slot has announced the current
+ * epoch, then deallocate the retired nodes that were retired at least two
+ * epochs ago and that no cursor is at. The remaining retired nodes are
+ * returned to the list.
+ *
+ * \param skip pointer to skip list
+ */
+static void
+skipListReclaim(skipList_t * const skip)
+{
+  size_t epoch = atomic_load(&skip->epoch);
+
+  for (size_t s = 0; s < SKIP_LIST_LOCK_FREE_SLOTS; s++)
+    {
+      size_t state = atomic_load(&skip->slots[s].state);
+
+      if ((state != 0) && ((state>>SKIP_LIST_LOCK_FREE_SLOT_BITS) != epoch))
+        {
+          return;
+        }
+    }
+  atomic_compare_exchange_strong(&skip->epoch, &epoch, epoch+1);
+  epoch = atomic_load(&skip->epoch);
+
+  skipListNode_t *node = atomic_exchange(&skip->retired, NULL);
+  skipListNode_t *keep = NULL;
+  skipListNode_t *tail = NULL;
+  while (node != NULL)
+    {
+      skipListNode_t *next = node->retired;
+
+      if ((node->retireEpoch+2 <= epoch) && (atomic_load(&node->refs) == 0))
+        {
+          skipListDeleteNode(skip, node);
+        }
+      else
+        {
+          if (keep == NULL)
+            {
+              tail = node;
+            }
+          node->retired = keep;
+          keep = node;
+        }
+      node = next;
+    }
+  if (keep == NULL)
+    {
+      return;
+    }
+
+  skipListNode_t *head = atomic_load(&skip->retired);
+  do
+    {
+      tail->retired = head;
+    }
+  while (!atomic_compare_exchange_weak(&skip->retired, &head, keep));
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Add a node that has been unlinked from every level to the retired list.
+ *
+ * \param skip pointer to skip list
+ * \param node pointer to the node
+ * \return \e true if it is time to attempt to reclaim retired nodes
+ */
+static bool
+skipListRetire(skipList_t * const skip, skipListNode_t * const node)
+{
+  node->retireEpoch = atomic_load(&skip->epoch);
+
+  skipListNode_t *head = atomic_load(&skip->retired);
+  do
+    {
+      node->retired = head;
+    }
+  while (!atomic_compare_exchange_weak(&skip->retired, &head, node));
+
+  size_t retires = atomic_fetch_add(&skip->retires, 1)+1;
+  return (retires%SKIP_LIST_LOCK_FREE_RECLAIM) == 0;
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Choose the height of a new node with the random level generator of the
+ * epoch slot occupied by the caller. The height is one more than the
+ * number of trailing zero bits of a random number so that each level is
+ * added with probability 1/2.
+ *
+ * \param skip pointer to skip list
+ * \param slot index of the slot
+ * \return height of the new node
+ */
+static size_t
+skipListRandomHeight(skipList_t * const skip, const size_t slot)
+{
+  uint64_t z = atomic_fetch_add(&skip->slots[slot].rand,
+                                UINT64_C(0x9e3779b97f4a7c15))+
+               UINT64_C(0x9e3779b97f4a7c15);
+
+  z = (z^(z>>30))*UINT64_C(0xbf58476d1ce4e5b9);
+  z = (z^(z>>27))*UINT64_C(0x94d049bb133111eb);
+  z = z^(z>>31);
+
+  size_t height = 64;
+  if (z != 0)
+    {
+#if defined(__GNUC__)
+      height = (size_t)__builtin_ctzll(z);
+#else
+      for (height = 0; (z&1) == 0; height++)
+        {
+          z = z>>1;
+        }
+#endif
+    }
+  height = height+1;
+  if (height > skip->maxHeight)
+    {
+      height = skip->maxHeight;
+    }
+
+  return height;
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Find the last node before \e entry and the first node not before
+ * \e entry at each level, unlinking the removed nodes passed on the way.
+ * The caller must occupy an epoch slot.
+ *
+ * The skip list may hold several entries that compare equal and their
+ * order may differ between levels. If \e sweep is \e true then the removed
+ * nodes among the entries equal to \e entry are also unlinked at each
+ * level.
+ *
+ * \param skip pointer to skip list
+ * \param entry pointer to an entry defined by the caller
+ * \param height number of levels to search. At least the height of the
+ * tallest node inserted is searched.
+ * \param sweep \e true to unlink removed nodes equal to \e entry
+ * \param preds array of last nodes before \e entry at each level
+ * \param succs array of first nodes not before \e entry at each level
+ * \return \e true if \e succs[0] compares equal to \e entry
+ */
+static bool
+skipListFindNodes(skipList_t * const skip,
+                  const void * const entry,
+                  size_t height,
+                  const bool sweep,
+                  skipListNode_t ** const preds,
+                  skipListNode_t ** const succs)
+{
+  size_t top = atomic_load(&skip->height);
+  if (height < top)
+    {
+      height = top;
+    }
+
+ retry:
+  {
+    skipListNode_t *pred = skip->head;
+    skipListNode_t *curr = NULL;
+
+    for (size_t level = height; level-- > 0; )
+      {
+        curr = skipListLink(atomic_load(&pred->next[level]));
+        while (curr != NULL)
+          {
+            uintptr_t succ = atomic_load(&curr->next[level]);
+
+            /* Unlink removed nodes */
+            while (skipListMarked(succ))
+              {
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->next[level],
+                                                    &expected,
+                                                    succ&
+                                                    ~SKIP_LIST_LOCK_FREE_MARK))
+                  {
+                    goto retry;
+                  }
+                curr = skipListLink(succ);
+                if (curr == NULL)
+                  {
+                    break;
+                  }
+                succ = atomic_load(&curr->next[level]);
+              }
+            if ((curr == NULL) ||
+                (skip->compare(curr->entry, entry, skip->user) !=
+                 compareLesser))
+              {
+                break;
+              }
+            pred = curr;
+            curr = skipListLink(succ);
+          }
+        preds[level] = pred;
+        succs[level] = curr;
+
+        /* Unlink removed nodes among the equal entries */
+        skipListNode_t *prev = pred;
+        skipListNode_t *node = curr;
+        while (sweep && (node != NULL))
+          {
+            uintptr_t next = atomic_load(&node->next[level]);
+            if (skipListMarked(next))
+              {
+                uintptr_t expected = (uintptr_t)node;
+                if (!atomic_compare_exchange_strong(&prev->next[level],
+                                                    &expected,
+                                                    next&
+                                                    ~SKIP_LIST_LOCK_FREE_MARK))
+                  {
+                    goto retry;
+                  }
+              }
+            else if (skip->compare(node->entry, entry, skip->user) ==
+                     compareEqual)
+              {
+                prev = node;
+              }
+            else
+              {
+                break;
+              }
+            node = skipListLink(next);
+          }
+      }
+
+    return (curr != NULL) &&
+      (skip->compare(curr->entry, entry, skip->user) == compareEqual);
+  }
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Mark a node from the top level down to level 0. The caller must occupy
+ * an epoch slot. If the node is removed by the caller then the node is
+ * unlinked and retired by whichever of the caller and the inserter of the
+ * node finishes last.
+ *
+ * \param skip pointer to skip list
+ * \param node pointer to the node
+ * \param preds array of nodes for skipListFindNodes()
+ * \param succs array of nodes for skipListFindNodes()
+ * \param reclaim set to \e true if it is time to reclaim retired nodes
+ * \return \e true if the node was removed by the caller
+ */
+static bool
+skipListRemoveNode(skipList_t * const skip,
+                   skipListNode_t * const node,
+                   skipListNode_t ** const preds,
+                   skipListNode_t ** const succs,
+                   bool * const reclaim)
+{
+  for (size_t level = node->height; level-- > 1; )
+    {
+      uintptr_t next = atomic_load(&node->next[level]);
+      while (!skipListMarked(next))
+        {
+          atomic_compare_exchange_weak(&node->next[level], &next,
+                                       next|SKIP_LIST_LOCK_FREE_MARK);
+        }
+    }
+
+  uintptr_t next = atomic_load(&node->next[0]);
+  for (;;)
+    {
+      if (skipListMarked(next))
+        {
+          return false;
+        }
+      if (atomic_compare_exchange_weak(&node->next[0], &next,
+                                       next|SKIP_LIST_LOCK_FREE_MARK))
+        {
+          break;
+        }
+    }
+  atomic_fetch_sub(&skip->size, 1);
+
+  if (atomic_exchange(&node->state, skipListNodeOrphaned) ==
+      skipListNodeLinked)
+    {
+      skipListFindNodes(skip, node->entry, node->height, true, preds, succs);
+      if (skipListRetire(skip, node))
+        {
+          *reclaim = true;
+        }
+    }
+
+  return true;
+}
+
+compare_e
+skipListCompLong(const void * const a,
+                 const void * const b,
+                 void * const user)
+{
+  const long x = *(const long *)a;
+  const long y = *(const long *)b;
+
+  (void)user;
+
+  return (x < y) ? compareLesser : ((y < x) ? compareGreater : compareEqual);
+}
+
+skipList_t *
+skipListCreate(const size_t space,
+               const skipListAllocFunc_t alloc,
+               const skipListDeallocFunc_t dealloc,
+               const skipListDuplicateEntryFunc_t duplicateEntry,
+               const skipListDeleteEntryFunc_t deleteEntry,
+               const skipListDebugFunc_t debug,
+               const skipListCompFunc_t comp,
+               void * const user)
+{
+  skipList_t *skip;
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (comp == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid comp() function!");
+      return NULL;
+    }
+
+  skip = alloc(sizeof(skipList_t), user);
+  if (skip == NULL)
+    {
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for skipList_t",
+            sizeof(skipList_t));
+      return NULL;
+    }
+
+  skip->maxHeight = space;
+  if (skip->maxHeight == 0)
+    {
+      skip->maxHeight = 1;
+    }
+  if (skip->maxHeight > SKIP_LIST_LOCK_FREE_MAX_HEIGHT)
+    {
+      skip->maxHeight = SKIP_LIST_LOCK_FREE_MAX_HEIGHT;
+    }
+
+  size_t headSize = sizeof(skipListNode_t)+
+                    (skip->maxHeight*sizeof(_Atomic(uintptr_t)));
+  skip->head = alloc(headSize, user);
+  if (skip->head == NULL)
+    {
+      dealloc(skip, user);
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for skipListNode_t", headSize);
+      return NULL;
+    }
+  skip->head->entry = NULL;
+  skip->head->height = skip->maxHeight;
+  atomic_init(&skip->head->state, skipListNodeLinked);
+  skip->head->retired = NULL;
+  skip->head->retireEpoch = 0;
+  atomic_init(&skip->head->refs, 0);
+  for (size_t level = 0; level < skip->maxHeight; level++)
+    {
+      atomic_init(&skip->head->next[level], 0);
+    }
+
+  atomic_init(&skip->height, 1);
+  atomic_init(&skip->size, 0);
+  atomic_init(&skip->epoch, 0);
+  for (size_t s = 0; s < SKIP_LIST_LOCK_FREE_SLOTS; s++)
+    {
+      atomic_init(&skip->slots[s].state, 0);
+      atomic_init(&skip->slots[s].rand, (uint64_t)s<<32);
+    }
+  atomic_init(&skip->retired, NULL);
+  atomic_init(&skip->retires, 0);
+
+  skip->compare = comp;
+  skip->alloc = alloc;
+  skip->dealloc = dealloc;
+  skip->deleteEntry = deleteEntry;
+  skip->duplicateEntry = duplicateEntry;
+  skip->debug = debug;
+  skip->user = user;
+
+  return skip;
+}
+
+void
+skipListSeed(skipList_t * const skip, const uint64_t seed)
+{
+  if (skip == NULL)
+    {
+      return;
+    }
+
+  for (size_t s = 0; s < SKIP_LIST_LOCK_FREE_SLOTS; s++)
+    {
+      atomic_store(&skip->slots[s].rand, seed+((uint64_t)s<<32));
+    }
+}
+
+void
+skipListSetFinger(skipList_t * const skip, const bool finger)
+{
+  (void)skip;
+  (void)finger;
+}
+
+void *
+skipListFind(skipList_t * const skip, void * const entry)
+{
+  if ((skip == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  /* Search without unlinking removed nodes */
+  size_t slot = skipListPin(skip);
+  skipListNode_t *pred = skip->head;
+  skipListNode_t *curr = NULL;
+  for (size_t level = atomic_load(&skip->height); level-- > 0; )
+    {
+      curr = skipListLink(atomic_load(&pred->next[level]));
+      while ((curr != NULL) &&
+             (skip->compare(curr->entry, entry, skip->user) == compareLesser))
+        {
+          pred = curr;
+          curr = skipListLink(atomic_load(&curr->next[level]));
+        }
+    }
+  while ((curr != NULL) && skipListRemoved(curr))
+    {
+      curr = skipListLink(atomic_load(&curr->next[0]));
+    }
+
+  void *found = NULL;
+  if ((curr != NULL) &&
+      (skip->compare(curr->entry, entry, skip->user) == compareEqual))
+    {
+      found = curr->entry;
+    }
+  skipListUnpin(skip, slot);
+
+  return found;
+}
+
+void *
+skipListInsert(skipList_t * const skip, void * const entry)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((skip == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(skip);
+  size_t height = skipListRandomHeight(skip, slot);
+
+  /* Raise the height of the skip list */
+  size_t top = atomic_load(&skip->height);
+  while ((top < height) &&
+         !atomic_compare_exchange_weak(&skip->height, &top, height))
+    {
+    }
+
+  /* Link the new node at level 0 before any equal entries */
+  skipListNode_t *node = NULL;
+  for (;;)
+    {
+      skipListFindNodes(skip, entry, height, false, preds, succs);
+
+      if (node == NULL)
+        {
+          size_t nodeSize = sizeof(skipListNode_t)+
+                            (height*sizeof(_Atomic(uintptr_t)));
+          node = skip->alloc(nodeSize, skip->user);
+          if (node == NULL)
+            {
+              skip->debug(__func__, __LINE__, skip->user,
+                          "Can't allocate %zu for skipListNode_t", nodeSize);
+              skipListUnpin(skip, slot);
+              return NULL;
+            }
+          node->entry = entry;
+          if (skip->duplicateEntry != NULL)
+            {
+              node->entry = skip->duplicateEntry(entry, skip->user);
+              if (node->entry == NULL)
+                {
+                  skip->debug(__func__, __LINE__, skip->user,
+                              "duplicateEntry() failed!");
+                  skip->dealloc(node, skip->user);
+                  skipListUnpin(skip, slot);
+                  return NULL;
+                }
+            }
+          node->height = height;
+          atomic_init(&node->state, skipListNodeInserting);
+          node->retired = NULL;
+          node->retireEpoch = 0;
+          atomic_init(&node->refs, 0);
+        }
+      for (size_t level = 0; level < height; level++)
+        {
+          atomic_init(&node->next[level], (uintptr_t)succs[level]);
+        }
+
+      uintptr_t expected = (uintptr_t)succs[0];
+      if (atomic_compare_exchange_strong(&preds[0]->next[0], &expected,
+                                         (uintptr_t)node))
+        {
+          break;
+        }
+    }
+  atomic_fetch_add(&skip->size, 1);
+
+  /* Link the upper levels unless the node is removed meanwhile */
+  for (size_t level = 1; level < height; level++)
+    {
+      for (;;)
+        {
+          uintptr_t next = atomic_load(&node->next[level]);
+          if (skipListMarked(next))
+            {
+              goto linked;
+            }
+          if ((skipListLink(next) != succs[level]) &&
+              !atomic_compare_exchange_strong(&node->next[level], &next,
+                                              (uintptr_t)succs[level]))
+            {
+              continue;
+            }
+
+          uintptr_t expected = (uintptr_t)succs[level];
+          if (atomic_compare_exchange_strong(&preds[level]->next[level],
+                                             &expected, (uintptr_t)node))
+            {
+              break;
+            }
+          if (skipListRemoved(node))
+            {
+              goto linked;
+            }
+          skipListFindNodes(skip, node->entry, height, false, preds, succs);
+        }
+    }
+
+ linked:
+  {
+    bool reclaim = false;
+    if (atomic_exchange(&node->state, skipListNodeLinked) ==
+        skipListNodeOrphaned)
+      {
+        skipListFindNodes(skip, node->entry, height, true, preds, succs);
+        reclaim = skipListRetire(skip, node);
+      }
+    skipListUnpin(skip, slot);
+    if (reclaim)
+      {
+        skipListReclaim(skip);
+      }
+  }
+
+  return entry;
+}
+
+void *
+skipListRemove(skipList_t * const skip, void * const entry)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((skip == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(skip);
+  void *found = NULL;
+  bool reclaim = false;
+  while (skipListFindNodes(skip, entry, 0, false, preds, succs))
+    {
+      skipListNode_t *node = succs[0];
+      if (skipListRemoveNode(skip, node, preds, succs, &reclaim))
+        {
+          /* The entry is deleted when the node is deallocated */
+          found = (skip->deleteEntry == NULL) ? node->entry : NULL;
+          break;
+        }
+    }
+  skipListUnpin(skip, slot);
+  if (reclaim)
+    {
+      skipListReclaim(skip);
+    }
+
+  return found;
+}
+
+size_t
+skipListRemoveRange(skipList_t * const skip,
+                    const void * const lo,
+                    const void * const hi)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((skip == NULL) || (lo == NULL) || (hi == NULL))
+    {
+      return 0;
+    }
+
+  size_t slot = skipListPin(skip);
+  size_t count = 0;
+  bool reclaim = false;
+  skipListFindNodes(skip, lo, 0, false, preds, succs);
+  skipListNode_t *node = succs[0];
+  while ((node != NULL) &&
+         (skip->compare(node->entry, hi, skip->user) == compareLesser))
+    {
+      skipListNode_t *next = skipListNextNode(node);
+      if (skipListRemoveNode(skip, node, preds, succs, &reclaim))
+        {
+          count = count+1;
+        }
+      node = next;
+    }
+  skipListUnpin(skip, slot);
+  if (reclaim)
+    {
+      skipListReclaim(skip);
+    }
+
+  return count;
+}
+
+void
+skipListClear(skipList_t * const skip)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if (skip == NULL)
+    {
+      return;
+    }
+
+  size_t slot = skipListPin(skip);
+  bool reclaim = false;
+  skipListNode_t *node = skipListNextNode(skip->head);
+  while (node != NULL)
+    {
+      skipListNode_t *next = skipListNextNode(node);
+      skipListRemoveNode(skip, node, preds, succs, &reclaim);
+      node = next;
+    }
+  skipListUnpin(skip, slot);
+  if (reclaim)
+    {
+      skipListReclaim(skip);
+    }
+}
+
+void
+skipListDestroy(skipList_t * const skip)
+{
+  if ((skip == NULL) || (skip->dealloc == NULL))
+    {
+      return;
+    }
+
+  /* Deallocate the nodes in the skip list */
+  skipListNode_t *node = skipListLink(atomic_load(&skip->head->next[0]));
+  while (node != NULL)
+    {
+      skipListNode_t *next = skipListLink(atomic_load(&node->next[0]));
+      if (!skipListRemoved(node))
+        {
+          skipListDeleteNode(skip, node);
+        }
+      node = next;
+    }
+
+  /* Deallocate the retired nodes */
+  node = atomic_load(&skip->retired);
+  while (node != NULL)
+    {
+      skipListNode_t *next = node->retired;
+      skipListDeleteNode(skip, node);
+      node = next;
+    }
+
+  skip->dealloc(skip->head, skip->user);
+  skip->dealloc(skip, skip->user);
+}
+
+size_t
+skipListGetSize(const skipList_t * const skip)
+{
+  if (skip == NULL)
+    {
+      return 0;
+    }
+
+  return atomic_load(&skip->size);
+}
+
+void *
+skipListGetMax(skipList_t * const skip)
+{
+  if (skip == NULL)
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(skip);
+  skipListNode_t *pred = skip->head;
+  for (size_t level = atomic_load(&skip->height); level-- > 0; )
+    {
+      skipListNode_t *curr = skipListLink(atomic_load(&pred->next[level]));
+      while (curr != NULL)
+        {
+          if (!skipListRemoved(curr))
+            {
+              pred = curr;
+            }
+          curr = skipListLink(atomic_load(&curr->next[level]));
+        }
+    }
+  void *entry = pred->entry;
+  skipListUnpin(skip, slot);
+
+  return entry;
+}
+
+void *
+skipListGetMin(skipList_t * const skip)
+{
+  if (skip == NULL)
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(skip);
+  skipListNode_t *node = skipListNextNode(skip->head);
+  void *entry = (node == NULL) ? NULL : node->entry;
+  skipListUnpin(skip, slot);
+
+  return entry;
+}
+
+void *
+skipListGetNext(skipList_t * const skip, const void * const entry)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((skip == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(skip);
+  void *next = NULL;
+  if (skipListFindNodes(skip, entry, 0, false, preds, succs))
+    {
+      skipListNode_t *node = skipListNextNode(succs[0]);
+      next = (node == NULL) ? NULL : node->entry;
+    }
+  else
+    {
+      skip->debug(__func__, __LINE__, skip->user, "entry not found!!");
+    }
+  skipListUnpin(skip, slot);
+
+  return next;
+}
+
+void *
+skipListGetPrevious(skipList_t * const skip, const void * const entry)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((skip == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(skip);
+  void *prev = NULL;
+  if (skipListFindNodes(skip, entry, 0, false, preds, succs))
+    {
+      prev = preds[0]->entry;
+    }
+  else
+    {
+      skip->debug(__func__, __LINE__, skip->user, "entry not found!!");
+    }
+  skipListUnpin(skip, slot);
+
+  return prev;
+}
+
+skipListCursor_t *
+skipListCursorCreate(skipList_t * const skip)
+{
+  skipListCursor_t *cursor;
+
+  if (skip == NULL)
+    {
+      return NULL;
+    }
+
+  cursor = (skip->alloc)(sizeof(skipListCursor_t), skip->user);
+  if (cursor == NULL)
+    {
+      skip->debug(__func__, __LINE__, skip->user,
+                  "Can't allocate %zu for skipListCursor_t",
+                  sizeof(skipListCursor_t));
+      return NULL;
+    }
+  cursor->list = skip;
+  cursor->node = NULL;
+
+  return cursor;
+}
+
+/**
+ * Private helper function for skip list implementation.
+ *
+ * Move a cursor to a node. The caller must occupy an epoch slot.
+ *
+ * \param cursor pointer to the cursor
+ * \param node pointer to the node. \e NULL if the cursor does not refer to
+ * a node.
+ * \return pointer to the entry at the node
+ */
+static void *
+skipListCursorMove(skipListCursor_t * const cursor, skipListNode_t * const node)
+{
+  if (node != NULL)
+    {
+      atomic_fetch_add(&node->refs, 1);
+    }
+  if (cursor->node != NULL)
+    {
+      atomic_fetch_sub(&cursor->node->refs, 1);
+    }
+  cursor->node = node;
+
+  return (node == NULL) ? NULL : node->entry;
+}
+
+void
+skipListCursorDestroy(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return;
+    }
+
+  if (cursor->node != NULL)
+    {
+      atomic_fetch_sub(&cursor->node->refs, 1);
+    }
+  (cursor->list->dealloc)(cursor, cursor->list->user);
+}
+
+void *
+skipListCursorSeek(skipListCursor_t * const cursor, const void * const entry)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((cursor == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(cursor->list);
+  skipListFindNodes(cursor->list, entry, 0, false, preds, succs);
+  void *found = skipListCursorMove(cursor, succs[0]);
+  skipListUnpin(cursor->list, slot);
+
+  return found;
+}
+
+void *
+skipListCursorFirst(skipListCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(cursor->list);
+  void *found = skipListCursorMove(cursor,
+                                   skipListNextNode(cursor->list->head));
+  skipListUnpin(cursor->list, slot);
+
+  return found;
+}
+
+void *
+skipListCursorLast(skipListCursor_t * const cursor)
+{
+  skipListNode_t *pred;
+
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  size_t slot = skipListPin(cursor->list);
+  pred = cursor->list->head;
+  for (size_t level = atomic_load(&cursor->list->height); level-- > 0; )
+    {
+      skipListNode_t *curr = skipListLink(atomic_load(&pred->next[level]));
+      while (curr != NULL)
+        {
+          if (!skipListRemoved(curr))
+            {
+              pred = curr;
+            }
+          curr = skipListLink(atomic_load(&curr->next[level]));
+        }
+    }
+  void *found = skipListCursorMove(cursor,
+                                   (pred == cursor->list->head) ? NULL : pred);
+  skipListUnpin(cursor->list, slot);
+
+  return found;
+}
+
+void *
+skipListCursorNext(skipListCursor_t * const cursor)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((cursor == NULL) || (cursor->node == NULL))
+    {
+      return NULL;
+    }
+
+  /* The links of a removed node may refer to reclaimed nodes so search
+     again for the first node not before its entry */
+  size_t slot = skipListPin(cursor->list);
+  skipListNode_t *next;
+  if (skipListRemoved(cursor->node))
+    {
+      skipListFindNodes(cursor->list, cursor->node->entry, 0, false,
+                        preds, succs);
+      next = succs[0];
+    }
+  else
+    {
+      next = skipListNextNode(cursor->node);
+    }
+  void *found = skipListCursorMove(cursor, next);
+  skipListUnpin(cursor->list, slot);
+
+  return found;
+}
+
+void *
+skipListCursorPrevious(skipListCursor_t * const cursor)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((cursor == NULL) || (cursor->node == NULL))
+    {
+      return NULL;
+    }
+
+  skipList_t *skip = cursor->list;
+  size_t slot = skipListPin(skip);
+  skipListFindNodes(skip, cursor->node->entry, 0, false, preds, succs);
+
+  /* Pass the equal entries before the cursor */
+  skipListNode_t *prev = preds[0];
+  for (skipListNode_t *node = skipListNextNode(prev);
+       (node != NULL) && (node != cursor->node) &&
+         !skipListRemoved(cursor->node) &&
+         (skip->compare(node->entry, cursor->node->entry, skip->user) ==
+          compareEqual);
+       node = skipListNextNode(node))
+    {
+      prev = node;
+    }
+  void *found = skipListCursorMove(cursor, (prev == skip->head) ? NULL : prev);
+  skipListUnpin(skip, slot);
+
+  return found;
+}
+
+void *
+skipListCursorEntry(const skipListCursor_t * const cursor)
+{
+  if ((cursor == NULL) || (cursor->node == NULL))
+    {
+      return NULL;
+    }
+
+  return cursor->node->entry;
+}
+
+bool
+skipListWalk(skipList_t * const skip, const skipListWalkFunc_t walk)
+{
+  if ((skip == NULL) || (walk == NULL))
+    {
+      return false;
+    }
+
+  size_t slot = skipListPin(skip);
+  for (skipListNode_t *node = skipListNextNode(skip->head);
+       node != NULL;
+       node = skipListNextNode(node))
+    {
+      if (walk(node->entry, skip->user) == false)
+        {
+          skipListUnpin(skip, slot);
+          return false;
+        }
+    }
+  skipListUnpin(skip, slot);
+
+  return true;
+}
+
+bool
+skipListWalkRange(skipList_t * const skip,
+                  const void * const lo,
+                  const void * const hi,
+                  const skipListWalkFunc_t walk)
+{
+  skipListNode_t *preds[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+  skipListNode_t *succs[SKIP_LIST_LOCK_FREE_MAX_HEIGHT];
+
+  if ((skip == NULL) || (lo == NULL) || (hi == NULL) || (walk == NULL))
+    {
+      return false;
+    }
+
+  size_t slot = skipListPin(skip);
+  skipListFindNodes(skip, lo, 0, false, preds, succs);
+  for (skipListNode_t *node = succs[0];
+       (node != NULL) &&
+         (skip->compare(node->entry, hi, skip->user) == compareLesser);
+       node = skipListNextNode(node))
+    {
+      if (walk(node->entry, skip->user) == false)
+        {
+          skipListUnpin(skip, slot);
+          return false;
+        }
+    }
+  skipListUnpin(skip, slot);
+
+  return true;
+}
+
+bool
+skipListCheck(skipList_t * const skip)
+{
+  if (skip == NULL)
+    {
+      return false;
+    }
+
+  /* Check the order of each level and the count of level 0 */
+  size_t height = atomic_load(&skip->height);
+  for (size_t level = 0; level < height; level++)
+    {
+      skipListNode_t *prev = NULL;
+      uintptr_t link = atomic_load(&skip->head->next[level]);
+      skipListNode_t *node = skipListLink(link);
+      size_t count = 0;
+      while (node != NULL)
+        {
+          uintptr_t next = atomic_load(&node->next[level]);
+          if (skipListMarked(next))
+            {
+              skip->debug(__func__, __LINE__, skip->user,
+                          "removed node at level %zu!", level);
+              return false;
+            }
+          if (node->height <= level)
+            {
+              skip->debug(__func__, __LINE__, skip->user,
+                          "node height failed at level %zu!", level);
+              return false;
+            }
+          if ((prev != NULL) &&
+              (skip->compare(node->entry, prev->entry, skip->user) ==
+               compareLesser))
+            {
+              skip->debug(__func__, __LINE__, skip->user,
+                          "skip->compare() failed at level %zu!", level);
+              return false;
+            }
+          prev = node;
+          node = skipListLink(next);
+          count = count+1;
+        }
+      if ((level == 0) && (count != atomic_load(&skip->size)))
+        {
+          skip->debug(__func__, __LINE__, skip->user, "size failed!");
+          return false;
+        }
+    }
+
+  return true;
+}
@@ -0,0 +1,194 @@
+/**
+ * \file skipListLockFree_private.h
+ *
+ * Private definition for a lock-free skip-list type.
+ */
+
+#if !defined(SKIP_LIST_LOCK_FREE_PRIVATE_H)
+#define SKIP_LIST_LOCK_FREE_PRIVATE_H
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "compare.h"
+#include "skipList.h"
+
+/**
+ * Maximum height of a node in a lock-free skip list.
+ */
+#define SKIP_LIST_LOCK_FREE_MAX_HEIGHT 64
+
+/**
+ * Number of epoch slots in a lock-free skip list. Each operation in
+ * progress occupies a slot. When every slot is occupied operations share
+ * slots.
+ */
+#define SKIP_LIST_LOCK_FREE_SLOTS 64
+
+/**
+ * Number of low bits of the state of an epoch slot that count the
+ * operations occupying the slot.
+ */
+#define SKIP_LIST_LOCK_FREE_SLOT_BITS 16
+
+/**
+ * Number of removed nodes between attempts to reclaim removed nodes.
+ */
+#define SKIP_LIST_LOCK_FREE_RECLAIM 64
+
+/**
+ * Size of the padding that keeps each epoch slot in its own cache line.
+ */
+#define SKIP_LIST_LOCK_FREE_CACHE_LINE 64
+
+/**
+ * \e skipListNodeState_e enumeration.
+ *
+ * The state of a node hands the retirement of the node from whichever of
+ * its inserter and its remover finishes last to the other.
+ */
+typedef enum skipListNodeState_e
+{
+  skipListNodeInserting = 0,
+  /**< The inserter is linking the upper levels of the node. */
+
+  skipListNodeLinked,
+  /**< The inserter has finished with the node. */
+
+  skipListNodeOrphaned
+  /**< The remover has marked the node while it was being inserted. */
+} skipListNodeState_e;
+
+/**
+ * \e skipListNode_t structure.
+ *
+ * A node of the lock-free skip list. The low bit of a link in \e next is
+ * set when the node has been removed from that level. A node is in the
+ * skip list while the link at level 0 is not marked.
+ */
+typedef struct skipListNode_t
+{
+  void *entry;
+  /**< Pointer to the caller's entry data. \e NULL for the header. */
+
+  size_t height;
+  /**< Number of levels of the node. */
+
+  atomic_int state;
+  /**< \e skipListNodeState_e of the node. */
+
+  struct skipListNode_t *retired;
+  /**< Next node in the list of removed nodes awaiting reclamation. */
+
+  size_t retireEpoch;
+  /**< Epoch at which the node was removed from every level. */
+
+  atomic_size_t refs;
+  /**< Number of cursors at the node. The node is not reclaimed while a
+     cursor is at it. */
+
+  _Atomic(uintptr_t) next[];
+  /**< Marked links to the next node at each level. */
+} skipListNode_t;
+
+/**
+ * \e skipListSlot_t structure.
+ *
+ * An epoch slot. An operation occupies a slot for its duration and
+ * announces the epoch at which it started. An operation that shares an
+ * occupied slot adopts the epoch already announced, which is no later
+ * than its own. A removed node is reclaimed once the epoch has advanced
+ * twice after its removal, by which time no operation can refer to it.
+ */
+typedef struct skipListSlot_t
+{
+  atomic_size_t state;
+  /**< Announced epoch shifted left by \e SKIP_LIST_LOCK_FREE_SLOT_BITS
+     above the number of operations occupying the slot, or 0 if the slot
+     is free. */
+
+  _Atomic(uint64_t) rand;
+  /**< State of the random level generator of the slot. */
+
+  char pad[SKIP_LIST_LOCK_FREE_CACHE_LINE-
+           sizeof(atomic_size_t)-sizeof(_Atomic(uint64_t))];
+  /**< Padding to the size of a cache line. */
+} skipListSlot_t;
+
+/**
+ * \e skipList_t structure.
+ *
+ * Private implementation of a lock-free \e skipList_t. Inserts and
+ * removals link and unlink nodes with compare-and-swap. Removed nodes are
+ * reclaimed with epoch based reclamation.
+ */
+struct skipList_t
+{
+  skipListAllocFunc_t alloc;
+  /**< Memory allocator callback function for skipList_t. */
+
+  skipListDeallocFunc_t dealloc;
+  /**< Memory deallocator callback function for skipList_t. */
+
+  skipListDuplicateEntryFunc_t duplicateEntry;
+  /**< Entry duplication callback function for the caller's entry data. */
+
+  skipListDeleteEntryFunc_t deleteEntry;
+  /**< Memory deallocator callback function for the caller's entry data. */
+
+  skipListDebugFunc_t debug;
+  /**< Debugging message callback function. */
+
+  skipListCompFunc_t compare;
+  /**< Callback function to compare two entries in the skip list.  */
+
+  skipListNode_t *head;
+  /**< Full height header node. */
+
+  size_t maxHeight;
+  /**< Maximum height of a node. */
+
+  atomic_size_t height;
+  /**< Height of the tallest node inserted. */
+
+  atomic_size_t size;
+  /**< Number of entries in the skip list. */
+
+  atomic_size_t epoch;
+  /**< Global epoch. */
+
+  skipListSlot_t slots[SKIP_LIST_LOCK_FREE_SLOTS];
+  /**< Epoch slots. */
+
+  _Atomic(skipListNode_t *) retired;
+  /**< List of removed nodes awaiting reclamation. */
+
+  atomic_size_t retires;
+  /**< Number of nodes removed. */
+
+  void *user;
+  /**< Placeholder for user data in callbacks. */
+};
+
+/**
+ * \e skipListCursor_t structure.
+ *
+ * Private implementation of \e skipListCursor_t for the lock-free skip
+ * list. The cursor occupies an epoch slot only during each call. Between
+ * calls it holds a reference to the node at the cursor so that the node
+ * is not reclaimed. If that node has been removed then the next move of
+ * the cursor searches again for its entry.
+ */
+struct skipListCursor_t
+{
+  skipList_t *list;
+  /**< The skip list traversed by the cursor. */
+
+  skipListNode_t *node;
+  /**< Node at the cursor. \e NULL if the cursor does not refer to a node. */
+};
+
+#endif
@@ -0,0 +1,208 @@
+/*
+ * skipListLockFree_test.c
+ *
+ * Threads insert, remove and find entries in a lock-free skip list at the
+ * same time. Each thread owns the keys equal to its index modulo the
+ * number of threads, so the final contents of the skip list are known: the
+ * even keys remain. Meanwhile a cursor is held open and more cursors
+ * exist than there are epoch slots.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "skipList.h"
+
+#define THREADS 4
+#define KEYS 20000
+#define CURSORS 100
+
+typedef struct thread_t
+{
+  skipList_t *list;
+  long index;
+  long errors;
+}
+thread_t;
+
+static long keys[KEYS];
+static long last = KEYS;
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)user;
+  va_start(args, format);
+  fprintf(stderr, "%s:%u ", function, line);
+  vfprintf(stderr, format, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+}
+
+static long walkNext;
+static bool walkOrdered;
+
+static
+bool
+Walk(void * const entry, void * const user)
+{
+  (void)user;
+  if (*(long *)entry != walkNext)
+    {
+      walkOrdered = false;
+    }
+  walkNext = walkNext+2;
+  return true;
+}
+
+static
+void *
+Run(void *arg)
+{
+  thread_t *thread = arg;
+  long k;
+
+  /* Insert the keys of this thread */
+  for (k=thread->index; k<KEYS; k+=THREADS)
+    {
+      if (skipListInsert(thread->list, &keys[k]) != &keys[k])
+        {
+          thread->errors++;
+        }
+    }
+
+  /* Remove the odd keys, find the even keys and look at other keys */
+  for (k=thread->index; k<KEYS; k+=THREADS)
+    {
+      long other = (k*7919)%KEYS;
+
+      if ((k%2) == 1)
+        {
+          if (skipListRemove(thread->list, &keys[k]) != &keys[k])
+            {
+              thread->errors++;
+            }
+          if (skipListFind(thread->list, &keys[k]) != NULL)
+            {
+              thread->errors++;
+            }
+        }
+      else if ((skipListFind(thread->list, &keys[k]) != &keys[k]) ||
+               (skipListGetNext(thread->list, &keys[k]) == NULL))
+        {
+          thread->errors++;
+        }
+      (void)skipListFind(thread->list, &keys[other]);
+    }
+
+  return NULL;
+}
+
+int main(void)
+{
+  skipList_t *list;
+  skipListCursor_t *cursors[CURSORS];
+  skipListCursor_t *cursor;
+  pthread_t threads[THREADS];
+  thread_t thread[THREADS];
+  long errors = 0;
+  long k;
+  size_t c;
+
+  for (k=0; k<KEYS; k++)
+    {
+      keys[k] = k;
+    }
+  list = skipListCreate(32, Alloc, Dealloc, NULL, NULL, Debug,
+                        skipListCompLong, NULL);
+  if (list == NULL)
+    {
+      fprintf(stderr, "skipListCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  /* More cursors than epoch slots must not stop other operations */
+  for (c=0; c<CURSORS; c++)
+    {
+      cursors[c] = skipListCursorCreate(list);
+    }
+  (void)skipListInsert(list, &keys[1]);
+  for (c=0; c<CURSORS; c++)
+    {
+      if (skipListCursorFirst(cursors[c]) != &keys[1])
+        {
+          errors++;
+        }
+    }
+  (void)skipListRemove(list, &keys[1]);
+  for (c=0; c<CURSORS; c++)
+    {
+      skipListCursorDestroy(cursors[c]);
+    }
+  printf("%d cursors: %s\n", CURSORS, (errors == 0) ? "ok" : "failed");
+
+  /* A cursor held open while the threads run */
+  cursor = skipListCursorCreate(list);
+  (void)skipListInsert(list, &last);
+  (void)skipListCursorFirst(cursor);
+
+  for (k=0; k<THREADS; k++)
+    {
+      thread[k] = (thread_t){ list, k, 0 };
+      if (pthread_create(&threads[k], NULL, Run, &thread[k]) != 0)
+        {
+          fprintf(stderr, "pthread_create() failed\n");
+          exit(EXIT_FAILURE);
+        }
+    }
+  for (k=0; k<THREADS; k++)
+    {
+      pthread_join(threads[k], NULL);
+      errors += thread[k].errors;
+    }
+
+  printf("errors: %ld\n", errors);
+  printf("cursor: %ld\n", *(long *)skipListCursorEntry(cursor));
+  printf("cursor previous: %ld\n", *(long *)skipListCursorPrevious(cursor));
+  (void)skipListCursorLast(cursor);
+  (void)skipListRemove(list, &last);
+  printf("cursor next after remove: %s\n",
+         (skipListCursorNext(cursor) == NULL) ? "none" : "some");
+  skipListCursorDestroy(cursor);
+  printf("size: %zu\n", skipListGetSize(list));
+  printf("check: %s\n", skipListCheck(list) ? "true" : "false");
+  walkNext = 0;
+  walkOrdered = true;
+  (void)skipListWalk(list, Walk);
+  printf("contents: %s\n",
+         (walkOrdered && (walkNext == KEYS)) ? "even keys" : "wrong");
+  printf("min: %ld\n", *(long *)skipListGetMin(list));
+  printf("max: %ld\n", *(long *)skipListGetMax(list));
+  skipListClear(list);
+  printf("size after clear: %zu\n", skipListGetSize(list));
+  skipListDestroy(list);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,212 @@
+/*
+ * skipListSeed_test.c
+ *
+ * Skip lists seeded with the same value draw the same sequence of node
+ * heights. The heights are not visible through the skip list interface
+ * but the number of comparisons made by each insert and find depends only
+ * on them, so the comparison counts of the same operations on two skip
+ * lists with the same seed must match and those of a skip list with
+ * another seed should not.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "skipList.h"
+
+#define KEYS 1000
+
+static long keys[KEYS];
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void *
+DuplicateEntry(void * const entry, void * const user)
+{
+  long *copy;
+
+  (void)user;
+  copy = malloc(sizeof(long));
+  if (copy != NULL)
+    {
+      *copy = *(long *)entry;
+    }
+  return copy;
+}
+
+static
+bool
+DeleteEntry(void * const entry, void * const user)
+{
+  (void)user;
+  free(entry);
+  return true;
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  printf("%s: ", function);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (*(size_t *)user)++;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+/*
+ * Insert the keys into an empty skip list and then find them, recording
+ * the number of comparisons made by each operation in counts[]
+ */
+static
+void
+Build(skipList_t * const list, size_t * const compares, size_t * const counts)
+{
+  long *found;
+  size_t k;
+
+  for (k=0; k<KEYS; k++)
+    {
+      *compares = 0;
+      if (skipListInsert(list, &keys[k]) == NULL)
+        {
+          printf("insert %ld failed\n", keys[k]);
+        }
+      counts[k] = *compares;
+    }
+  for (k=0; k<KEYS; k++)
+    {
+      *compares = 0;
+      found = skipListFind(list, &keys[k]);
+      if ((found == NULL) || (*found != keys[k]))
+        {
+          printf("find %ld failed\n", keys[k]);
+        }
+      counts[KEYS+k] = *compares;
+    }
+}
+
+static
+skipList_t *
+Create(size_t * const compares, const uint64_t seed)
+{
+  skipList_t *list;
+
+  list = skipListCreate(KEYS, Alloc, Dealloc, DuplicateEntry, DeleteEntry,
+                        Debug, Compare, compares);
+  if (list == NULL)
+    {
+      fprintf(stderr, "skipListCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  skipListSeed(list, seed);
+  return list;
+}
+
+static
+bool
+Same(const size_t * const a, const size_t * const b)
+{
+  size_t k;
+
+  for (k=0; k<(2*KEYS); k++)
+    {
+      if (a[k] != b[k])
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+int main(void)
+{
+  static size_t first[2*KEYS];
+  static size_t second[2*KEYS];
+  static size_t other[2*KEYS];
+  size_t firstCompares;
+  size_t secondCompares;
+  size_t otherCompares;
+  skipList_t *firstList;
+  skipList_t *secondList;
+  skipList_t *otherList;
+  size_t k;
+
+  /* Shuffled keys */
+  for (k=0; k<KEYS; k++)
+    {
+      keys[k] = (long)((k*7919)%KEYS);
+    }
+
+  firstList = Create(&firstCompares, 42);
+  secondList = Create(&secondCompares, 42);
+  otherList = Create(&otherCompares, 43);
+  Build(firstList, &firstCompares, first);
+  Build(secondList, &secondCompares, second);
+  Build(otherList, &otherCompares, other);
+  printf("same seed: %s\n", Same(first, second) ? "same" : "different");
+  printf("other seed: %s\n", Same(first, other) ? "same" : "different");
+
+  /* Seeding again restarts the sequence */
+  skipListClear(secondList);
+  skipListSeed(secondList, 42);
+  Build(secondList, &secondCompares, second);
+  printf("same seed after clear: %s\n",
+         Same(first, second) ? "same" : "different");
+
+  /* Without seeding again the sequence continues */
+  skipListClear(secondList);
+  Build(secondList, &secondCompares, second);
+  printf("no seed after clear: %s\n",
+         Same(first, second) ? "same" : "different");
+
+  printf("check: %s %s %s\n", skipListCheck(firstList) ? "true" : "false",
+         skipListCheck(secondList) ? "true" : "false",
+         skipListCheck(otherList) ? "true" : "false");
+  skipListDestroy(otherList);
+  skipListDestroy(secondList);
+  skipListDestroy(firstList);
+
+  return EXIT_SUCCESS;
+}
@@ -20,6 +20,7 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "jsw_slib.h"
 #include "skipList.h"
 
 /**
@@ -58,6 +59,21 @@ struct skipList_t
   /**< Placeholder for user data in callbacks. */
 };
 
+/**
+ * \e skipListCursor_t structure.
+ * 
+ * Private implementation of \e skipListCursor_t. Refers to a level 0 node
+ * of the \e jsw_skip_t skip list.
+ */
+struct skipListCursor_t 
+{
+  skipList_t *list;
+  /**< The skip list traversed by the cursor. */
+
+  jsw_node_t *node;
+  /**< Node at the cursor. \e NULL if the cursor does not refer to a node. */
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,9 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 
+#include "cacheCore.h"
 #include "splayCache.h"
 #include "splayCache_private.h"
 
@@ -169,7 +171,7 @@ splayCacheSplay(splayCache_t * const cache, void * const entry)
   node.left = node.right = NULL;
   left = right = &node;
   while ((comp = (cache->compare)(entry, 
-                                  (cache->root)->entry, 
+                                  (cache->root)->base.entry, 
                                   cache->user)) != compareEqual)
     {
       if (comp == compareLesser)
@@ -179,7 +181,7 @@ splayCacheSplay(splayCache_t * const cache, void * const entry)
               break;
             }
           if ((cache->compare)(entry, 
-                               ((cache->root)->left)->entry, 
+                               ((cache->root)->left)->base.entry, 
                                cache->user) == compareLesser)
             {
               splayCacheRotateRight(cache);
@@ -197,7 +199,7 @@ splayCacheSplay(splayCache_t * const cache, void * const entry)
               break;
             }
           if ((cache->compare)(entry, 
-                               ((cache->root)->right)->entry,
+                               ((cache->root)->right)->base.entry,
                                cache->user) == compareGreater)
             {
               splayCacheRotateLeft(cache);
@@ -218,57 +220,57 @@ splayCacheSplay(splayCache_t * const cache, void * const entry)
   return;
 }
 
+
 /**
  * Private helper function for splay tree cache implementation.
  *
- * Insert an entry into the cache splay tree. 
+ * Insert an entry into the cache splay tree as the root node.
  *
- * \param cache pointer to \c splayCache_t
- * \param node pointer to node to be installed as tree root node
- * \return pointer to \c splayTreeEntry_t root node. \c NULL indicates
- * failure.
+ * \param cacheEntry pointer to \c cacheCoreEntry_t of the node
+ * \param owner pointer to \c splayCache_t
+ * \return \c bool indicating success
  */
 static
-splayCacheEntry_t *
-splayCacheInsertEntry(splayCache_t * const cache, splayCacheEntry_t * const node)
+bool
+splayCacheLink(cacheCoreEntry_t * const cacheEntry, void * const owner)
 {
-  if ((cache == NULL) || (node == NULL))
-    {
-      return NULL;
-    }
+  splayCache_t * const cache = owner;
+  splayCacheEntry_t * const node = (splayCacheEntry_t *)cacheEntry;
 
   if(cache->root == NULL)
     {
       node->left = node->right = NULL;
     }
-  else 
+  else
     {
       compare_e comp;
 
-      splayCacheSplay(cache, node->entry);
-      comp = (cache->compare)(node->entry, (cache->root)->entry, cache->user);
-      if(comp == compareLesser) 
+      splayCacheSplay(cache, node->base.entry);
+      comp = (cache->compare)(node->base.entry,
+                              (cache->root)->base.entry,
+                              cache->user);
+      if(comp == compareLesser)
         {
           node->left = (cache->root)->left;
           node->right = cache->root;
           (cache->root)->left = NULL;
         }
-      else if (comp == compareGreater) 
+      else if (comp == compareGreater)
         {
           node->right = (cache->root)->right;
           node->left = cache->root;
           (cache->root)->right = NULL;
         }
-      else 
+      else
         {
           /* Shouldn't get here! */
-          return NULL;
+          return false;
         }
     }
 
   cache->root = node;
 
-  return node;
+  return true;
 }
 
 /**
@@ -277,31 +279,29 @@ splayCacheInsertEntry(splayCache_t * const cache, splayCacheEntry_t * const node
  * Remove an entry from the cache splay tree. Doesn't deallocate
  * associated memory.
  *
- * \param cache pointer to \c splayCache_t
- * \param entry \c void pointer to callers entry data
- * \return pointer to \c splayTreeEntry_t node removed from tree
+ * \param cacheEntry pointer to \c cacheCoreEntry_t of the node
+ * \param owner pointer to \c splayCache_t
  */
 static
-splayCacheEntry_t * 
-splayCacheRemoveEntry(splayCache_t * const cache, void * const entry) 
+void
+splayCacheUnlink(cacheCoreEntry_t * const cacheEntry, void * const owner)
 {
-  if ((cache == NULL) || (entry == NULL) || (cache->root == NULL))
+  splayCache_t * const cache = owner;
+  void * const entry = cacheEntry->entry;
+
+  if (cache->root == NULL)
     {
-      return NULL;
+      return;
     }
 
   splayCacheSplay(cache, entry);
-  if ((cache->compare)(entry, (cache->root)->entry, cache->user) 
-      == compareEqual) 
+  if (&((cache->root)->base) == cacheEntry)
     {
-      splayCacheEntry_t *node;
-
-      node = cache->root;
-      if ((cache->root)->left == NULL) 
+      if ((cache->root)->left == NULL)
         {
           cache->root = (cache->root)->right;
         }
-      else 
+      else
         {
           splayCacheEntry_t *tmp;
 
@@ -310,41 +310,79 @@ splayCacheRemoveEntry(splayCache_t * const cache, void * const entry)
           splayCacheSplay(cache, entry);
           (cache->root)->right = tmp;
         }
-
-      return node;
     }
-
-  return NULL;
 }
 
 /**
  * Private helper function for splay tree cache implementation.
  *
- * Find an entry in the cache splay tree. 
+ * Find an entry in the cache splay tree.
  *
- * \param cache pointer to \c splayCache_t
  * \param entry \c void pointer to callers entry data
- * \return pointer to \c splayTreeEntry_t node with corresponding entry
+ * \param owner pointer to \c splayCache_t
+ * \return pointer to \c cacheCoreEntry_t of the node with corresponding
+ * entry. \c NULL if not found.
  */
 static
-splayCacheEntry_t *
-splayCacheFindEntry(splayCache_t * const cache, void * const entry) 
-{ 
-  if ((cache == NULL) || (cache->root == NULL) || (entry == NULL))
+cacheCoreEntry_t *
+splayCacheLookup(void * const entry, void * const owner)
+{
+  splayCache_t * const cache = owner;
+
+  if (cache->root == NULL)
     {
       return NULL;
     }
 
   splayCacheSplay(cache, entry);
-  if ((cache->compare)(entry, (cache->root)->entry, cache->user) 
-      == compareEqual) 
+  if ((cache->compare)(entry, (cache->root)->base.entry, cache->user)
+      == compareEqual)
     {
-      return cache->root;
+      return &((cache->root)->base);
     }
 
   return NULL;
 }
 
+/**
+ * Private helper function for splay tree cache implementation.
+ *
+ * Check the order of the children of a node of the cache splay tree.
+ *
+ * \param cacheEntry pointer to \c cacheCoreEntry_t of the node
+ * \param owner pointer to \c splayCache_t
+ * \return \c bool indicating success
+ */
+static
+bool
+splayCacheCheckEntry(const cacheCoreEntry_t * const cacheEntry,
+                     void * const owner)
+{
+  splayCache_t * const cache = owner;
+  const splayCacheEntry_t * const node =
+    (const splayCacheEntry_t *)cacheEntry;
+
+  /* Check left child */
+  if ((node->left != NULL) &&
+      ((cache->compare)(node->left->base.entry,
+                        node->base.entry,
+                        cache->user) != compareLesser))
+    {
+      return false;
+    }
+
+  /* Check right child */
+  if ((node->right != NULL) &&
+      ((cache->compare)(node->base.entry,
+                        node->right->base.entry,
+                        cache->user) != compareLesser))
+    {
+      return false;
+    }
+
+  return true;
+}
+
 /**
  * Private helper function for splay tree cache implementation.
  *
@@ -382,75 +420,68 @@ splayCacheRecurseDepth(splayCacheEntry_t * const cacheEntry)
 /**
  * Private helper function for splay tree cache implementation.
  *
- * Move the cache entry (should be the last in the list) to the head 
- * of the linked list. 
+ * Allocate and initialise a cache and its \c cacheCore_t. Note that the
+ * cache passes itself to the \c cacheCore_t callbacks.
  *
- * \param cache pointer to \c splayCache_t
- * \param cacheEntry pointer to \c splayTreeEntry_t node to be moved
- * \return pointer to \c splayCache_t. \c NULL indicates failure
+ * \param space maximum number of entries in the cache
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for callers entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param hash entry key hash function callback. \c NULL for a splay tree.
+ * \param user \c void pointer to user data to be echoed by callbacks
+ * \return pointer to \c splayCache_t. \c NULL indicates failure.
  */
 static
 splayCache_t *
-splayCacheMoveToHead(splayCache_t * const cache, 
-                     splayCacheEntry_t * const cacheEntry)
+splayCacheInit(const size_t space,
+               const splayCacheAllocFunc_t alloc,
+               const splayCacheDeallocFunc_t dealloc,
+               const splayCacheDuplicateEntryFunc_t duplicateEntry,
+               const splayCacheDeleteEntryFunc_t deleteEntry,
+               const splayCacheDebugFunc_t debug,
+               const splayCacheCompFunc_t comp,
+               const splayCacheHashFunc_t hash,
+               void * const user)
 {
-  if ((cache == NULL) || 
-      (cacheEntry->next == NULL) || 
-      (cacheEntry->prev == NULL))
+  splayCache_t *cache = NULL;
+
+  /* Allocate space for splayCache_t */
+  cache = alloc(sizeof(splayCache_t), user);
+  if (cache == NULL)
     {
+      debug(__func__, __LINE__, user,
+            "Can't allocate %zu for splayCache_t",
+            sizeof(splayCache_t));
       return NULL;
     }
 
-  /* Unlink cacheEntry */
-  (cacheEntry->prev)->next = cacheEntry->next;
-  (cacheEntry->next)->prev = cacheEntry->prev;
-
-  /* Update cacheEntry */
-  cacheEntry->next = (cache->head).next;
-  cacheEntry->prev = &(cache->head);
-
-  /* Link cacheEntry */
-  (cacheEntry->next)->prev = (cache->head).next = cacheEntry;
-
-  return cache;
-}
-
-/**
- * Private helper function for splay tree cache implementation.
- *
- *  Duplicate an entry.
- *
- * \param cache pointer to splayCache_t
- * \param entry pointer to caller's data 
- * \return pointer to duplicated entry
- */
-static
-void *
-splayCacheDuplicateEntry(splayCache_t * const cache, void * const entry)
-{
-  void *new_entry;
-
-  if (cache->duplicateEntry != NULL)
-    {
-      new_entry = cache->duplicateEntry(entry, cache->user);
-      if (new_entry == NULL)
-        {
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "Couldn't duplicate entry!");
-          return NULL;
-        }   
-    }
-  else 
-    {
-      new_entry = entry;
+  /* Initialise cache */
+  cache->root = NULL;
+  cache->compare = comp;
+  cache->alloc = alloc;
+  cache->dealloc = dealloc;
+  cache->debug = debug;
+  cache->user = user;
+  cache->hash = hash;
+  cache->core = cacheCoreCreate(space, sizeof(splayCacheEntry_t), alloc,
+                                dealloc, duplicateEntry, deleteEntry, debug,
+                                comp, hash, splayCacheLink, splayCacheUnlink,
+                                splayCacheLookup, cache, user);
+  if (cache->core == NULL)
+    {
+      dealloc(cache, user);
+      return NULL;
     }
 
-  return new_entry;
+  return cache;
 }
 
 splayCache_t *
 splayCacheCreate(const size_t space,
-                 const splayCacheAllocFunc_t alloc, 
+                 const splayCacheAllocFunc_t alloc,
                  const splayCacheDeallocFunc_t dealloc,
                  const splayCacheDuplicateEntryFunc_t duplicateEntry,
                  const splayCacheDeleteEntryFunc_t deleteEntry,
@@ -458,8 +489,6 @@ splayCacheCreate(const size_t space,
                  const splayCacheCompFunc_t comp,
                  void * const user)
 {
-  splayCache_t *cache = NULL;
-
   if (debug == NULL)
     {
       return NULL;
@@ -469,12 +498,12 @@ splayCacheCreate(const size_t space,
       debug(__func__, __LINE__, user, "Requested cache space==0!");
       return NULL;
     }
-  if (alloc == NULL)  
+  if (alloc == NULL)
     {
       debug(__func__, __LINE__, user, "Invalid alloc() function!");
       return NULL;
     }
-  if (dealloc == NULL) 
+  if (dealloc == NULL)
     {
       debug(__func__, __LINE__, user, "Invalid dealloc() function!");
       return NULL;
@@ -485,220 +514,149 @@ splayCacheCreate(const size_t space,
       return NULL;
     }
 
-  /* Allocate space for splayCache_t */
-  cache = alloc(sizeof(splayCache_t), user);
-  if (cache == NULL)
-    {
-      debug(__func__, __LINE__, user, 
-            "Can't allocate %d for splayCache_t",
-            sizeof(splayCache_t));
-      return NULL;
-    }
-
-  /* Initialise cache */
-  cache->head.prev = NULL;
-  cache->head.next = &(cache->tail);
-  cache->head.left = NULL;
-  cache->head.right = NULL;
-  cache->head.entry = NULL;
-  cache->tail.prev = &(cache->head);
-  cache->tail.next = NULL;
-  cache->tail.left = NULL;
-  cache->tail.right = NULL;
-  cache->tail.entry = NULL;
-  cache->root = NULL;
-  cache->compare = comp;
-  cache->alloc = alloc;
-  cache->dealloc = dealloc;
-  cache->duplicateEntry = duplicateEntry;
-  cache->deleteEntry = deleteEntry;
-  cache->debug = debug;
-  cache->size = 0;
-  cache->user = user;
-  cache->space = space;
-
-  return cache;
+  return splayCacheInit(space, alloc, dealloc, duplicateEntry, deleteEntry,
+                        debug, comp, NULL, user);
 }
 
-void *
-splayCacheFind(splayCache_t * const cache, void * const entry)
+splayCache_t *
+splayCacheCreateHashed(const size_t space,
+                       const splayCacheAllocFunc_t alloc,
+                       const splayCacheDeallocFunc_t dealloc,
+                       const splayCacheDuplicateEntryFunc_t duplicateEntry,
+                       const splayCacheDeleteEntryFunc_t deleteEntry,
+                       const splayCacheDebugFunc_t debug,
+                       const splayCacheCompFunc_t comp,
+                       const splayCacheHashFunc_t hash,
+                       void * const user)
 {
-  splayCacheEntry_t *cacheEntry;
-
-  if ((cache == NULL) || (entry == NULL))
+  if (debug == NULL)
     {
       return NULL;
     }
-
-  /* First see if we find the entry in the cache */
-  if ((cacheEntry = splayCacheFindEntry(cache, entry)) == NULL)
+  if (hash == NULL)
     {
+      debug(__func__, __LINE__, user, "Invalid hash() function!");
       return NULL;
     }
-
-  /* Found! Move it to the head of the list */
-  if (splayCacheMoveToHead(cache, cacheEntry) == NULL)
+  if (space == 0)
     {
-      cache->debug(__func__, __LINE__, cache->user, 
-                   "splayCacheMoveToHead() failed");
+      debug(__func__, __LINE__, user, "Requested cache space==0!");
+      return NULL;
+    }
+  if (alloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid alloc() function!");
+      return NULL;
+    }
+  if (dealloc == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid dealloc() function!");
+      return NULL;
+    }
+  if (comp == NULL)
+    {
+      debug(__func__, __LINE__, user, "Invalid comp() function!");
       return NULL;
     }
 
-  return cacheEntry->entry;
+  return splayCacheInit(space, alloc, dealloc, duplicateEntry, deleteEntry,
+                        debug, comp, hash, user);
 }
 
-void *
-splayCacheInsert(splayCache_t * const cache, void * const entry)
+bool
+splayCacheSetPolicy(splayCache_t * const cache,
+                    const splayCachePolicy_e policy,
+                    const splayCacheKeyEntryFunc_t keyEntry)
 {
-  splayCacheEntry_t *cacheEntry;
-
-  if ((cache == NULL) || 
-      (cache->alloc == NULL) || 
-      (entry == NULL))
+  if (cache == NULL)
     {
       return false;
     }
-
-  /* First see if we can find the entry in the tree */
-  if ((cacheEntry = splayCacheFindEntry(cache, entry)) != NULL) 
-    { 
-      /* Move it to the head of the list */
-      if (splayCacheMoveToHead(cache, cacheEntry) == NULL)
-        {
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "splayCacheMoveToHead() failed");
-          return NULL;
-        }
-
-      /* Callback to delete old entry */
-      if (cache->deleteEntry != NULL)
-        {
-          (cache->deleteEntry)(cacheEntry->entry, cache->user);
-        }
-     
-      /* New key/value? */
-      cacheEntry->entry = splayCacheDuplicateEntry(cache, entry);
-      if (cacheEntry->entry == NULL)
-        {
-          (cache->debug)(__func__, __LINE__, cache->user,
-                        "splayCacheDuplicateEntry() failed!");
-          return NULL;
-        }
-
-      return cacheEntry->entry;
+  if ((unsigned int)policy > (unsigned int)splayCachePolicyARC)
+    {
+      cache->debug(__func__, __LINE__, cache->user,
+                   "Invalid policy %d!", (int)policy);
+      return false;
     }
 
-  /* Entry not found. Install in the cache */
-  if (cache->size < cache->space)
+  return cacheCoreSetPolicy(cache->core, (cacheCorePolicy_e)policy,
+                            keyEntry);
+}
+
+bool
+splayCacheSetBudget(splayCache_t * const cache,
+                    const size_t budget,
+                    const splayCacheCostFunc_t cost)
+{
+  if (cache == NULL)
     {
-      /* Allocate memory */
-      if ((cacheEntry = (cache->alloc)(sizeof(splayCacheEntry_t), 
-                                       cache->user)) == NULL)
-        {
-          return NULL;
-        }
-      cacheEntry->entry = splayCacheDuplicateEntry(cache, entry);
-      if (cacheEntry->entry == NULL)
-        {
-          (cache->dealloc)(cacheEntry, cache->user);
-          (cache->debug)(__func__, __LINE__, cache->user,
-                        "splayCacheDuplicateEntry() failed!");
-          return NULL;
-        }
+      return false;
+    }
 
-      /* Install in cache */
-      if (splayCacheInsertEntry(cache, cacheEntry) == NULL)
-        {
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "splayCacheInsert() failed");
-          return NULL;
-        }
+  return cacheCoreSetBudget(cache->core, budget, cost);
+}
 
-      /* Insert cacheEntry at head of list */
-      cacheEntry->next = (cache->head).next;
-      cacheEntry->prev = &(cache->head);
-      (cacheEntry->next)->prev = (cache->head).next = cacheEntry;
+bool
+splayCacheSetTTL(splayCache_t * const cache,
+                 const size_t ttl,
+                 const splayCacheClockFunc_t clock)
+{
+  if (cache == NULL)
+    {
+      return false;
+    }
 
-      /* Count the new entry */
-      cache->size = cache->size + 1;
+  return cacheCoreSetTTL(cache->core, ttl, clock);
+}
 
-      /* Done */
-      return cacheEntry->entry;
-    }
-  else
+void *
+splayCacheFind(splayCache_t * const cache, void * const entry)
+{
+  if (cache == NULL)
     {
-      void *lastEntry;
+      return NULL;
+    }
 
-      /* Reuse the last cache entry */
-      cacheEntry = (cache->tail).prev;
-      lastEntry = cacheEntry->entry;
-      if (splayCacheRemoveEntry(cache, lastEntry) != cacheEntry)
-        {
-          cache->debug(__func__, __LINE__, cache->user, 
-                       "splayCacheRemove() failed");
-          return NULL;
-        }
+  return cacheCoreFind(cache->core, entry);
+}
 
-      /* Callback to delete old entry */
-      if (cache->deleteEntry != NULL)
-        {
-          (cache->deleteEntry)(lastEntry, cache->user);
-        }
+void *
+splayCacheInsert(splayCache_t * const cache, void * const entry)
+{
+  if (cache == NULL)
+    {
+      return NULL;
+    }
 
-      /* Install the new entry */
-      cacheEntry->entry = splayCacheDuplicateEntry(cache, entry);
-      if (cacheEntry->entry == NULL)
-        {
-          (cache->debug)(__func__, __LINE__, cache->user,
-                        "splayCacheDuplicateEntry() failed!");
-          return NULL;
-        }
-      splayCacheInsertEntry(cache, cacheEntry);
-      
-      /* Move it to the start of the cache list */
-      if (splayCacheMoveToHead(cache, cacheEntry) == NULL)
-        {
-          cache->debug(__func__, __LINE__, cache->user,
-                       "splayCacheMoveToHead() failed");
-          return NULL;
-        }
+  return cacheCoreInsert(cache->core, entry);
+}
 
-      return cacheEntry->entry;
+void *
+splayCacheInsertWithTTL(splayCache_t * const cache,
+                        void * const entry,
+                        const size_t ttl)
+{
+  if (cache == NULL)
+    {
+      return NULL;
     }
+
+  return cacheCoreInsertWithTTL(cache->core, entry, ttl);
 }
 
-void 
+void
 splayCacheClear(splayCache_t * const cache)
 {
-  splayCacheEntry_t *cacheEntry, *nextCacheEntry;
-
   if (cache == NULL)
     {
       return;
     }
 
-  cacheEntry = cache->head.next;
-  while (cacheEntry != &(cache->tail))
-    {
-      nextCacheEntry = cacheEntry->next;
-      if (cache->deleteEntry != NULL)
-        {
-          (cache->deleteEntry)(cacheEntry->entry, cache->user);
-        }
-      if (cache->dealloc != NULL)
-        {
-          (cache->dealloc)(cacheEntry, cache->user);
-        }
-      cacheEntry = nextCacheEntry;
-    }
-
-  cache->head.next = &(cache->tail);
-  cache->tail.prev = &(cache->head);
+  cacheCoreClear(cache->core);
   cache->root = NULL;
-  cache->size = 0;
 }
 
-void 
+void
 splayCacheDestroy(splayCache_t * const cache)
 {
   if ((cache == NULL) || (cache->dealloc == NULL))
@@ -706,8 +664,7 @@ splayCacheDestroy(splayCache_t * const cache)
       return;
     }
 
-  splayCacheClear(cache);
-
+  cacheCoreDestroy(cache->core);
   (cache->dealloc)(cache, cache->user);
 
   return;
@@ -721,89 +678,93 @@ splayCacheGetSize(const splayCache_t * const cache)
       return 0;
     }
 
-  return cache->size;
+  return cacheCoreGetSize(cache->core);
 }
 
 size_t
-splayCacheGetDepth(const splayCache_t * const cache)
+splayCacheGetCost(const splayCache_t * const cache)
 {
-  if ((cache == NULL) || (cache->root == NULL))
+  if (cache == NULL)
     {
       return 0;
     }
 
-  return splayCacheRecurseDepth(cache->root);
+  return cacheCoreGetCost(cache->core);
 }
 
 bool
-splayCacheWalk(splayCache_t * const cache,  const splayCacheWalkFunc_t walk)
+splayCacheGetStats(const splayCache_t * const cache,
+                   splayCacheStats_t * const stats)
 {
-  splayCacheEntry_t *cacheEntry, *nextCacheEntry;
-
-  if ((cache == NULL) || (walk == NULL))
+  if ((cache == NULL) || (stats == NULL))
     {
       return false;
     }
+#if defined(SPLAY_CACHE_NO_STATS)
+  return false;
+#else
+  cacheCoreStats_t counts;
 
-  cacheEntry = cache->head.next;
-  while (cacheEntry != &(cache->tail))
+  if (cacheCoreGetStats(cache->core, &counts) == false)
     {
-      nextCacheEntry = cacheEntry->next;
-      if (walk(cacheEntry->entry, cache->user) == false)
-        {
-          return false;
-        }
-
-      cacheEntry = nextCacheEntry;
+      return false;
     }
-
+  stats->lookups = counts.lookups;
+  stats->hits = counts.hits;
+  stats->misses = counts.misses;
+  stats->insertions = counts.insertions;
+  stats->replacements = counts.replacements;
+  stats->evictions = counts.evictions;
+  stats->expirations = counts.expirations;
   return true;
+#endif
 }
 
-bool 
-splayCacheCheck(splayCache_t * const cache)
+size_t
+splayCacheGetDepth(const splayCache_t * const cache)
 {
-  splayCacheEntry_t *cacheEntry;
-
-  if ((cache == NULL) || (cache->compare == NULL))
+  if (cache == NULL)
     {
-      return false;
+      return 0;
     }
-
-  /* For each entry ... */
-  cacheEntry = cache->head.next;
-  while (cacheEntry != &(cache->tail))
+  if (cache->hash != NULL)
     {
-      splayCacheEntry_t *left, *right;
+      return cacheCoreGetDepth(cache->core);
+    }
 
-      /* Check left child */
-      left = cacheEntry->left;
-      if ((left != NULL) &&
-          ((cache->compare)(left->entry, cacheEntry->entry, cache->user) 
-           != compareLesser))
-        {
-          return false;
-        }
+  return splayCacheRecurseDepth(cache->root);
+}
 
-      /* Check right child */
-      right = cacheEntry->right;
-      if ((right != NULL) &&
-          ((cache->compare)(cacheEntry->entry, right->entry, cache->user) 
-           != compareLesser))
-        {
-          return false;
-        }
+bool
+splayCacheWalk(splayCache_t * const cache,  const splayCacheWalkFunc_t walk)
+{
+  if (cache == NULL)
+    {
+      return false;
+    }
+
+  return cacheCoreWalk(cache->core, walk);
+}
 
-      cacheEntry = cacheEntry->next;
+bool
+splayCacheCheck(splayCache_t * const cache)
+{
+  if ((cache == NULL) || (cache->compare == NULL))
+    {
+      return false;
     }
 
-  return true;
+  /* Check each entry in the hash index or in the splay tree */
+  return cacheCoreCheck(cache->core,
+                        (cache->hash != NULL) ? NULL : splayCacheCheckEntry);
 }
 
+
 bool
 splayCacheBalance(splayCache_t * const cache)
 {
   splayCacheEntry_t *node, **parentp;
+  size_t nodes;
 
   if ((cache == NULL) || (cache->root == NULL))
     {
@@ -849,13 +810,14 @@ splayCacheBalance(splayCache_t * const cache)
         }
     }
 
-  /* Now balance the cache */
-  if (cache->size <= 2)
+  /* Now balance the cache. The tree also holds the ghost entries. */
+  nodes = cacheCoreGetEntries(cache->core);
+  if (nodes <= 2)
     {
       return true;
     }
 
-  for (size_t depth=cache->size; depth>1; depth=depth/2)
+  for (size_t depth=nodes; depth>1; depth=depth/2)
     {
       splayCacheEntry_t *now, *next;
 
@@ -71,6 +71,21 @@ typedef void *(*splayCacheDuplicateEntryFunc_t)(void * const entry,
 typedef bool (*splayCacheDeleteEntryFunc_t)(void * const entry, 
                                             void * const user);
 
+/**
+ * \e splayCache_t entry key copy callback function.
+ *
+ * Splay cache key copy call-back for caller's entry data. The copy is
+ * kept by a ghost entry of the 2Q and ARC policies. It needs to hold only
+ * the key compared by the comparison callback and it is deallocated by
+ * the entry data memory de-allocator.
+ *
+ * \param entry pointer to caller's entry data
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to the copy. \e NULL indicates failure.
+ */
+typedef void *(*splayCacheKeyEntryFunc_t)(void * const entry,
+                                          void * const user);
+
 /**
  * Debugging message.
  *
@@ -115,6 +130,115 @@ typedef compare_e (*splayCacheCompFunc_t)( const void * const a,
  */
 typedef bool (*splayCacheWalkFunc_t)(void * const entry, void * const user);
 
+/**
+ * \e splayCache_t eviction policy.
+ *
+ * Selects the entry that is replaced when an entry is inserted in a full
+ * cache.
+ */
+typedef enum splayCachePolicy_e
+{
+  splayCachePolicyLRU=0,
+  /**< Replace the least recently used entry. A hit moves the entry to
+     the head of the list. This is the default. */
+
+  splayCachePolicyClock,
+  /**< CLOCK or second-chance replacement. A hit only sets a reference
+     bit on the entry. A clock hand sweeps the list from the tail,
+     clearing reference bits, and replaces the first unreferenced
+     entry in place. */
+
+  splayCachePolicyTwoQ,
+  /**< 2Q replacement. A new entry enters a FIFO queue holding about a
+     quarter of the cache. An entry evicted from the FIFO is remembered
+     as a ghost key. If it is inserted again while remembered it moves
+     to an LRU queue of frequently used entries. A scan of new entries
+     only flushes the FIFO queue. */
+
+  splayCachePolicyARC,
+  /**< Adaptive Replacement Cache. Entries used once and entries used
+     more than once are kept in separate LRU lists. Ghost lists of
+     recently evicted keys tune the target length of each list. */
+}
+  splayCachePolicy_e;
+
+/**
+ * Find the cost of an entry.
+ *
+ * Callback function to find the cost, typically the size in bytes, of an
+ * entry of a cache with a budget. The cost of an entry must not change
+ * while it is in the cache. The entry type is defined by the caller.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return cost of the entry
+ */
+typedef size_t (*splayCacheCostFunc_t)(const void * const entry,
+                                       void * const user);
+
+/**
+ * Read the time.
+ *
+ * Callback function to read the current time of a cache with expiring
+ * entries. The unit of time is chosen by the caller and is the unit of
+ * the time to live of an entry. The time must not go backwards.
+ *
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return current time
+ */
+typedef size_t (*splayCacheClockFunc_t)(void * const user);
+
+/**
+ * \e splayCache_t statistics.
+ *
+ * Counts of the cache operations since the cache was created. The counts
+ * are not reset by \e splayCacheClear(). The counters are kept by the
+ * cache core shared with the other cache types and are compiled out if
+ * \e cacheCore.c is compiled with \c CACHE_CORE_NO_STATS defined. If the
+ * cache is compiled with \c SPLAY_CACHE_NO_STATS defined then
+ * \e splayCacheGetStats() fails.
+ */
+typedef struct splayCacheStats_t
+{
+  size_t lookups;
+  /**< Number of calls to \e splayCacheFind(). */
+
+  size_t hits;
+  /**< Number of lookups that found the entry in the cache. */
+
+  size_t misses;
+  /**< Number of lookups that did not find the entry in the cache. */
+
+  size_t insertions;
+  /**< Number of calls to \e splayCacheInsert() for an entry not in the
+     cache. */
+
+  size_t replacements;
+  /**< Number of calls to \e splayCacheInsert() that replaced an entry
+     already in the cache. */
+
+  size_t evictions;
+  /**< Number of entries evicted to make room for an insertion. */
+
+  size_t expirations;
+  /**< Number of entries removed because their time to live expired. */
+}
+  splayCacheStats_t;
+
+/**
+ * Hash an entry.
+ *
+ * Callback function to hash the key of an entry for the hash index of a
+ * cache created by \e splayCacheCreateHashed(). Entries that compare
+ * equal must hash equal. The entry type is defined by the caller.
+ *
+ * \param entry pointer to an entry defined by the caller
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return hash of the entry key
+ */
+typedef size_t (*splayCacheHashFunc_t)(const void * const entry,
+                                       void * const user);
+
 /**
  * Create an empty cache.
  * 
@@ -140,6 +264,108 @@ splayCache_t *splayCacheCreate
  const splayCacheCompFunc_t comp, 
  void * const user);
 
+/**
+ * Create an empty hash-indexed cache.
+ *
+ * Creates and initialises an empty \e splayCache_t instance that finds
+ * entries with an open-addressing hash table rather than a splay tree.
+ * A hit costs one \e hash() call and, typically, one \e comp() call.
+ * The cache entries are still kept in a least-recently-used list so
+ * \e splayCacheWalk() is unchanged but \e splayCacheBalance() fails.
+ * \e splayCacheGetDepth() returns the length of the longest probe
+ * sequence in the hash table.
+ *
+ * \param space initial number of available splayCache elements
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for callers entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param hash entry key hash function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e splayCache_t. \e NULL indicates failure
+ */
+splayCache_t *splayCacheCreateHashed
+(const size_t space,
+ const splayCacheAllocFunc_t alloc, 
+ const splayCacheDeallocFunc_t dealloc,
+ const splayCacheDuplicateEntryFunc_t duplicateEntry,    
+ const splayCacheDeleteEntryFunc_t deleteEntry,
+ const splayCacheDebugFunc_t debug,
+ const splayCacheCompFunc_t comp, 
+ const splayCacheHashFunc_t hash,
+ void * const user);
+
+/**
+ * Set the eviction policy of the cache.
+ *
+ * Selects the policy used to choose the entry replaced when an entry is
+ * inserted in a full cache. The policy can only be changed while the
+ * cache is empty, typically immediately after it is created.
+ * The 2Q and ARC policies remember the keys of up to twice \e space
+ * recently evicted entries with ghost entries. \e deleteEntry() is called
+ * for an entry when it is evicted. A ghost entry of a cache created with
+ * a hash function keeps only the hash of the key. Otherwise it keeps a
+ * key-only copy of the entry made by \e keyEntry(), which is deleted with
+ * \e deleteEntry() when the ghost entry is forgotten.
+ *
+ * \param cache \e splayCache_t pointer
+ * \param policy \e splayCachePolicy_e value
+ * \param keyEntry key copy callback for caller's entry data. Required by
+ * the 2Q and ARC policies in a cache created without a hash function.
+ * Otherwise it may be \e NULL.
+ * \return \e bool indicating success
+ */
+bool splayCacheSetPolicy(splayCache_t * const cache,
+                         const splayCachePolicy_e policy,
+                         const splayCacheKeyEntryFunc_t keyEntry);
+
+/**
+ * Set the budget of the cache.
+ *
+ * Bounds the total cost of the entries in the cache as well as their
+ * number. Before an entry is inserted, entries chosen by the eviction
+ * policy are evicted until the cost of the new entry fits in the budget.
+ * An entry that costs more than the whole budget is not inserted. The
+ * budget can only be set while the cache is empty.
+ * The ghost entries of the 2Q and ARC policies hold no entry data so the
+ * budget bounds the cost of all the entry data held by the cache. A ghost
+ * entry holds only the hash of its key or, in a cache created without a
+ * hash function, a key-only copy made by the \e keyEntry() callback of
+ * \e splayCacheSetPolicy(). There are at most twice \e space ghost
+ * entries and they are not counted in the budget.
+ *
+ * \param cache \e splayCache_t pointer
+ * \param budget maximum total cost of the entries
+ * \param cost entry cost callback
+ * \return \e bool indicating success
+ */
+bool splayCacheSetBudget(splayCache_t * const cache, 
+                         const size_t budget,
+                         const splayCacheCostFunc_t cost);
+
+/**
+ * Set the time to live of the entries of the cache.
+ *
+ * Entries inserted by \e splayCacheInsert() expire \e ttl units of time
+ * after they were inserted or replaced. The entries are held in a
+ * hierarchical timer wheel that is advanced to the time read with \e clock
+ * by each call to \e splayCacheFind() and \e splayCacheInsert(). Expired
+ * entries are then removed from the cache and \e deleteEntry() is called
+ * for them. Until then an expired entry is counted in the size of the
+ * cache. The time to live can only be set while the cache is empty.
+ *
+ * \param cache \e splayCache_t pointer
+ * \param ttl default time to live of an entry. \e 0 if entries inserted
+ * by \e splayCacheInsert() do not expire.
+ * \param clock time callback
+ * \return \e bool indicating success
+ */
+bool splayCacheSetTTL(splayCache_t * const cache, 
+                      const size_t ttl,
+                      const splayCacheClockFunc_t clock);
+
 /**
  * Find an entry in the cache.
  *
@@ -171,6 +397,23 @@ void *splayCacheFind(splayCache_t * const cache,  void * const entry);
  */
 void *splayCacheInsert(splayCache_t * const cache, void * const entry);
 
+/**
+ * Insert an entry with a time to live in the cache.
+ *
+ * Inserts an entry in the cache like \e splayCacheInsert(). The
+ * entry expires \e ttl units of time after it is inserted. The time
+ * to live must first have been set with \e splayCacheSetTTL().
+ *
+ * \param cache \e splayCache_t pointer
+ * \param entry \e void pointer to caller's entry data
+ * \param ttl time to live of the entry. \e 0 if the entry does not expire.
+ * \return \e void pointer to the entry data installed in the cache. 
+ * \e NULL indicates failure.
+ */
+void *splayCacheInsertWithTTL(splayCache_t * const cache,
+                              void * const entry,
+                              const size_t ttl);
+
 /**
  * Clear the cache.
  *
@@ -214,11 +457,39 @@ size_t splayCacheGetDepth(const splayCache_t * const cache);
  */
 size_t splayCacheGetSize(const splayCache_t * const cache);
 
+/** 
+ * Get the total cost of the cache.
+ *
+ * Returns the total cost of the entries in the cache. If the cache
+ * has no budget then each entry costs one.
+ *
+ * \param cache pointer to \e splayCache_t
+ * \return total cost of the entries in the cache
+ */
+size_t splayCacheGetCost(const splayCache_t * const cache);
+
+/** 
+ * Get the statistics of the cache.
+ *
+ * Copies the operation counts of the cache to \e stats.
+ *
+ * \param cache pointer to \e splayCache_t
+ * \param stats pointer to \e splayCacheStats_t filled in with the counts
+ * \return \e bool indicating success. \e false if the counters are
+ * compiled out.
+ */
+bool splayCacheGetStats(const splayCache_t * const cache,
+                        splayCacheStats_t * const stats);
+
 /** 
  * Walk the cache in increasing age order.
  *
  * Walks the cache in increasing age order calling \e walk on each 
  * entry. 
+ * With the CLOCK policy a hit does not move an entry so the entries
+ * are walked in the order they were inserted or replaced.
+ * With the 2Q and ARC policies the entries used once are walked before
+ * the frequently used entries.
  *
  * \param cache pointer to \e splayCache_t
  * \param walk pointer to function called for each entry
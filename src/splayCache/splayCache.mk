@@ -4,8 +4,10 @@ PROGRAMS+=$(splayCache_PROGRAMS)
 
 VPATH += src/splayCache
 
-splayCache_interp_C_SOURCES := splayCache_wrapper.c splayCache.c
+splayCache_interp_C_SOURCES := \
+splayCache_wrapper.c splayCache.c cacheCore.c
 
 splayCache_interp_STATIC_LIBRARIES := interp.a
 
-$(call add_extra_CFLAGS_macro,$(splayCache_interp_C_SOURCES),-Isrc/interp)
+$(call add_extra_CFLAGS_macro,$(splayCache_interp_C_SOURCES),\
+-Isrc/interp -Isrc/cacheCore)
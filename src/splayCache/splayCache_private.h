@@ -20,24 +20,19 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "cacheCore.h"
 #include "splayCache.h"
 
 /**
  * \c splayCache_t internal entry type. 
  *
- * Internal representation of a splayCache_t entry.
+ * Internal representation of a splayCache_t entry. A \c cacheCoreEntry_t
+ * followed by the splay tree links.
  */
 typedef struct splayCacheEntry_t
 {
-  void *entry;
-  /**< Pointer to caller's entry data. 
-     This memory was allocated by the caller. */
-
-  struct splayCacheEntry_t *next;
-  /**< Pointer to the next entry */
-
-  struct splayCacheEntry_t *prev;
-  /**< Pointer to the previous entry */
+  cacheCoreEntry_t base;
+  /**< Cache entry. Must be first. */
 
   /* Splay tree stuff */
   struct splayCacheEntry_t *left;
@@ -51,12 +46,11 @@ typedef struct splayCacheEntry_t
 /**
  * \c splayCache_t structure.
  * 
- * Private implementation of \c splayCache_t. Uses a linked list
- * threading a splay tree in age order. New entries are allocated up
- * to \e maxSize after which the oldest entry is re-used as the newest
- * cache entry.
+ * Private implementation of \c splayCache_t. Uses a \c cacheCore_t for
+ * the entries and a splay tree to find them. If the cache has a hash
+ * index then the splay tree is not used.
  *
- * \see \c list_t \c splayTree_t
+ * \see \c cacheCore_t \c splayTree_t
  */
 struct splayCache_t
 {
@@ -66,42 +60,25 @@ struct splayCache_t
   splayCacheDeallocFunc_t dealloc;
   /**< Memory de-allocator callback function for \c splayCache_t. */
 
-  splayCacheDuplicateEntryFunc_t duplicateEntry;
-  /**< Entry duplication callback function for the caller's entry data. */
-
-  splayCacheDeleteEntryFunc_t deleteEntry;
-  /**< Memory deallocator callback function for the caller's entry data. */
-
   splayCacheDebugFunc_t debug;
   /**< Debugging message callback function. */
 
   splayCacheCompFunc_t compare;
   /**< Callback function to compare two entries in the splay tree.  */
 
-  splayCacheEntry_t head;
-  /**< First entry. This is a dummy list entry. It never stores a list
-     entry data entry pointer. It simplifies list manipulations. The
-     \e head.prev member is always \c NULL. The \e head.next member
-     points to the first real list entry. If the list is empty then \e
-     head.next points to \e tail.prev . */
-
-  splayCacheEntry_t tail;
-  /**< Last entry. Also a dummy list entry. The \e tail.next member
-     is always \c NULL. The \e tail.prev member points to the last
-     real list entry. If the list is empty then \e tail.prev
-     points to \e head.next . */
-
-  splayCacheEntry_t *root;
-  /**< Root entry in the cache splay tree. */
+  void *user;
+  /**< Placeholder for user data in callbacks. */
 
-  size_t size;
-  /**< Number of entries in the cache. */
+  splayCacheHashFunc_t hash;
+  /**< Callback function to hash an entry. \c NULL if there is no
+     hash index. */
 
-  size_t space;
-  /**< Maximum number of entries in the cache. */
+  cacheCore_t *core;
+  /**< Entries of the cache in the queues of its policy. */
 
-  void *user;
-  /**< Placeholder for user data in callbacks. */
+  splayCacheEntry_t *root;
+  /**< Root entry in the cache splay tree. \c NULL if the cache has a
+     hash index. */
 };
 
 #ifdef __cplusplus
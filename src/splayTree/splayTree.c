@@ -51,10 +51,83 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
+#include "arena.h"
+#include "stack.h"
 #include "splayTree.h" 
 #include "splayTree_private.h" 
 
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Offset of an entry stored in a splayTreeNode_t rounded up to the
+ * alignment of any type.
+ */
+static const size_t splayTreeEntryOffset =
+  ((sizeof(splayTreeNode_t)+_Alignof(max_align_t)-1)/_Alignof(max_align_t))
+  *_Alignof(max_align_t);
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Get a pointer to the entry stored in a node.
+ *
+ * \param node pointer to splayTreeNode_t
+ * \return \e void pointer to the entry stored in the node
+ */
+static
+void *
+splayTreeNodeEntry(splayTreeNode_t * const node)
+{
+  return (void *)(((unsigned char *)node)+splayTreeEntryOffset);
+}
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Allocate a node from the arena, if it exists, or with \e alloc().
+ *
+ * \param tree pointer to splayTree_t
+ * \return pointer to the new splayTreeNode_t. \e NULL indicates failure.
+ */
+static
+splayTreeNode_t *
+splayTreeAllocNode(splayTree_t * const tree)
+{
+  if (tree->arena != NULL)
+    {
+      return (splayTreeNode_t *)arenaAlloc(tree->arena);
+    }
+  else
+    {
+      return (splayTreeNode_t *)(tree->alloc)(tree->nodeSize, tree->user);
+    }
+}
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Return a node to the arena, if it exists, or to \e dealloc().
+ *
+ * \param tree pointer to splayTree_t
+ * \param node pointer to splayTreeNode_t
+ */
+static
+void
+splayTreeDeallocNode(splayTree_t * const tree, splayTreeNode_t * const node)
+{
+  if (tree->arena != NULL)
+    {
+      arenaFree(tree->arena, node);
+    }
+  else
+    {
+      (tree->dealloc)(node, tree->user);
+    }
+}
+
 /**
  * Private helper function for splayTree_t.
  *
@@ -251,6 +324,7 @@ splayTreeSplay(splayTree_t * const tree, const void * const entry)
     }
 
   splayTreeAssemble(tree, &node, left, right);
+  tree->version = tree->version+1;
   return;
 }
 
@@ -331,6 +405,104 @@ splayTreeRecurseDepth(splayTreeNode_t * const node)
     }
 }
 
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Visit the next node of a sub-tree counted by splayTreeCountSmaller().
+ *
+ * \param pending stack of the nodes still to be visited
+ * \param count pointer to the number of nodes visited
+ * \return \c bool indicating success
+ */
+static
+bool
+splayTreeCountStep(stack_t * const pending, size_t * const count)
+{
+  splayTreeNode_t *node;
+
+  if ((node = stackPop(pending)) == NULL)
+    {
+      return true;
+    }
+  *count = *count+1;
+  if ((node->left != NULL) && (stackPush(pending, node->left) == NULL))
+    {
+      return false;
+    }
+  if ((node->right != NULL) && (stackPush(pending, node->right) == NULL))
+    {
+      return false;
+    }
+  return true;
+}
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Count the nodes in two sub-trees with \e total nodes between them. The
+ * sub-trees are visited in step, one node from each, until one of them
+ * is exhausted, so only the smaller sub-tree is counted in full and the
+ * other count is found from \e total. Neither sub-tree is modified.
+ *
+ * \param tree pointer to \c splayTree_t
+ * \param first pointer to the root node of the first sub-tree
+ * \param second pointer to the root node of the second sub-tree
+ * \param total number of nodes in both sub-trees
+ * \param count pointer to the number of nodes in \e first
+ * \return \c bool indicating success
+ */
+static
+bool
+splayTreeCountSmaller(splayTree_t * const tree,
+                      splayTreeNode_t * const first,
+                      splayTreeNode_t * const second,
+                      const size_t total,
+                      size_t * const count)
+{
+  stack_t *firstPending, *secondPending;
+  size_t firstCount = 0, secondCount = 0;
+  bool ok;
+
+  firstPending = stackCreate(32, tree->alloc, tree->dealloc, NULL, NULL,
+                             tree->debug, tree->user);
+  secondPending = stackCreate(32, tree->alloc, tree->dealloc, NULL, NULL,
+                              tree->debug, tree->user);
+  ok = (firstPending != NULL) && (secondPending != NULL);
+  if (ok && (first != NULL))
+    {
+      ok = (stackPush(firstPending, first) != NULL);
+    }
+  if (ok && (second != NULL))
+    {
+      ok = (stackPush(secondPending, second) != NULL);
+    }
+
+  while (ok &&
+         (stackGetSize(firstPending) > 0) &&
+         (stackGetSize(secondPending) > 0))
+    {
+      ok = splayTreeCountStep(firstPending, &firstCount) &&
+           splayTreeCountStep(secondPending, &secondCount);
+    }
+
+  if (ok == false)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Can't allocate stack_t to count nodes!");
+    }
+  else if (stackGetSize(firstPending) == 0)
+    {
+      *count = firstCount;
+    }
+  else
+    {
+      *count = total-secondCount;
+    }
+  stackDestroy(secondPending);
+  stackDestroy(firstPending);
+  return ok;
+}
+
 /**
  * Private helper function for splayTree_t.
  *
@@ -413,36 +585,42 @@ splayTreeRecurseCheck(splayTree_t * const tree,
 /**
  * Private helper function for splayTree_t.
  *
- * Recursively clear nodes from the tree. Doesn't do tail recursion?
+ * Clear nodes from the tree without recursion. A node with a left child
+ * is rotated right so that the nodes are deleted in order from the
+ * left-most node.
  *
  * \param tree pointer to \c splayTree_t
  * \param node pointer to node of splay tree.
  */
 static
 void
-splayTreeRecurseClear(splayTree_t * const tree, splayTreeNode_t * const node)
+splayTreeClearNodes(splayTree_t * const tree, splayTreeNode_t *node)
 {
-  /* Destroy left child */
-  if (node->left != NULL)
+  while (node != NULL)
     {
-      splayTreeRecurseClear(tree, node->left);
-    }
+      splayTreeNode_t *next;
 
-  /* Destroy right child */
-  if (node->right != NULL)
-    {
-      splayTreeRecurseClear(tree, node->right);
-    }
+      if (node->left != NULL)
+        {
+          next = node->left;
+          node->left = next->right;
+          next->right = node;
+          node = next;
+          continue;
+        }
 
-  /* Delete entry */
-  if ((tree->deleteEntry != NULL) && (node->entry != NULL))
-    {
-      (tree->deleteEntry)(node->entry, tree->user);
-    }
+      /* Delete entry */
+      next = node->right;
+      if ((tree->deleteEntry != NULL) && (node->entry != NULL))
+        {
+          (tree->deleteEntry)(node->entry, tree->user);
+        }
 
-  /* Deallocate node */
-  (tree->dealloc)(node, tree->user);
-  tree->size = tree->size - 1;
+      /* Deallocate node */
+      splayTreeDeallocNode(tree, node);
+      tree->size = tree->size - 1;
+      node = next;
+    }
 
   return;
 }
@@ -453,16 +631,24 @@ splayTreeRecurseClear(splayTree_t * const tree, splayTreeNode_t * const node)
  *  Duplicate an entry.
  *
  * \param tree pointer to splayTree_t
+ * \param node pointer to the splayTreeNode_t for the entry
  * \param entry pointer to caller's data 
  * \return pointer to duplicated entry
  */
 static
 void *
-splayTreeDuplicateEntry(splayTree_t * const tree, void * const entry)
+splayTreeDuplicateEntry(splayTree_t * const tree,
+                        splayTreeNode_t * const node,
+                        void * const entry)
 {
   void *new_entry;
 
-  if (tree->duplicateEntry != NULL)
+  if (tree->entrySize != 0)
+    {
+      new_entry = splayTreeNodeEntry(node);
+      memcpy(new_entry, entry, tree->entrySize);
+    }
+  else if (tree->duplicateEntry != NULL)
     {
       new_entry = tree->duplicateEntry(entry, tree->user);
       if (new_entry == NULL)
@@ -480,6 +666,196 @@ splayTreeDuplicateEntry(splayTree_t * const tree, void * const entry)
   return new_entry;
 }
 
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Find the path from the root to the node at the cursor if the tree has
+ * been restructured since the path was found. The tree is not splayed.
+ *
+ * \param cursor pointer to \c splayTreeCursor_t
+ * \return \e true if the cursor refers to a node and the path is valid
+ */
+static
+bool
+splayTreeCursorFindPath(splayTreeCursor_t * const cursor)
+{
+  splayTree_t *tree = cursor->tree;
+  splayTreeNode_t *node;
+  compare_e comp;
+
+  if (cursor->node == NULL)
+    {
+      return false;
+    }
+  if (cursor->version == tree->version)
+    {
+      return true;
+    }
+
+  stackClear(cursor->path);
+  node = tree->root;
+  while ((node != NULL) && (node != cursor->node))
+    {
+      if (stackPush(cursor->path, node) == NULL)
+        {
+          (tree->debug)(__func__, __LINE__, tree->user, "stackPush() failed!");
+          break;
+        }
+      comp = (tree->compare)(cursor->node->entry, node->entry, tree->user);
+      if (comp == compareLesser)
+        {
+          node = node->left;
+        }
+      else if (comp == compareGreater)
+        {
+          node = node->right;
+        }
+      else
+        {
+          break;
+        }
+    }
+  if (node != cursor->node)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, "Cursor node not found!");
+      stackClear(cursor->path);
+      cursor->node = NULL;
+      return false;
+    }
+  cursor->version = tree->version;
+
+  return true;
+}
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Move the cursor from \e node down to the left-most or right-most node
+ * in the sub-tree at \e node. The tree is not splayed.
+ *
+ * \param cursor pointer to \c splayTreeCursor_t
+ * \param node pointer to the root of the sub-tree
+ * \param val if \c compareLesser left-most, if \c compareGreater right-most
+ * \return pointer to the entry at the cursor. \e NULL indicates failure.
+ */
+static
+void *
+splayTreeCursorDescend(splayTreeCursor_t * const cursor,
+                       splayTreeNode_t *node,
+                       const compare_e val)
+{
+  splayTreeNode_t *child;
+
+  while (node != NULL)
+    {
+      child = (val == compareLesser) ? node->left : node->right;
+      if (child == NULL)
+        {
+          break;
+        }
+      if (stackPush(cursor->path, node) == NULL)
+        {
+          (cursor->tree->debug)(__func__, __LINE__, cursor->tree->user,
+                                "stackPush() failed!");
+          node = NULL;
+          break;
+        }
+      node = child;
+    }
+  if (node == NULL)
+    {
+      stackClear(cursor->path);
+    }
+  cursor->node = node;
+  cursor->version = cursor->tree->version;
+
+  return (node == NULL) ? NULL : node->entry;
+}
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Move the cursor to the next or previous node. The tree is not splayed.
+ *
+ * \param cursor pointer to \c splayTreeCursor_t
+ * \param val if \c compareGreater next, if \c compareLesser previous
+ * \return pointer to the entry at the cursor. \e NULL if there is no
+ * next or previous node.
+ */
+static
+void *
+splayTreeCursorStep(splayTreeCursor_t * const cursor, const compare_e val)
+{
+  splayTreeNode_t *node, *child, *parent;
+
+  if (splayTreeCursorFindPath(cursor) == false)
+    {
+      return NULL;
+    }
+
+  /* Descend to the nearest node in the sub-tree on that side */
+  node = cursor->node;
+  child = (val == compareGreater) ? node->right : node->left;
+  if (child != NULL)
+    {
+      if (stackPush(cursor->path, node) == NULL)
+        {
+          (cursor->tree->debug)(__func__, __LINE__, cursor->tree->user,
+                                "stackPush() failed!");
+          return splayTreeCursorDescend(cursor, NULL, val);
+        }
+      return splayTreeCursorDescend(cursor, child,
+                                    (val == compareGreater) ?
+                                    compareLesser : compareGreater);
+    }
+
+  /* Otherwise ascend to the first ancestor on that side */
+  while ((parent = stackPop(cursor->path)) != NULL)
+    {
+      child = (val == compareGreater) ? parent->left : parent->right;
+      if (child == node)
+        {
+          break;
+        }
+      node = parent;
+    }
+  cursor->node = parent;
+
+  return (parent == NULL) ? NULL : parent->entry;
+}
+
+/**
+ * Private helper function for splayTree_t.
+ *
+ * Create an empty tree with the same callbacks and entry storage as an
+ * existing tree. The new tree does not have an arena.
+ *
+ * \param tree pointer to \c splayTree_t
+ * \return pointer to the new \c splayTree_t. \c NULL indicates failure.
+ */
+static
+splayTree_t *
+splayTreeCreateEmpty(const splayTree_t * const tree)
+{
+  splayTree_t *empty;
+
+  empty = (tree->alloc)(sizeof(splayTree_t), tree->user);
+  if (empty == NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, 
+                    "Can't allocate %zu for splayTree_t",
+                    sizeof(splayTree_t));
+      return NULL;
+    }
+  *empty = *tree;
+  empty->root = NULL;
+  empty->size = 0;
+  empty->version = 0;
+  empty->arena = NULL;
+
+  return empty;
+}
+
 splayTree_t *
 splayTreeCreate(const splayTreeAllocFunc_t alloc, 
                 const splayTreeDeallocFunc_t dealloc,
@@ -530,11 +906,90 @@ splayTreeCreate(const splayTreeAllocFunc_t alloc,
   tree->compare = comp;
   tree->root = NULL;
   tree->size = 0;
+  tree->version = 0;
+  tree->nodeSize = sizeof(splayTreeNode_t);
+  tree->entrySize = 0;
+  tree->arena = NULL;
   tree->user = user;
 
   return tree;
 }
 
+splayTree_t *
+splayTreeCreateWithArena(const size_t chunkNodes,
+                         const splayTreeAllocFunc_t alloc,
+                         const splayTreeDeallocFunc_t dealloc,
+                         const splayTreeDuplicateEntryFunc_t duplicateEntry,
+                         const splayTreeDeleteEntryFunc_t deleteEntry,
+                         const splayTreeDebugFunc_t debug,
+                         const splayTreeCompFunc_t comp,
+                         void * const user)
+{
+  splayTree_t *tree; 
+
+  tree = splayTreeCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                         debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  tree->arena = arenaCreate(tree->nodeSize, chunkNodes,
+                            alloc, dealloc, debug, user);
+  if (tree->arena == NULL)
+    {
+      debug(__func__, __LINE__, user, "Can't create arena!");
+      splayTreeDestroy(tree);
+      return NULL;
+    }
+
+  return tree;
+}
+
+splayTree_t *
+splayTreeCreateInline(const size_t entrySize,
+                      const size_t chunkNodes,
+                      const splayTreeAllocFunc_t alloc,
+                      const splayTreeDeallocFunc_t dealloc,
+                      const splayTreeDebugFunc_t debug,
+                      const splayTreeCompFunc_t comp,
+                      void * const user)
+{
+  splayTree_t *tree; 
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (entrySize == 0)
+    {
+      debug(__func__, __LINE__, user, "Request for entrySize==0!");
+      return NULL;
+    }
+
+  tree = splayTreeCreate(alloc, dealloc, NULL, NULL, debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  tree->entrySize = entrySize;
+  tree->nodeSize = splayTreeEntryOffset+entrySize;
+
+  if (chunkNodes != 0)
+    {
+      tree->arena = arenaCreate(tree->nodeSize, chunkNodes,
+                                alloc, dealloc, debug, user);
+      if (tree->arena == NULL)
+        {
+          debug(__func__, __LINE__, user, "Can't create arena!");
+          splayTreeDestroy(tree);
+          return NULL;
+        }
+    }
+
+  return tree;
+}
+
 void * 
 splayTreeFind(splayTree_t * const tree, void * const entry) 
 { 
@@ -567,7 +1022,7 @@ splayTreeInsert(splayTree_t * const tree, void * const entry)
 
   if(tree->root == NULL)
     {
-      if ((node = (tree->alloc)(sizeof(splayTreeNode_t), tree->user)) == NULL)
+      if ((node = splayTreeAllocNode(tree)) == NULL)
         {
           return NULL;
         }
@@ -591,8 +1046,7 @@ splayTreeInsert(splayTree_t * const tree, void * const entry)
            *                             /\
            *                         NULL  R
            */
-          if ((node = (tree->alloc)(sizeof(splayTreeNode_t), 
-                                    tree->user)) == NULL)
+          if ((node = splayTreeAllocNode(tree)) == NULL)
             {
               return NULL;
             }
@@ -609,8 +1063,7 @@ splayTreeInsert(splayTree_t * const tree, void * const entry)
            *                         /\
            *                        L  NULL
            */
-          if ((node = (tree->alloc)(sizeof(splayTreeNode_t),
-                                    tree->user)) == NULL)
+          if ((node = splayTreeAllocNode(tree)) == NULL)
             {
               return NULL;
             }
@@ -625,7 +1078,7 @@ splayTreeInsert(splayTree_t * const tree, void * const entry)
             {
               (tree->deleteEntry)((tree->root)->entry, tree->user);
             }
-          (tree->root)->entry = splayTreeDuplicateEntry(tree, entry);
+          (tree->root)->entry = splayTreeDuplicateEntry(tree, tree->root, entry);
           if ((tree->root)->entry == NULL)
             {
               (tree->debug)(__func__, __LINE__, tree->user,
@@ -638,10 +1091,11 @@ splayTreeInsert(splayTree_t * const tree, void * const entry)
 
   /* Housekeeping */
   tree->root = node;
-  (tree->root)->entry = splayTreeDuplicateEntry(tree, entry);
+  tree->version = tree->version+1;
+  (tree->root)->entry = splayTreeDuplicateEntry(tree, tree->root, entry);
   if ((tree->root)->entry == NULL)
     {
-      (tree->dealloc)(node, tree->user);
+      splayTreeDeallocNode(tree, node);
       (tree->debug)(__func__, __LINE__, tree->user,
                     "splayTreeDuplicateEntry() failed!");
       return NULL;
@@ -689,7 +1143,7 @@ splayTreeRemove(splayTree_t * const tree, void * const entry)
           (tree->deleteEntry)(node->entry, tree->user);
 
           /* Deallocate node */
-          (tree->dealloc)(node, tree->user);
+          splayTreeDeallocNode(tree, node);
           tree->size = tree->size-1;
 
           return NULL;
@@ -697,7 +1151,7 @@ splayTreeRemove(splayTree_t * const tree, void * const entry)
       else
         {
           /* Deallocate node */
-          (tree->dealloc)(node, tree->user);
+          splayTreeDeallocNode(tree, node);
           tree->size = tree->size-1;
       
           return entry;
@@ -707,6 +1161,155 @@ splayTreeRemove(splayTree_t * const tree, void * const entry)
   return NULL;
 }
 
+bool
+splayTreeSplit(splayTree_t * const tree,
+               const void * const entry,
+               splayTree_t ** const left,
+               splayTree_t ** const right)
+{
+  splayTreeNode_t *root;
+  size_t leftSize;
+
+  if ((tree == NULL) || (entry == NULL) || (left == NULL) || (right == NULL))
+    {
+      return false;
+    }
+  if (tree->arena != NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, 
+                    "Can't split a tree with an arena!");
+      return false;
+    }
+
+  *left = splayTreeCreateEmpty(tree);
+  *right = splayTreeCreateEmpty(tree);
+  if ((*left == NULL) || (*right == NULL))
+    {
+      if (*left != NULL)
+        {
+          (tree->dealloc)(*left, tree->user);
+        }
+      if (*right != NULL)
+        {
+          (tree->dealloc)(*right, tree->user);
+        }
+      *left = NULL;
+      *right = NULL;
+      return false;
+    }
+  if (tree->root == NULL)
+    {
+      return true;
+    }
+
+  /* 
+   * Splay the entry to the root. The root and one of its sub-trees
+   * become one tree and the other sub-tree becomes the other tree.
+   */
+  splayTreeSplay(tree, entry);
+  root = tree->root;
+
+  /* The nodes do not record sub-tree sizes */
+  if (splayTreeCountSmaller(tree, root->left, root->right, tree->size-1,
+                            &leftSize) == false)
+    {
+      (tree->dealloc)(*left, tree->user);
+      (tree->dealloc)(*right, tree->user);
+      *left = NULL;
+      *right = NULL;
+      return false;
+    }
+
+  if ((tree->compare)(root->entry, entry, tree->user) == compareLesser)
+    {
+      (*right)->root = root->right;
+      root->right = NULL;
+      (*left)->root = root;
+      leftSize = leftSize+1;
+    }
+  else
+    {
+      (*left)->root = root->left;
+      root->left = NULL;
+      (*right)->root = root;
+    }
+  (*left)->size = leftSize;
+  (*right)->size = tree->size-leftSize;
+
+  tree->root = NULL;
+  tree->size = 0;
+  tree->version = tree->version+1;
+
+  return true;
+}
+
+bool
+splayTreeJoin(splayTree_t * const left, splayTree_t * const right)
+{
+  splayTreeNode_t *max, *min;
+
+  if ((left == NULL) || (right == NULL) || (left == right))
+    {
+      return false;
+    }
+  if ((left->arena != NULL) || (right->arena != NULL))
+    {
+      (left->debug)(__func__, __LINE__, left->user, 
+                    "Can't join a tree with an arena!");
+      return false;
+    }
+  if ((left->entrySize != right->entrySize) || 
+      (left->duplicateEntry != right->duplicateEntry) ||
+      (left->deleteEntry != right->deleteEntry))
+    {
+      (left->debug)(__func__, __LINE__, left->user, 
+                    "Can't join trees with different entries!");
+      return false;
+    }
+  if ((left->compare != right->compare) ||
+      (left->alloc != right->alloc) ||
+      (left->dealloc != right->dealloc) ||
+      (left->user != right->user))
+    {
+      (left->debug)(__func__, __LINE__, left->user, 
+                    "Can't join trees with different callbacks!");
+      return false;
+    }
+  if (right->root == NULL)
+    {
+      return true;
+    }
+
+  if (left->root != NULL)
+    {
+      /* Check the order of the trees */
+      max = splayTreeFindMinMax(left, compareGreater);
+      min = splayTreeFindMinMax(right, compareLesser);
+      if ((left->compare)(max->entry, min->entry, left->user) != compareLesser)
+        {
+          (left->debug)(__func__, __LINE__, left->user, 
+                        "Entries in left tree not less than right tree!");
+          return false;
+        }
+
+      /* Splay the maximum to the root. It has no right sub-tree. */
+      splayTreeSplay(left, max->entry);
+      (left->root)->right = right->root;
+    }
+  else
+    {
+      left->root = right->root;
+    }
+  left->size = left->size+right->size;
+  left->version = left->version+1;
+
+  right->root = NULL;
+  right->size = 0;
+  right->version = right->version+1;
+
+  return true;
+}
+
 void 
 splayTreeClear(splayTree_t * const tree)
 {
@@ -717,9 +1320,10 @@ splayTreeClear(splayTree_t * const tree)
 
   if (tree->root != NULL)
     {
-      splayTreeRecurseClear(tree, tree->root);
+      splayTreeClearNodes(tree, tree->root);
     }
   tree->root = NULL;
+  tree->version = tree->version+1;
 
   return;
 }
@@ -733,6 +1337,7 @@ splayTreeDestroy(splayTree_t * const tree)
     }
 
   splayTreeClear(tree);
+  arenaDestroy(tree->arena);
   (tree->dealloc)(tree, tree->user);
 
   return;
@@ -857,6 +1462,172 @@ splayTreeGetMax(splayTree_t * const tree)
   return node->entry;
 }
 
+splayTreeCursor_t *
+splayTreeCursorCreate(splayTree_t * const tree)
+{
+  splayTreeCursor_t *cursor;
+
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  cursor = (tree->alloc)(sizeof(splayTreeCursor_t), tree->user);
+  if (cursor == NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Can't allocate %zu for splayTreeCursor_t",
+                    sizeof(splayTreeCursor_t));
+      return NULL;
+    }
+  cursor->path = stackCreate(32, tree->alloc, tree->dealloc, NULL, NULL,
+                             tree->debug, tree->user);
+  if (cursor->path == NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user,
+                    "Can't allocate stack_t for splayTreeCursor_t");
+      (tree->dealloc)(cursor, tree->user);
+      return NULL;
+    }
+  cursor->tree = tree;
+  cursor->node = NULL;
+  cursor->version = tree->version;
+
+  return cursor;
+}
+
+void
+splayTreeCursorDestroy(splayTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return;
+    }
+
+  stackDestroy(cursor->path);
+  (cursor->tree->dealloc)(cursor, cursor->tree->user);
+}
+
+void *
+splayTreeCursorSeek(splayTreeCursor_t * const cursor,
+                    const void * const entry)
+{
+  splayTree_t *tree;
+  splayTreeNode_t *node, *found;
+  size_t foundDepth;
+  compare_e comp;
+
+  if ((cursor == NULL) || (entry == NULL))
+    {
+      return NULL;
+    }
+
+  /* Descend without splaying, remembering the least node not less */
+  tree = cursor->tree;
+  stackClear(cursor->path);
+  found = NULL;
+  foundDepth = 0;
+  node = tree->root;
+  while (node != NULL)
+    {
+      comp = (tree->compare)(entry, node->entry, tree->user);
+      if ((comp == compareEqual) || (comp == compareLesser))
+        {
+          found = node;
+          foundDepth = stackGetSize(cursor->path);
+          if (comp == compareEqual)
+            {
+              break;
+            }
+        }
+      else if (comp != compareGreater)
+        {
+          (tree->debug)(__func__, __LINE__, tree->user,
+                        "Illegal compare result!");
+          found = NULL;
+          break;
+        }
+      if (stackPush(cursor->path, node) == NULL)
+        {
+          (tree->debug)(__func__, __LINE__, tree->user, "stackPush() failed!");
+          found = NULL;
+          break;
+        }
+      node = (comp == compareLesser) ? node->left : node->right;
+    }
+
+  /* Trim the path to the ancestors of the node found */
+  while (stackGetSize(cursor->path) > foundDepth)
+    {
+      stackPop(cursor->path);
+    }
+  if (found == NULL)
+    {
+      stackClear(cursor->path);
+    }
+  cursor->node = found;
+  cursor->version = tree->version;
+
+  return (found == NULL) ? NULL : found->entry;
+}
+
+void *
+splayTreeCursorFirst(splayTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  stackClear(cursor->path);
+  return splayTreeCursorDescend(cursor, cursor->tree->root, compareLesser);
+}
+
+void *
+splayTreeCursorLast(splayTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  stackClear(cursor->path);
+  return splayTreeCursorDescend(cursor, cursor->tree->root, compareGreater);
+}
+
+void *
+splayTreeCursorNext(splayTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  return splayTreeCursorStep(cursor, compareGreater);
+}
+
+void *
+splayTreeCursorPrevious(splayTreeCursor_t * const cursor)
+{
+  if (cursor == NULL)
+    {
+      return NULL;
+    }
+
+  return splayTreeCursorStep(cursor, compareLesser);
+}
+
+void *
+splayTreeCursorEntry(const splayTreeCursor_t * const cursor)
+{
+  if ((cursor == NULL) || (cursor->node == NULL))
+    {
+      return NULL;
+    }
+
+  return cursor->node->entry;
+}
+
 bool
 splayTreeWalk(splayTree_t * const tree, const splayTreeWalkFunc_t walk)
 {
@@ -890,6 +1661,7 @@ splayTreeBalance(splayTree_t * const tree)
     }
 
   /* First convert to a list */
+  tree->version = tree->version+1;
   node = tree->root;
   parentp = &(tree->root);
   while (node != NULL)
@@ -45,6 +45,11 @@ extern "C" {
  */
 typedef struct splayTree_t splayTree_t;
 
+/**
+ * \e splayTreeCursor_t structure. An opaque type for a position in a tree.
+ */
+typedef struct splayTreeCursor_t splayTreeCursor_t;
+
 /**
  * \e splayTree_t memory allocator.
  *
@@ -156,6 +161,64 @@ splayTree_t *splayTreeCreate(const splayTreeAllocFunc_t alloc,
                              const splayTreeCompFunc_t comp,
                              void * const user);
 
+/**
+ * Create an empty splay tree with an arena for the tree nodes.
+ * 
+ * Creates and initialises an empty \e splayTree_t instance. The tree
+ * nodes are allocated in chunks of \e chunkNodes nodes and nodes that
+ * are removed are recycled by later insertions. The chunks are
+ * deallocated when the tree is destroyed.
+ *
+ * \param chunkNodes number of tree nodes allocated in each chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for callers entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e splayTree_t. \e NULL indicates failure.
+ */
+splayTree_t *splayTreeCreateWithArena
+(const size_t chunkNodes,
+ const splayTreeAllocFunc_t alloc, 
+ const splayTreeDeallocFunc_t dealloc,
+ const splayTreeDuplicateEntryFunc_t duplicateEntry,
+ const splayTreeDeleteEntryFunc_t deleteEntry,
+ const splayTreeDebugFunc_t debug,
+ const splayTreeCompFunc_t comp,
+ void * const user);
+
+/**
+ * Create an empty splay tree storing entries in the tree nodes.
+ * 
+ * Creates and initialises an empty \e splayTree_t instance that copies
+ * each entry of \e entrySize bytes into the tree node rather than storing
+ * a pointer to the caller's entry data. The entry pointers returned by the
+ * tree refer to the copy in the node and are valid until that entry is
+ * removed. A removed entry is not returned to the caller. There are no
+ * \e duplicateEntry and \e deleteEntry callbacks. If \e chunkNodes is
+ * not zero then the tree nodes are allocated from an arena with
+ * \e chunkNodes nodes in each chunk.
+ *
+ * \param entrySize size in bytes of each entry
+ * \param chunkNodes number of tree nodes allocated in each arena chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e splayTree_t. \e NULL indicates failure
+ */
+splayTree_t *splayTreeCreateInline
+(const size_t entrySize,
+ const size_t chunkNodes,
+ const splayTreeAllocFunc_t alloc, 
+ const splayTreeDeallocFunc_t dealloc,
+ const splayTreeDebugFunc_t debug,
+ const splayTreeCompFunc_t comp,
+ void * const user);
+
 /**
  * Find an entry in the tree.
  *
@@ -204,6 +267,45 @@ void *splayTreeInsert(splayTree_t * const tree, void * const entry);
  */
 void *splayTreeRemove(splayTree_t * const tree, void * const entry);
 
+/**
+ * Split the splay tree at an entry.
+ *
+ * Moves the entries less than \e entry to a new tree, \e left, and the 
+ * entries not less than \e entry to a new tree, \e right. The new trees
+ * have the same callbacks as \e tree and \e tree is left empty. The
+ * entry is splayed to the root and the tree is divided at the root in
+ * amortised O(lg N). The nodes do not record the size of their sub-trees
+ * so the two sub-trees of the root are then counted in step until the
+ * smaller is exhausted, in O(min(L, R)) for L and R entries in \e left and
+ * \e right. A tree with an arena can not be split.
+ *
+ * \param tree pointer to \e splayTree_t
+ * \param entry \e void pointer to caller's entry data
+ * \param left pointer to the new \e splayTree_t of lesser entries
+ * \param right pointer to the new \e splayTree_t of other entries
+ * \return \e true if the tree was split. \e false indicates failure.
+ */
+bool splayTreeSplit(splayTree_t * const tree,
+                    const void * const entry,
+                    splayTree_t ** const left,
+                    splayTree_t ** const right);
+
+/**
+ * Join two splay trees.
+ *
+ * Moves all the entries of \e right to \e left. All the entries in 
+ * \e left must be less than all the entries in \e right. The maximum 
+ * entry of \e left is splayed to the root and \e right becomes its right
+ * sub-tree in amortised O(lg N). On return \e right is empty. Trees with
+ * an arena, or with different entry sizes, callbacks or user data, can not
+ * be joined.
+ *
+ * \param left pointer to \e splayTree_t of lesser entries
+ * \param right pointer to \e splayTree_t of greater entries
+ * \return \e true if the trees were joined. \e false indicates failure.
+ */
+bool splayTreeJoin(splayTree_t * const left, splayTree_t * const right);
+
 /**
  * Clear the splay tree.
  *
@@ -296,6 +398,88 @@ void *splayTreeGetNext(splayTree_t * const tree, const void * const entry);
  */
 void *splayTreeGetPrevious(splayTree_t * const tree, const void * const entry);
 
+/**
+ * Create a cursor for the splay tree.
+ *
+ * A cursor refers to an entry in the tree and keeps the path from the
+ * root to that entry so that it is moved to the next or previous entry
+ * without searching the tree. Moving a cursor does not splay the tree. If
+ * the tree has been splayed since the cursor last moved then the cursor
+ * searches for its entry again before moving. Any number of cursors may
+ * traverse the same tree. A cursor referring to an entry is invalidated
+ * when that entry is removed. A new cursor does not refer to an entry.
+ *
+ * \param tree pointer to \e splayTree_t
+ * \return pointer to a \e splayTreeCursor_t. \e NULL indicates failure.
+ */
+splayTreeCursor_t *splayTreeCursorCreate(splayTree_t * const tree);
+
+/**
+ * Destroy a splay tree cursor.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ */
+void splayTreeCursorDestroy(splayTreeCursor_t * const cursor);
+
+/**
+ * Move a splay tree cursor to an entry.
+ *
+ * Moves the cursor to the least entry in the tree that is not less
+ * than \e entry.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ * \param entry \e void pointer to caller's entry data
+ * \return \e void pointer to the entry at the cursor. \e NULL if all the
+ * entries in the tree are less than \e entry.
+ */
+void *splayTreeCursorSeek(splayTreeCursor_t * const cursor, 
+                     const void * const entry);
+
+/**
+ * Move a splay tree cursor to the minimum entry.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * tree is empty.
+ */
+void *splayTreeCursorFirst(splayTreeCursor_t * const cursor);
+
+/**
+ * Move a splay tree cursor to the maximum entry.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * tree is empty.
+ */
+void *splayTreeCursorLast(splayTreeCursor_t * const cursor);
+
+/**
+ * Move a splay tree cursor to the next entry.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor was at the maximum entry or did not refer to an entry.
+ */
+void *splayTreeCursorNext(splayTreeCursor_t * const cursor);
+
+/**
+ * Move a splay tree cursor to the previous entry.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor was at the minimum entry or did not refer to an entry.
+ */
+void *splayTreeCursorPrevious(splayTreeCursor_t * const cursor);
+
+/**
+ * Get the entry at a splay tree cursor.
+ *
+ * \param cursor pointer to \e splayTreeCursor_t
+ * \return \e void pointer to the entry at the cursor. \e NULL if the
+ * cursor does not refer to an entry.
+ */
+void *splayTreeCursorEntry(const splayTreeCursor_t * const cursor);
+
 /** 
  * Recrsively walk the tree from the root operating on each tree entry.
  *
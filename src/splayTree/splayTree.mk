@@ -1,11 +1,23 @@
 # Programs in this directory
-splayTree_PROGRAMS:=splayTree_interp
+splayTree_PROGRAMS:=splayTree_interp splayTreeSplit_test splayTreeCursor_test
 PROGRAMS+=$(splayTree_PROGRAMS)
 
 VPATH += src/splayTree
 
-splayTree_interp_C_SOURCES := splayTree_wrapper.c splayTree.c
+splayTree_interp_C_SOURCES := splayTree_wrapper.c splayTree.c stack.c arena.c
 
 splayTree_interp_STATIC_LIBRARIES := interp.a
 
-$(call add_extra_CFLAGS_macro,$(splayTree_interp_C_SOURCES),-Isrc/interp)
+$(call add_extra_CFLAGS_macro,$(splayTree_interp_C_SOURCES),\
+-Isrc/stack -Isrc/arena -Isrc/interp)
+
+splayTreeSplit_test_C_SOURCES := splayTreeSplit_test.c splayTree.c stack.c arena.c
+
+$(call add_extra_CFLAGS_macro,$(splayTreeSplit_test_C_SOURCES),\
+-Isrc/stack -Isrc/arena -Isrc/interp)
+
+splayTreeCursor_test_C_SOURCES := \
+splayTreeCursor_test.c splayTree.c stack.c arena.c
+
+$(call add_extra_CFLAGS_macro,$(splayTreeCursor_test_C_SOURCES),\
+-Isrc/stack -Isrc/arena -Isrc/interp)
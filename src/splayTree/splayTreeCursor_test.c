@@ -0,0 +1,213 @@
+/*
+ * splayTreeCursor_test.c
+ *
+ * Step splay tree cursors forwards and backwards, then insert and
+ * remove entries on either side of a cursor and step again. Insertions,
+ * removals and searches splay the tree, so the cursor must find its
+ * path again before it moves.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "splayTree.h"
+
+static long keys[] = { 10, 20, 30, 40, 45, 50, 55, 60, 70, 80, 90, 100 };
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+long *
+Key(const long key)
+{
+  size_t k;
+
+  for (k=0; k<(sizeof(keys)/sizeof(keys[0])); k++)
+    {
+      if (keys[k] == key)
+        {
+          return &keys[k];
+        }
+    }
+  fprintf(stderr, "No key %ld\n", key);
+  exit(EXIT_FAILURE);
+}
+
+static
+void
+Show(const char *what, const void * const entry)
+{
+  if (entry == NULL)
+    {
+      printf("%s: NULL\n", what);
+    }
+  else
+    {
+      printf("%s: %ld\n", what, *(const long *)entry);
+    }
+}
+
+int main(void)
+{
+  splayTree_t *tree;
+  splayTreeCursor_t *cursor;
+  splayTreeCursor_t *other;
+  void *entry;
+
+  tree = splayTreeCreate(Alloc, Dealloc, NULL, NULL, Debug, Compare, NULL);
+  if (tree == NULL)
+    {
+      fprintf(stderr, "splayTreeCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  cursor = splayTreeCursorCreate(tree);
+  other = splayTreeCursorCreate(tree);
+  if ((cursor == NULL) || (other == NULL))
+    {
+      fprintf(stderr, "splayTreeCursorCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+
+  /* Empty tree */
+  Show("new", splayTreeCursorEntry(cursor));
+  Show("next", splayTreeCursorNext(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("first", splayTreeCursorFirst(cursor));
+  Show("last", splayTreeCursorLast(cursor));
+  Show("seek 10", splayTreeCursorSeek(cursor, Key(10)));
+
+  (void)splayTreeInsert(tree, Key(10));
+  (void)splayTreeInsert(tree, Key(20));
+  (void)splayTreeInsert(tree, Key(30));
+  (void)splayTreeInsert(tree, Key(40));
+  (void)splayTreeInsert(tree, Key(50));
+  (void)splayTreeInsert(tree, Key(60));
+  (void)splayTreeInsert(tree, Key(70));
+  (void)splayTreeInsert(tree, Key(80));
+  (void)splayTreeInsert(tree, Key(90));
+  (void)splayTreeInsert(tree, Key(100));
+
+  /* Forwards and backwards */
+  printf("forwards:");
+  for (entry = splayTreeCursorFirst(cursor);
+       entry != NULL;
+       entry = splayTreeCursorNext(cursor))
+    {
+      printf(" %ld", *(long *)entry);
+    }
+  printf("\n");
+  Show("next after last", splayTreeCursorNext(cursor));
+  printf("backwards:");
+  for (entry = splayTreeCursorLast(cursor);
+       entry != NULL;
+       entry = splayTreeCursorPrevious(cursor))
+    {
+      printf(" %ld", *(long *)entry);
+    }
+  printf("\n");
+  Show("previous before first", splayTreeCursorPrevious(cursor));
+
+  /* Two cursors in opposite directions while the tree is splayed */
+  (void)splayTreeCursorFirst(cursor);
+  (void)splayTreeCursorLast(other);
+  printf("meet:");
+  while (Compare(splayTreeCursorEntry(cursor),
+                 splayTreeCursorEntry(other), NULL) == compareLesser)
+    {
+      printf(" %ld/%ld", *(long *)splayTreeCursorEntry(cursor),
+             *(long *)splayTreeCursorEntry(other));
+      (void)splayTreeFind(tree, Key(60));
+      (void)splayTreeCursorNext(cursor);
+      (void)splayTreeFind(tree, Key(20));
+      (void)splayTreeCursorPrevious(other);
+    }
+  printf("\n");
+
+  /* Insert around the cursor */
+  Show("seek 45", splayTreeCursorSeek(cursor, Key(45)));
+  (void)splayTreeInsert(tree, Key(45));
+  (void)splayTreeInsert(tree, Key(55));
+  Show("entry", splayTreeCursorEntry(cursor));
+  Show("next", splayTreeCursorNext(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+
+  /* Remove around the cursor */
+  Show("next", splayTreeCursorNext(cursor));
+  Show("remove 40", splayTreeRemove(tree, Key(40)));
+  Show("remove 55", splayTreeRemove(tree, Key(55)));
+  Show("remove 10", splayTreeRemove(tree, Key(10)));
+  Show("remove 100", splayTreeRemove(tree, Key(100)));
+  Show("entry", splayTreeCursorEntry(cursor));
+  Show("next", splayTreeCursorNext(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("previous", splayTreeCursorPrevious(cursor));
+
+  /* Seek past a removed entry */
+  Show("remove 50", splayTreeRemove(tree, Key(50)));
+  Show("seek 50", splayTreeCursorSeek(cursor, Key(50)));
+  Show("previous", splayTreeCursorPrevious(cursor));
+  Show("last", splayTreeCursorLast(cursor));
+  Show("seek 100", splayTreeCursorSeek(cursor, Key(100)));
+  printf("check: %s\n", splayTreeCheck(tree) ? "true" : "false");
+
+  splayTreeCursorDestroy(other);
+  splayTreeCursorDestroy(cursor);
+  splayTreeDestroy(tree);
+
+  return EXIT_SUCCESS;
+}
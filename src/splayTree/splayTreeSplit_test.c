@@ -0,0 +1,224 @@
+/*
+ * splayTreeSplit_test.c
+ *
+ * Split and join splay trees: empty trees, splits below, inside and above
+ * the entries, joins in the wrong order and a split of a tree built by
+ * ascending inserts, which leaves a path as long as the tree.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include "splayTree.h"
+
+#define ASCENDING 3000000L
+
+static
+void *
+Alloc(const size_t size, void * const user)
+{
+  (void)user;
+  return malloc(size);
+}
+
+static
+void
+Dealloc(void * const pointer, void * const user)
+{
+  (void)user;
+  free(pointer);
+}
+
+static
+void *
+DuplicateEntry(void * const entry, void * const user)
+{
+  long *copy;
+
+  (void)user;
+  copy = malloc(sizeof(long));
+  if (copy != NULL)
+    {
+      *copy = *(long *)entry;
+    }
+  return copy;
+}
+
+static
+bool
+DeleteEntry(void * const entry, void * const user)
+{
+  (void)user;
+  free(entry);
+  return true;
+}
+
+static
+void
+Debug(const char *function, const unsigned int line, void * const user,
+      const char *format, ...)
+{
+  va_list args;
+
+  (void)function;
+  (void)line;
+  (void)user;
+  va_start(args, format);
+  vprintf(format, args);
+  printf("\n");
+  va_end(args);
+}
+
+static
+compare_e
+Compare(const void * const a, const void * const b, void * const user)
+{
+  long ka = *(const long *)a;
+  long kb = *(const long *)b;
+
+  (void)user;
+  if (ka < kb)
+    {
+      return compareLesser;
+    }
+  if (ka > kb)
+    {
+      return compareGreater;
+    }
+  return compareEqual;
+}
+
+static
+splayTree_t *
+Create(void)
+{
+  splayTree_t *tree;
+
+  tree = splayTreeCreate(Alloc, Dealloc, DuplicateEntry, DeleteEntry, Debug,
+                         Compare, NULL);
+  if (tree == NULL)
+    {
+      fprintf(stderr, "splayTreeCreate() failed\n");
+      exit(EXIT_FAILURE);
+    }
+  return tree;
+}
+
+static
+void
+Show(const char *name, splayTree_t * const tree)
+{
+  long *min = splayTreeGetMin(tree);
+  long *max = splayTreeGetMax(tree);
+
+  printf("%s: size %zu", name, splayTreeGetSize(tree));
+  if ((min != NULL) && (max != NULL))
+    {
+      printf(" min %ld max %ld", *min, *max);
+    }
+  printf("\n");
+}
+
+static
+void
+Split(splayTree_t ** const tree, const long at)
+{
+  splayTree_t *left;
+  splayTree_t *right;
+
+  if (splayTreeSplit(*tree, &at, &left, &right) == false)
+    {
+      printf("split at %ld failed\n", at);
+      return;
+    }
+  printf("split at %ld\n", at);
+  Show("tree", *tree);
+  Show("left", left);
+  Show("right", right);
+  if (splayTreeJoin(left, right) == false)
+    {
+      printf("join failed\n");
+    }
+  Show("joined", left);
+  Show("emptied", right);
+  splayTreeDestroy(right);
+  splayTreeDestroy(*tree);
+  *tree = left;
+}
+
+int main(void)
+{
+  splayTree_t *tree;
+  splayTree_t *other;
+  long k;
+
+  /* Empty tree */
+  tree = Create();
+  Split(&tree, 0);
+
+  /* Splits below, inside and above the entries */
+  for (k=10; k<=100; k+=10)
+    {
+      (void)splayTreeInsert(tree, &k);
+    }
+  Split(&tree, 5);
+  Split(&tree, 50);
+  Split(&tree, 55);
+  Split(&tree, 105);
+  printf("check: %s\n", splayTreeCheck(tree) ? "true" : "false");
+
+  /* Join in the wrong order */
+  other = Create();
+  k = 50;
+  (void)splayTreeInsert(other, &k);
+  printf("join overlapping: %s\n",
+         splayTreeJoin(tree, other) ? "succeeded" : "failed");
+  Show("tree", tree);
+  Show("other", other);
+
+  /* Join with a tree with different user data */
+  splayTreeDestroy(other);
+  other = splayTreeCreate(Alloc, Dealloc, DuplicateEntry, DeleteEntry, Debug,
+                          Compare, &k);
+  k = 200;
+  (void)splayTreeInsert(other, &k);
+  printf("join different user: %s\n",
+         splayTreeJoin(tree, other) ? "succeeded" : "failed");
+  Show("tree", tree);
+  Show("other", other);
+
+  /* Join with an empty tree on either side */
+  splayTreeDestroy(other);
+  other = Create();
+  printf("join empty right: %s\n",
+         splayTreeJoin(tree, other) ? "succeeded" : "failed");
+  printf("join empty left: %s\n",
+         splayTreeJoin(other, tree) ? "succeeded" : "failed");
+  Show("other", other);
+  Show("tree", tree);
+  splayTreeDestroy(tree);
+  tree = other;
+
+  /* One entry */
+  splayTreeClear(tree);
+  k = 7;
+  (void)splayTreeInsert(tree, &k);
+  Split(&tree, 7);
+  Split(&tree, 8);
+  splayTreeDestroy(tree);
+
+  /* Ascending inserts */
+  tree = Create();
+  for (k=0; k<ASCENDING; k++)
+    {
+      (void)splayTreeInsert(tree, &k);
+    }
+  Split(&tree, ASCENDING/3);
+  k = ASCENDING/3;
+  printf("find %ld: %s\n", k,
+         (splayTreeFind(tree, &k) != NULL) ? "found" : "not found");
+  splayTreeDestroy(tree);
+
+  return EXIT_SUCCESS;
+}
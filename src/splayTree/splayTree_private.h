@@ -20,6 +20,8 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "arena.h"
+#include "stack.h"
 #include "splayTree.h"
   
 /**
@@ -72,10 +74,46 @@ struct splayTree_t
   size_t size;
   /**< Number of entries in the tree. */
 
+  size_t version;
+  /**< Incremented when the tree is restructured. A cursor with a
+       different version must find the path to its node again. */
+
+  arena_t *arena;
+  /**< Arena for splayTreeNode_t. \e NULL if nodes use \e alloc(). */
+
+  size_t nodeSize;
+  /**< Size of each splayTreeNode_t including any entry stored in the node. */
+
+  size_t entrySize;
+  /**< Size of the entry stored in each node. Zero if the node stores
+       a pointer to the caller's entry data. */
+
   void *user;
   /**< Placeholder for user data in callbacks. */
 };
 
+/**
+ * \c splayTreeCursor_t structure.
+ *
+ * Private implementation of \c splayTreeCursor_t. There are no parent
+ * pointers in \c splayTreeNode_t so the cursor keeps a stack of the
+ * nodes on the path from the root to the node at the cursor.
+ */
+struct splayTreeCursor_t
+{
+  splayTree_t *tree;
+  /**< The tree traversed by the cursor. */
+
+  splayTreeNode_t *node;
+  /**< Node at the cursor. \e NULL if the cursor does not refer to a node. */
+
+  stack_t *path;
+  /**< Ancestors of \e node from the root of the tree. */
+
+  size_t version;
+  /**< Value of the tree \e version when \e path was found. */
+};
+
 #ifdef __cplusplus
 }
 #endif
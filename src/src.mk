@@ -1,7 +1,10 @@
+include src/arena/arena.mk
 include src/binaryHeap/binaryHeap.mk
+include src/cacheCore/cacheCore.mk
 include src/interp/interp.mk
 include src/intersectList/intersectList.mk
 include src/list/list.mk
+include src/pairingHeap/pairingHeap.mk
 include src/redblackCache/redblackCache.mk
 include src/redblackTree/redblackTree.mk
 include src/skipList/skipList.mk
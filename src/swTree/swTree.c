@@ -11,10 +11,56 @@
 #include <stdbool.h>
 
 #include "compare.h"
+#include "arena.h"
 #include "swTree.h"
 #include "swTree_private.h"
 #include "swTree_lg.h"
 
+/**
+ * Private helper function for Stout/Warren tree implementation.
+ *
+ * Allocate a node from the arena, if it exists, or with \e alloc().
+ *
+ * \param tree pointer to swTree_t
+ * \return pointer to the new swTreeNode_t. \e NULL indicates failure.
+ */
+static
+swTreeNode_t *
+swTreeAllocNode(swTree_t * const tree)
+{
+  if (tree->arena != NULL)
+    {
+      return (swTreeNode_t *)arenaAlloc(tree->arena);
+    }
+  else
+    {
+      return (swTreeNode_t *)
+        (tree->alloc)(sizeof(swTreeNode_t), tree->user);
+    }
+}
+
+/**
+ * Private helper function for Stout/Warren tree implementation.
+ *
+ * Return a node to the arena, if it exists, or to \e dealloc().
+ *
+ * \param tree pointer to swTree_t
+ * \param node pointer to swTreeNode_t
+ */
+static
+void
+swTreeDeallocNode(swTree_t * const tree, swTreeNode_t * const node)
+{
+  if (tree->arena != NULL)
+    {
+      arenaFree(tree->arena, node);
+    }
+  else
+    {
+      (tree->dealloc)(node, tree->user);
+    }
+}
+
 /**
  * Private helper function for Stout/Warren tree implementation.
  *
@@ -410,10 +456,7 @@ swTreeRecurseClear(swTree_t * const tree, swTreeNode_t * const node)
     }
 
   /* Deallocate node */
-  if (tree->dealloc != NULL)
-    {
-      (tree->dealloc)(node, tree->user);
-    }
+  swTreeDeallocNode(tree, node);
   tree->size = tree->size - 1;
 
   return;
@@ -518,11 +561,43 @@ swTree_t *swTreeCreate
   tree->root = NULL; 
   tree->size = 0;
   tree->depth_factor = swTree_depth_factor;
+  tree->arena = NULL;
   tree->user = user;
 
   return tree;
 }
 
+swTree_t *swTreeCreateWithArena
+(const size_t chunkNodes,
+ const swTreeAllocFunc_t alloc,
+ const swTreeDeallocFunc_t dealloc,
+ const swTreeDuplicateEntryFunc_t duplicateEntry,
+ const swTreeDeleteEntryFunc_t deleteEntry,
+ const swTreeDebugFunc_t debug,
+ const swTreeCompFunc_t comp,
+ void * const user)
+{
+  swTree_t *tree; 
+
+  tree = swTreeCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                      debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  tree->arena = arenaCreate(sizeof(swTreeNode_t), chunkNodes,
+                            alloc, dealloc, debug, user);
+  if (tree->arena == NULL)
+    {
+      debug(__func__, __LINE__, user, "Can't create arena!");
+      swTreeDestroy(tree);
+      return NULL;
+    }
+
+  return tree;
+}
+
 void *swTreeFind(swTree_t * const tree, void * const entry)
 {
   if ((tree == NULL) || (entry == NULL))
@@ -591,7 +666,7 @@ void *swTreeInsert(swTree_t * const tree, void * const entry)
     }
 
   /* Not found. Create a node for the new entry */
-  node = (swTreeNode_t *)(tree->alloc)(sizeof(swTreeNode_t), tree->user);
+  node = swTreeAllocNode(tree);
   if (node == NULL)
     {
       (tree->debug)(__func__, __LINE__, tree->user, "tree->alloc() failed!");
@@ -600,7 +675,7 @@ void *swTreeInsert(swTree_t * const tree, void * const entry)
   node->entry = swTreeDuplicateEntry(tree, entry);
   if (node->entry == NULL)
     {
-      (tree->dealloc)(node, tree->user);
+      swTreeDeallocNode(tree, node);
       (tree->debug)(__func__, __LINE__, tree->user,
                     "swTreeDuplicateEntry() failed!");
       return NULL;
@@ -744,7 +819,7 @@ swTreeRemove(swTree_t * const tree, void * const entry)
     {
       (tree->deleteEntry)(removed_entry, tree->user);
     }
-  (tree->dealloc)(removed, tree->user);
+  swTreeDeallocNode(tree, removed);
 
   /* Adjust size */
   tree->size = tree->size-1;
@@ -785,6 +860,7 @@ void swTreeDestroy(swTree_t * const tree)
 
   /* Free all the nodes in the tree */
   swTreeClear(tree);
+  arenaDestroy(tree->arena);
   
   /* Free the tree */
   tree->dealloc(tree, tree->user);
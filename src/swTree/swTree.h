@@ -143,6 +143,34 @@ extern "C" {
    const swTreeCompFunc_t comp,
    void * const user);
 
+  /**
+   * Create an empty Stout/Warren tree with an arena for the tree nodes.
+   * 
+   * Creates and initialises an empty \e swTree_t instance. The tree
+   * nodes are allocated in chunks of \e chunkNodes nodes and nodes that
+   * are removed are recycled by later insertions. The chunks are
+   * deallocated when the tree is destroyed.
+   *
+   * \param chunkNodes number of tree nodes allocated in each chunk
+   * \param alloc memory allocator callback
+   * \param dealloc memory deallocator callback
+   * \param duplicateEntry entry duplication callback for caller's entry data
+   * \param deleteEntry memory deallocator callback for callers entry data
+   * \param debug message function callback
+   * \param comp entry key comparison function callback
+   * \param user \e void pointer to user data to be echoed by callbacks
+   * \return pointer to a \e swTree_t. \e NULL indicates failure
+   */
+  swTree_t *swTreeCreateWithArena
+  (const size_t chunkNodes,
+   const swTreeAllocFunc_t alloc, 
+   const swTreeDeallocFunc_t dealloc,
+   const swTreeDuplicateEntryFunc_t duplicateEntry,
+   const swTreeDeleteEntryFunc_t deleteEntry,
+   const swTreeDebugFunc_t debug,
+   const swTreeCompFunc_t comp,
+   void * const user);
+
   /**
    * Find an entry in the Stout/Warren tree.
    *
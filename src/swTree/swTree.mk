@@ -6,8 +6,9 @@ VPATH += src/swTree
 
 swTree_lg_test_C_SOURCES := swTree_lg_test.c swTree_lg.c 
 
-swTree_interp_C_SOURCES := swTree.c swTree_wrapper.c swTree_lg.c
+swTree_interp_C_SOURCES := swTree.c swTree_wrapper.c swTree_lg.c arena.c
 
 swTree_interp_STATIC_LIBRARIES := interp.a
 
-$(call add_extra_CFLAGS_macro,$(swTree_interp_C_SOURCES),-Isrc/interp)
+$(call add_extra_CFLAGS_macro,$(swTree_interp_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
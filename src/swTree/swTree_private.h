@@ -20,6 +20,7 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "arena.h"
 #include "swTree.h"
 
 /**
@@ -75,6 +76,9 @@ struct swTree_t
   size_t size;
   /**< Number of entries in the swTree. */
 
+  arena_t *arena;
+  /**< Arena for swTreeNode_t. \e NULL if nodes use \e alloc(). */
+
   size_t depth_factor;
   /**< Rebalance when current_depth > depth_factor+floor(lg(size)) */
 
@@ -89,10 +89,82 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
+#include "arena.h"
 #include "trbTree.h"
 #include "trbTree_private.h"
 
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Offset of an entry stored in a trbTreeNode_t rounded up to the
+ * alignment of any type.
+ */
+static const size_t trbTreeEntryOffset =
+  ((sizeof(trbTreeNode_t)+_Alignof(max_align_t)-1)/_Alignof(max_align_t))
+  *_Alignof(max_align_t);
+
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Get a pointer to the entry stored in a node.
+ *
+ * \param node pointer to trbTreeNode_t
+ * \return \e void pointer to the entry stored in the node
+ */
+static
+void *
+trbTreeNodeEntry(trbTreeNode_t * const node)
+{
+  return (void *)(((unsigned char *)node)+trbTreeEntryOffset);
+}
+
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Allocate a node from the arena, if it exists, or with \e alloc().
+ *
+ * \param tree pointer to trbTree_t
+ * \return pointer to the new trbTreeNode_t. \e NULL indicates failure.
+ */
+static
+trbTreeNode_t *
+trbTreeAllocNode(trbTree_t * const tree)
+{
+  if (tree->arena != NULL)
+    {
+      return (trbTreeNode_t *)arenaAlloc(tree->arena);
+    }
+  else
+    {
+      return (trbTreeNode_t *)(tree->alloc)(tree->nodeSize, tree->user);
+    }
+}
+
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Return a node to the arena, if it exists, or to \e dealloc().
+ *
+ * \param tree pointer to trbTree_t
+ * \param node pointer to trbTreeNode_t
+ */
+static
+void
+trbTreeDeallocNode(trbTree_t * const tree, trbTreeNode_t * const node)
+{
+  if (tree->arena != NULL)
+    {
+      arenaFree(tree->arena, node);
+    }
+  else
+    {
+      (tree->dealloc)(node, tree->user);
+    }
+}
+
 /**
  * Private helper function for threaded red-black tree implementation.
  *
@@ -1211,16 +1283,24 @@ trbTreeFindNode(trbTree_t * const tree, const void * const entry)
  *  Duplicate an entry.
  *
  * \param tree pointer to \c trbTree_t
+ * \param node pointer to the trbTreeNode_t for the entry
  * \param entry pointer to caller's data 
  * \return pointer to duplicated entry
  */
 static
 void *
-trbTreeDuplicateEntry(trbTree_t * const tree, void * const entry)
+trbTreeDuplicateEntry(trbTree_t * const tree,
+                      trbTreeNode_t * const node,
+                      void * const entry)
 {
   void *new_entry;
 
-  if (tree->duplicateEntry != NULL)
+  if (tree->entrySize != 0)
+    {
+      new_entry = trbTreeNodeEntry(node);
+      memcpy(new_entry, entry, tree->entrySize);
+    }
+  else if (tree->duplicateEntry != NULL)
     {
       new_entry = tree->duplicateEntry(entry, tree->user);
       if (new_entry == NULL)
@@ -1238,6 +1318,187 @@ trbTreeDuplicateEntry(trbTree_t * const tree, void * const entry)
   return new_entry;
 }
 
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Build a balanced subtree from a list of nodes in ascending order. The
+ * nodes are linked through their \e right pointers and are taken in order
+ * so that they are placed in the subtree in order. A node without a left
+ * or right child is threaded to the previous or next node. The nodes at
+ * the deepest level of the whole tree, \e redDepth, are coloured red and
+ * all other nodes are coloured black. 
+ *
+ * \param list pointer to the list of \c trbTreeNode_t. On return points
+ * to the first node not used.
+ * \param prev pointer to the last node placed in the tree. On return
+ * points to the last node placed in the subtree.
+ * \param n number of nodes in the subtree
+ * \param depth depth of the root of the subtree
+ * \param redDepth depth of the nodes coloured red
+ * \return pointer to the \c trbTreeNode_t at the root of the subtree
+ */
+static
+trbTreeNode_t *
+trbTreeBuildSubtree(trbTreeNode_t ** const list,
+                    trbTreeNode_t ** const prev,
+                    const size_t n,
+                    const size_t depth,
+                    const size_t redDepth)
+{
+  trbTreeNode_t *left, *right, *node;
+
+  if (n == 0)
+    {
+      return NULL;
+    }
+
+  left = trbTreeBuildSubtree(list, prev, n/2, depth+1, redDepth);
+
+  node = *list;
+  *list = node->right;
+  if (left != NULL)
+    {
+      node->left = left;
+      node->leftTag = trbTreeChild;
+      left->parent = node;
+    }
+  else
+    {
+      node->left = *prev;
+      node->leftTag = trbTreeLeaf;
+    }
+  if ((*prev != NULL) && ((*prev)->rightTag == trbTreeLeaf))
+    {
+      (*prev)->right = node;
+    }
+  if ((depth == redDepth) && (depth != 0))
+    {
+      trbTreeSetRed(node);
+    }
+  else
+    {
+      trbTreeSetBlack(node);
+    }
+  *prev = node;
+
+  right = trbTreeBuildSubtree(list, prev, n-(n/2)-1, depth+1, redDepth);
+  if (right != NULL)
+    {
+      node->right = right;
+      node->rightTag = trbTreeChild;
+      right->parent = node;
+    }
+  else
+    {
+      node->right = NULL;
+      node->rightTag = trbTreeLeaf;
+    }
+
+  return node;
+}
+
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Floor of the base 2 logarithm of the number of nodes. This is the depth
+ * of the deepest level of a tree built by halving.
+ *
+ * \param n number of nodes
+ * \return floor(log2(n)). Zero if \e n is zero.
+ */
+static
+size_t
+trbTreeLog2(const size_t n)
+{
+  size_t k, lg;
+
+  lg = 0;
+  for (k=n; k>1; k=k/2)
+    {
+      lg = lg+1;
+    }
+
+  return lg;
+}
+
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Find the first node with an entry not less than the given entry.
+ *
+ * \param tree pointer to \c trbTree_t
+ * \param entry pointer to caller's data 
+ * \return pointer to \c trbTreeNode_t found. \c NULL if not found.
+ */
+static
+trbTreeNode_t *
+trbTreeSeekNode(trbTree_t * const tree, const void * const entry)
+{
+  compare_e comp;
+  trbTreeNode_t *node;
+  trbTreeNode_t *upper;
+
+  node = tree->root;
+  upper = node;
+
+  while (trbTreeIsValid(tree, node))
+    {
+      comp = (tree->compare)(entry, node->entry, tree->user);
+      if (comp == compareLesser) 
+        {
+          upper = node->left;
+          if (trbTreeLeftIsLeaf(node))
+            {
+              upper = node;
+              break;
+            }
+        }
+      else if (comp == compareGreater)
+        {
+          upper = node->right;
+          if (trbTreeRightIsLeaf(node))
+            {
+              upper =  trbTreeFindNext(node);
+              break;
+            }
+        }
+      else if (comp == compareEqual)
+        {
+          upper = node;
+          break;
+        }
+      else
+        {
+          tree->debug(__func__, __LINE__, tree->user,
+                      "Illegal compare result!");
+          return NULL;
+        }
+
+      node = upper;
+    }
+
+  return upper;
+}
+
+/**
+ * Private helper function for threaded red-black tree implementation.
+ *
+ * Deallocate a node removed from the tree and its entry.
+ *
+ * \param tree pointer to \c trbTree_t
+ * \param node pointer to \c trbTreeNode_t
+ */
+static
+void
+trbTreeDeleteNode(trbTree_t * const tree, trbTreeNode_t * const node)
+{
+  if ((tree->deleteEntry != NULL) && (node->entry != NULL))
+    {
+      (tree->deleteEntry)(node->entry, tree->user);
+    }
+  trbTreeDeallocNode(tree, node);
+}
+
 trbTree_t *
 trbTreeCreate(const trbTreeAllocFunc_t alloc, 
               const trbTreeDeallocFunc_t dealloc,
@@ -1283,6 +1544,9 @@ trbTreeCreate(const trbTreeAllocFunc_t alloc,
   tree->deleteEntry = deleteEntry;
   tree->debug = debug;
   tree->compare = comp;
+  tree->nodeSize = sizeof(trbTreeNode_t);
+  tree->entrySize = 0;
+  tree->arena = NULL;
   tree->user = user;
   tree->root = NULL;
   tree->current = NULL;
@@ -1291,6 +1555,81 @@ trbTreeCreate(const trbTreeAllocFunc_t alloc,
   return tree;
 }
 
+trbTree_t *
+trbTreeCreateWithArena(const size_t chunkNodes,
+                       const trbTreeAllocFunc_t alloc,
+                       const trbTreeDeallocFunc_t dealloc,
+                       const trbTreeDuplicateEntryFunc_t duplicateEntry,
+                       const trbTreeDeleteEntryFunc_t deleteEntry,
+                       const trbTreeDebugFunc_t debug,
+                       const trbTreeCompFunc_t comp,
+                       void * const user)
+{
+  trbTree_t *tree; 
+
+  tree = trbTreeCreate(alloc, dealloc, duplicateEntry, deleteEntry,
+                       debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+
+  tree->arena = arenaCreate(tree->nodeSize, chunkNodes,
+                            alloc, dealloc, debug, user);
+  if (tree->arena == NULL)
+    {
+      debug(__func__, __LINE__, user, "Can't create arena!");
+      trbTreeDestroy(tree);
+      return NULL;
+    }
+
+  return tree;
+}
+
+trbTree_t *
+trbTreeCreateInline(const size_t entrySize,
+                    const size_t chunkNodes,
+                    const trbTreeAllocFunc_t alloc,
+                    const trbTreeDeallocFunc_t dealloc,
+                    const trbTreeDebugFunc_t debug,
+                    const trbTreeCompFunc_t comp,
+                    void * const user)
+{
+  trbTree_t *tree; 
+
+  if (debug == NULL)
+    {
+      return NULL;
+    }
+  if (entrySize == 0)
+    {
+      debug(__func__, __LINE__, user, "Request for entrySize==0!");
+      return NULL;
+    }
+
+  tree = trbTreeCreate(alloc, dealloc, NULL, NULL, debug, comp, user);
+  if (tree == NULL)
+    {
+      return NULL;
+    }
+  tree->entrySize = entrySize;
+  tree->nodeSize = trbTreeEntryOffset+entrySize;
+
+  if (chunkNodes != 0)
+    {
+      tree->arena = arenaCreate(tree->nodeSize, chunkNodes,
+                                alloc, dealloc, debug, user);
+      if (tree->arena == NULL)
+        {
+          debug(__func__, __LINE__, user, "Can't create arena!");
+          trbTreeDestroy(tree);
+          return NULL;
+        }
+    }
+
+  return tree;
+}
+
 void *
 trbTreeFind(trbTree_t * const tree, void * const entry)
 {
@@ -1360,7 +1699,7 @@ trbTreeInsert(trbTree_t * const tree, void * const entry)
             {
               (tree->deleteEntry)(node->entry, tree->user);
             }
-          node->entry = trbTreeDuplicateEntry(tree, entry);
+          node->entry = trbTreeDuplicateEntry(tree, node, entry);
           if (node->entry == NULL)
             {
               (tree->debug)(__func__, __LINE__, tree->user,
@@ -1368,7 +1707,7 @@ trbTreeInsert(trbTree_t * const tree, void * const entry)
               return NULL;
             }
           tree->current = node;
-          return entry;
+          return node->entry;
         }
       else
         {
@@ -1379,7 +1718,7 @@ trbTreeInsert(trbTree_t * const tree, void * const entry)
     }
 
   /* Create a node for the new entry */
-  node = (trbTreeNode_t *)(tree->alloc)(sizeof(trbTreeNode_t), tree->user);
+  node = trbTreeAllocNode(tree);
   if (node == NULL)
     {
       return NULL;
@@ -1389,10 +1728,10 @@ trbTreeInsert(trbTree_t * const tree, void * const entry)
    *  Inserting a node is much easier than removing 
    *  one because left and right are leaves!
    */
-  node->entry = trbTreeDuplicateEntry(tree, entry);
+  node->entry = trbTreeDuplicateEntry(tree, node, entry);
   if (node->entry == NULL)
     {
-      (tree->dealloc)(node, tree->user);
+      trbTreeDeallocNode(tree, node);
       (tree->debug)(__func__, __LINE__, tree->user,
                     "trbTreeDuplicateEntry() failed!");
       return NULL;
@@ -1471,8 +1810,13 @@ trbTreeRemove(trbTree_t * const tree, void * const entry)
 
   /* Deallocate the deleted node and entry */
   oldEntry = old->entry;
-  (tree->dealloc)(old, tree->user);
-  if(tree->deleteEntry != NULL)
+  trbTreeDeallocNode(tree, old);
+  if (tree->entrySize != 0)
+    {
+      /* The entry was stored in the deallocated node */
+      return NULL;
+    }
+  else if(tree->deleteEntry != NULL)
     {
       (tree->deleteEntry)(oldEntry, tree->user);
       return NULL;
@@ -1483,6 +1827,178 @@ trbTreeRemove(trbTree_t * const tree, void * const entry)
     }
 }
 
+size_t
+trbTreeRemoveRange(trbTree_t * const tree,
+                   const void * const lo,
+                   const void * const hi)
+{
+  trbTreeNode_t *first, *node, *next, *list, **tail, *prev;
+  compare_e comp;
+  size_t k, index;
+
+  if ((tree == NULL) || (lo == NULL) || (hi == NULL))
+    {
+      return 0;
+    }
+
+  /* Count the entries in the range by following the thread */
+  first = trbTreeSeekNode(tree, lo);
+  k = 0;
+  for (node = first; node != NULL; node = trbTreeFindNext(node))
+    {
+      comp = (tree->compare)(node->entry, hi, tree->user);
+      if (comp != compareLesser)
+        {
+          break;
+        }
+      k = k+1;
+    }
+  if (k == 0)
+    {
+      return 0;
+    }
+  tree->current = NULL;
+
+  /* 
+   * Removing nodes one at a time costs O(lg N) each. If removing the range
+   * costs more than rebuilding the tree from the remaining nodes in O(N)
+   * then rebuild the tree. The thread is followed to list the remaining
+   * nodes in order. The successor of each node is found before the node 
+   * is deleted or its right pointer is used to link the list.
+   */
+  if ((k*(trbTreeLog2(tree->size)+1)) > tree->size)
+    {
+      list = NULL;
+      tail = &list;
+      index = 0;
+      node = trbTreeFindMinMax(tree, compareLesser);
+      while (node != NULL)
+        {
+          next = trbTreeFindNext(node);
+          if ((node == first) || ((index > 0) && (index < k)))
+            {
+              index = index+1;
+              trbTreeDeleteNode(tree, node);
+            }
+          else
+            {
+              *tail = node;
+              tail = &(node->right);
+            }
+          node = next;
+        }
+      *tail = NULL;
+      tree->size = tree->size-k;
+      prev = NULL;
+      tree->root = trbTreeBuildSubtree(&list, &prev, tree->size, 0,
+                                       trbTreeLog2(tree->size));
+      if (tree->root != NULL)
+        {
+          tree->root->parent = NULL;
+        }
+      return k;
+    }
+
+  /* Otherwise follow the thread through the range */
+  node = first;
+  for (index=0; (index<k) && (node != NULL); index++)
+    {
+      next = trbTreeFindNext(node);
+      if (trbTreeRemoveNode(tree, node) != NULL)
+        {
+          trbTreeDeleteNode(tree, node);
+        }
+      node = next;
+    }
+
+  return k;
+}
+
+bool
+trbTreeBuildFromSorted(trbTree_t * const tree,
+                       void * const * const entries,
+                       const size_t n)
+{
+  trbTreeNode_t *list, *last, *node, *prev;
+  size_t k, redDepth;
+
+  if (tree == NULL)
+    {
+      return false;
+    }
+  if ((entries == NULL) && (n != 0))
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, "entries == NULL!");
+      return false;
+    }
+  if (tree->root != NULL)
+    {
+      (tree->debug)(__func__, __LINE__, tree->user, "tree is not empty!");
+      return false;
+    }
+
+  /* Allocate the nodes and duplicate the entries before building */
+  list = NULL;
+  last = NULL;
+  for (k=0; k<n; k++)
+    {
+      node = NULL;
+      if (entries[k] != NULL)
+        {
+          node = trbTreeAllocNode(tree);
+        }
+      if (node != NULL)
+        {
+          node->entry = trbTreeDuplicateEntry(tree, node, entries[k]);
+          if (node->entry == NULL)
+            {
+              trbTreeDeallocNode(tree, node);
+              node = NULL;
+            }
+        }
+      if (node == NULL)
+        {
+          (tree->debug)(__func__, __LINE__, tree->user,
+                        "Can't create node for entry %zu!", k);
+          while (list != NULL)
+            {
+              node = list;
+              list = list->right;
+              if (tree->deleteEntry != NULL)
+                {
+                  (tree->deleteEntry)(node->entry, tree->user);
+                }
+              trbTreeDeallocNode(tree, node);
+            }
+          return false;
+        }
+      node->right = NULL;
+      if (last == NULL)
+        {
+          list = node;
+        }
+      else
+        {
+          last->right = node;
+        }
+      last = node;
+    }
+
+  /* The deepest level of a tree built by halving has depth floor(log2(n)) */
+  redDepth = trbTreeLog2(n);
+
+  prev = NULL;
+  tree->root = trbTreeBuildSubtree(&list, &prev, n, 0, redDepth);
+  if (tree->root != NULL)
+    {
+      tree->root->parent = NULL;
+    }
+  tree->current = NULL;
+  tree->size = n;
+
+  return true;
+}
+
 void
 trbTreeClear(trbTree_t * const tree)
 {
@@ -1507,7 +2023,7 @@ trbTreeClear(trbTree_t * const tree)
             {
               (tree->deleteEntry)(node->entry, tree->user);
             }
-          tree->dealloc(node, tree->user);
+          trbTreeDeallocNode(tree, node);
         }
       node = next;
     }
@@ -1524,6 +2040,7 @@ trbTreeDestroy(trbTree_t * const tree)
 
   /* Delete all nodes */
   trbTreeClear(tree);
+  arenaDestroy(tree->arena);
 
   /* Deallocate tree */
   (tree->dealloc)(tree, tree->user);
@@ -1755,8 +2272,6 @@ trbTreeGetLower(trbTree_t * const tree, const void * const entry)
 void *
 trbTreeGetUpper(trbTree_t * const tree, const void * const entry)
 {
-  compare_e comp;
-  trbTreeNode_t *node;
   trbTreeNode_t *upper;
 
   if ((tree == NULL) || (entry == NULL))
@@ -1764,45 +2279,7 @@ trbTreeGetUpper(trbTree_t * const tree, const void * const entry)
       return NULL;
     }
 
-  node = tree->root;
-  upper = node;
-
-  while (trbTreeIsValid(tree, node))
-    {
-      comp = (tree->compare)(entry, node->entry, tree->user);
-      if (comp == compareLesser) 
-        {
-          upper = node->left;
-          if (trbTreeLeftIsLeaf(node))
-            {
-              upper = node;
-              break;
-            }
-        }
-      else if (comp == compareGreater)
-        {
-          upper = node->right;
-          if (trbTreeRightIsLeaf(node))
-            {
-              upper =  trbTreeFindNext(node);
-              break;
-            }
-        }
-      else if (comp == compareEqual)
-        {
-          upper = node;
-          break;
-        }
-      else
-        {
-          tree->debug(__func__, __LINE__, tree->user,
-                      "Illegal compare result!");
-          return NULL;
-        }
-
-      node = upper;
-    }
-
+  upper = trbTreeSeekNode(tree, entry);
   if (upper == NULL)
     {
       return NULL;
@@ -1838,6 +2315,45 @@ trbTreeWalk(trbTree_t * const tree, const trbTreeWalkFunc_t walk)
   return true;
 }
 
+bool
+trbTreeWalkRange(trbTree_t * const tree, 
+                 const void * const lo,
+                 const void * const hi,
+                 const trbTreeWalkFunc_t walk)
+{
+  compare_e comp;
+  trbTreeNode_t *node, *nextNode;
+
+  if ((tree == NULL) || (lo == NULL) || (hi == NULL) || (walk == NULL))
+    {
+      return false;
+    }
+
+  node = trbTreeSeekNode(tree, lo);
+  while (node != NULL)
+    {
+      comp = (tree->compare)(node->entry, hi, tree->user);
+      if ((comp == compareEqual) || (comp == compareGreater))
+        {
+          break;
+        }
+      else if (comp != compareLesser)
+        {
+          tree->debug(__func__, __LINE__, tree->user,
+                      "Illegal compare result!");
+          return false;
+        }
+      nextNode = trbTreeFindNext(node); 
+      if (walk(node->entry, tree->user) == false)
+        {
+          return false;
+        }
+      node = nextNode; 
+    }
+
+  return true;
+}
+
 #ifdef DEBUG_TRB_TREE_SHOW
 /* For testing */
 static
@@ -137,6 +137,64 @@ trbTree_t *trbTreeCreate
  const trbTreeCompFunc_t comp,
  void * const user);
 
+/**
+ * Create an empty threaded red-black tree with an arena for the tree nodes.
+ * 
+ * Creates and initialises an empty \e trbTree_t instance. The tree
+ * nodes are allocated in chunks of \e chunkNodes nodes and nodes that
+ * are removed are recycled by later insertions. The chunks are
+ * deallocated when the tree is destroyed.
+ *
+ * \param chunkNodes number of tree nodes allocated in each chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param duplicateEntry entry duplication callback for caller's entry data
+ * \param deleteEntry memory deallocator callback for callers entry data
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e trbTree_t. \e NULL indicates failure
+ */
+trbTree_t *trbTreeCreateWithArena
+(const size_t chunkNodes,
+ const trbTreeAllocFunc_t alloc, 
+ const trbTreeDeallocFunc_t dealloc,
+ const trbTreeDuplicateEntryFunc_t duplicateEntry,
+ const trbTreeDeleteEntryFunc_t deleteEntry,
+ const trbTreeDebugFunc_t debug,
+ const trbTreeCompFunc_t comp,
+ void * const user);
+
+/**
+ * Create an empty threaded red-black tree storing entries in the tree nodes.
+ * 
+ * Creates and initialises an empty \e trbTree_t instance that copies
+ * each entry of \e entrySize bytes into the tree node rather than storing
+ * a pointer to the caller's entry data. The entry pointers returned by the
+ * tree refer to the copy in the node and are valid until that entry is
+ * removed. A removed entry is not returned to the caller. There are no
+ * \e duplicateEntry and \e deleteEntry callbacks. If \e chunkNodes is
+ * not zero then the tree nodes are allocated from an arena with
+ * \e chunkNodes nodes in each chunk.
+ *
+ * \param entrySize size in bytes of each entry
+ * \param chunkNodes number of tree nodes allocated in each arena chunk
+ * \param alloc memory allocator callback
+ * \param dealloc memory deallocator callback
+ * \param debug message function callback
+ * \param comp entry key comparison function callback
+ * \param user \e void pointer to user data to be echoed by callbacks
+ * \return pointer to a \e trbTree_t. \e NULL indicates failure
+ */
+trbTree_t *trbTreeCreateInline
+(const size_t entrySize,
+ const size_t chunkNodes,
+ const trbTreeAllocFunc_t alloc, 
+ const trbTreeDeallocFunc_t dealloc,
+ const trbTreeDebugFunc_t debug,
+ const trbTreeCompFunc_t comp,
+ void * const user);
+
 /**
  * Find an entry in the threaded red-black tree.
  *
@@ -188,6 +246,41 @@ void *trbTreeInsert(trbTree_t * const tree, void * const entry);
  */
 void *trbTreeRemove(trbTree_t * const tree, void * const entry);
 
+/**
+ * Remove a range of entries from the tree.
+ *
+ * Removes the entries not less than \e lo and less than \e hi. Each
+ * entry removed is deleted as by \e trbTreeRemove() with a 
+ * \e deleteEntry() callback. A small range is removed by following the
+ * thread from \e lo. If that would cost more than O(N) the tree is 
+ * rebuilt from the remaining entries instead.
+ *
+ * \param tree pointer to \e trbTree_t
+ * \param lo \e void pointer to caller's entry data for the start of the range
+ * \param hi \e void pointer to caller's entry data for the end of the range
+ * \return number of entries removed
+ */
+size_t trbTreeRemoveRange(trbTree_t * const tree,
+                          const void * const lo,
+                          const void * const hi);
+
+/**
+ * Build a balanced threaded red-black tree from sorted entries.
+ *
+ * Inserts \e n entries into an empty tree in O(n) time without comparing
+ * entries. The threads are set as the tree is built. The entries must be
+ * in strictly ascending order. Each entry is duplicated as by
+ * \e trbTreeInsert(). On failure the tree is left empty.
+ *
+ * \param tree pointer to an empty \e trbTree_t
+ * \param entries array of pointers to caller's entries in ascending order
+ * \param n number of entries
+ * \return \e true if the tree was built. \e false indicates failure.
+ */
+bool trbTreeBuildFromSorted(trbTree_t * const tree,
+                            void * const * const entries,
+                            const size_t n);
+
 /**
  * Clear the threaded red-black tree.
  *
@@ -319,6 +412,24 @@ void *trbTreeGetLower(trbTree_t * const tree, const void * const entry);
  */
 bool trbTreeWalk(trbTree_t * const tree, const trbTreeWalkFunc_t walk);
 
+/** 
+ * Operate on a range of tree entries.
+ *
+ * Traverses the entries not less than \e lo and less than \e hi in 
+ * increasing order calling a function for each entry. Only the nodes in
+ * the range and on the path to \e lo are visited.
+ *
+ * \param tree pointer to \e trbTree_t
+ * \param lo \e void pointer to caller's entry data for the start of the range
+ * \param hi \e void pointer to caller's entry data for the end of the range
+ * \param walk pointer to a callback function to be called for each entry
+ * \return \e bool indicating sucess
+ */
+bool trbTreeWalkRange(trbTree_t * const tree, 
+                      const void * const lo,
+                      const void * const hi,
+                      const trbTreeWalkFunc_t walk);
+
 /** 
  * Check the colour property of the tree.
  *
@@ -1,11 +1,17 @@
 # Programs in this directory
-trbTree_PROGRAMS:=trbTree_interp
+trbTree_PROGRAMS:=trbTree_interp trbTreeInline_test
 PROGRAMS+=$(trbTree_PROGRAMS)
 
 VPATH += src/trbTree
 
-trbTree_interp_C_SOURCES := trbTree.c trbTree_wrapper.c
+trbTree_interp_C_SOURCES := trbTree.c trbTree_wrapper.c arena.c
 
 trbTree_interp_STATIC_LIBRARIES := interp.a
 
-$(call add_extra_CFLAGS_macro,$(trbTree_interp_C_SOURCES),-Isrc/interp)
+$(call add_extra_CFLAGS_macro,$(trbTree_interp_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
+
+trbTreeInline_test_C_SOURCES := trbTreeInline_test.c trbTree.c arena.c
+
+$(call add_extra_CFLAGS_macro,$(trbTreeInline_test_C_SOURCES),\
+-Isrc/arena -Isrc/interp)
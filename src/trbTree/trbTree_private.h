@@ -20,6 +20,7 @@ extern "C" {
 #endif
 
 #include "compare.h"
+#include "arena.h"
 #include "trbTree.h"
 
 /**
@@ -117,6 +118,16 @@ struct trbTree_t
   size_t size;
   /**< Number of entries in the threaded red-black tree. */
 
+  arena_t *arena;
+  /**< Arena for trbTreeNode_t. \e NULL if nodes use \e alloc(). */
+
+  size_t nodeSize;
+  /**< Size of each trbTreeNode_t including any entry stored in the node. */
+
+  size_t entrySize;
+  /**< Size of the entry stored in each node. Zero if the node stores
+       a pointer to the caller's entry data. */
+
   void *user;
   /**< Placeholder for user data in callbacks. */
 };
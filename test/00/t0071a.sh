@@ -0,0 +1,102 @@
+#!/bin/sh
+#
+prog="bsTree_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check bsTree with nodes allocated from an arena
+k=1000;
+l=create(16);
+for (x=0;x<k;x=x+1;)
+{
+  insert(l, rand(k));
+}
+"Check";x=check(l); print x;
+for (x=0;x<k;x=x+1;)
+{
+  y=rand(k);
+  remove(l, &y);
+  y=rand(k);
+  insert(l, y);
+}
+"Check";x=check(l); print x;
+clear(l);
+"Size after clear"; x=size(l); print x;
+for (x=0;x<100;x=x+1;)
+{
+  insert(l, x);
+}
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Min"; p=min(l); print *p;
+"Max"; p=max(l); print *p;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+Check
+1
+Check
+1
+Size after clear
+0
+Size
+100
+Check
+1
+Min
+0
+Max
+99
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
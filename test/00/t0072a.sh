@@ -0,0 +1,125 @@
+#!/bin/sh
+#
+prog="trbTree_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check trbTree with nodes allocated from an arena
+l=create(8);
+for (x=0;x<20;x=x+1;)
+{
+  insert(l, (x*7)%20);
+}
+"Insert existing"; x=7; p=insert(l, x); print *p;
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Find"; x=13; p=find(l, x); print *p;
+"Remove"; x=13; p=remove(l, &x); print (p==0);
+"Find removed"; x=13; p=find(l, x); print (p==0);
+"Upper"; x=13; p=upper(l, &x); print *p;
+"Lower"; x=13; p=lower(l, &x); print *p;
+for (x=0;x<20;x=x+2;)
+{
+  remove(l, &x);
+}
+"Size";x=size(l);print x;
+walk(l, show);
+"Check";x=check(l); print x;
+for (x=0;x<2000;x=x+1;)
+{
+  insert(l, rand(1000));
+  y=rand(1000);
+  remove(l, &y);
+}
+"Check";x=check(l); print x;
+clear(l);
+"Size after clear";x=size(l);print x;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+Insert existing
+7
+Size
+20
+Check
+1
+Find
+13
+Remove
+1
+Find removed
+1
+Upper
+14
+Lower
+12
+Size
+9
+1
+3
+5
+7
+9
+11
+15
+17
+19
+Check
+1
+Check
+1
+Size after clear
+0
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,105 @@
+#!/bin/sh
+#
+prog="redblackTree_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check building a red-black tree from sorted entries
+for (n=0;n<18;n=n+1;)
+{
+  l=create();
+  build(l, n);
+  "Size, depth and check";print size(l); print depth(l); print check(l);
+  destroy(l);
+}
+l=create();
+build(l, 1000);
+"Size";x=size(l);print x;
+"Depth";x=depth(l);print x;
+"Check";x=check(l); print x;
+"Min"; p=min(l); print *p;
+"Max"; p=max(l); print *p;
+"Find"; x=517; p=find(l, x); print *p;
+"Next"; p=next(l, p); print *p;
+"Previous"; p=previous(l, p); print *p;
+for (x=0;x<1000;x=x+2;)
+{
+  remove(l, &x);
+}
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+for (x=0;x<2000;x=x+1;)
+{
+  insert(l, rand(1000));
+  y=rand(1000);
+  remove(l, &y);
+}
+"Check";x=check(l); print x;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAfdHNCoMwDAfwe56iD7BDqlbteWM3ZeATiC1Y
+Bt3Y3BCfflH2cVn/5NDSX5OSpguL3ynnr9Oo+ujUMPrhTCyhqftrGlgmkbIc
+WCGaMgOsBFYBq+XFlFlgmhFqhBnCHGGB0CAs5fOSWH1R2mKmw3ph7XD/HnMT
+ooy66Wey1tIxREdGslo/T7Kp6XTzz3B53LfTrY7hX/ZnfQExFaYuYQIAAA==
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,131 @@
+#!/bin/sh
+#
+prog="skipList_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check skipList next, previous, min and max
+l=create();
+for (x=0;x<200;x=x+1;)
+{
+  insert(l, (x*37)%200);
+}
+for (x=0;x<200;x=x+3;)
+{
+  remove(l, &x);
+}
+"Check";x=check(l); print x;
+"Size";x=size(l);print x;
+"Min"; p=min(l); print *p;
+"Max"; p=max(l); print *p;
+"Forward";
+p=min(l);
+for (x=0;x<8;x=x+1;)
+{
+  print *p;
+  p=next(l, p);
+}
+"Backward";
+p=max(l);
+for (x=0;x<8;x=x+1;)
+{
+  print *p;
+  p=previous(l, p);
+}
+"Next of max"; p=max(l); p=next(l, p); print (p==0);
+"Previous of min"; p=min(l); p=previous(l, p); print (p==0);
+for (x=0;x<2000;x=x+1;)
+{
+  insert(l, rand(1000));
+  y=rand(1000);
+  remove(l, &y);
+}
+"Check";x=check(l); print x;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+Check
+1
+Size
+133
+Min
+1
+Max
+199
+Forward
+1
+2
+4
+5
+7
+8
+10
+11
+Backward
+199
+197
+196
+194
+193
+191
+190
+188
+Next of max
+1
+Previous of min
+1
+Check
+1
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
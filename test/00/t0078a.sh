@@ -0,0 +1,107 @@
+#!/bin/sh
+#
+prog="trbTree_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check walking and removing ranges of entries
+l=create();
+for (x=0;x<1000;x=x+1;)
+{
+  insert(l, x);
+}
+"Walk [10, 15)"; a=10; b=15; walkrange(l, &a, &b, show);
+"Walk [995, 2000)"; a=995; b=2000; walkrange(l, &a, &b, show);
+"Walk empty [20, 20)"; a=20; b=20; walkrange(l, &a, &b, show);
+"Remove [100, 110)"; a=100; b=110; x=removerange(l, &a, &b); print x;
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Walk [95, 115)"; a=95; b=115; walkrange(l, &a, &b, show);
+"Remove again [100, 110)"; a=100; b=110; x=removerange(l, &a, &b); print x;
+"Remove [-5, 3)"; a=-5; b=3; x=removerange(l, &a, &b); print x;
+"Min"; p=min(l); print *p;
+"Remove [200, 900)"; a=200; b=900; x=removerange(l, &a, &b); print x;
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Walk [195, 905)"; a=195; b=905; walkrange(l, &a, &b, show);
+"Remove [990, 5000)"; a=990; b=5000; x=removerange(l, &a, &b); print x;
+"Max"; p=max(l); print *p;
+"Remove all"; a=-1; b=1000; x=removerange(l, &a, &b); print x;
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+for (x=0;x<2000;x=x+1;)
+{
+  insert(l, rand(1000));
+  if (x%100 == 0) { a=rand(1000); b=a+rand(50); removerange(l, &a, &b); }
+}
+"Check";x=check(l); print x;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAXZC7DsIwDEV3f0XWSEWyU0qambkLDB06VSiC
+qg8YEAK+nuu+QAy3jVrn+Nhl3bWmEk6MZJaESYTEkaQkWyrHnyFkiXHMbAlH
+ZId4JEfCVBT72/1lKsdaaekQ++sjKlfBwiP52LwjbjDtL/HUkiz4TEvQXNlA
+g6xgiKgMbFRHfSA0c+tz3Qy/dF47bkBLLaVUNAOey2enpUFH8DybuNz/mYiq
+BNY9wEUgI7AR6Ah8cBsRxCEpsvpgRcBn44pgXdRPzBBW264j5/3U9Tv98v4A
+vvxmA4IBAAA=
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,126 @@
+#!/bin/sh
+#
+prog="splayCache_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for cache replacement policies
+
+# Hit counts for a hot set mixed with a scan
+"Policies";
+for(p=0; p<4; p=p+1;)
+{
+  l=create(100);
+  "Policy"; print p;
+  x=policy(l, p); print x;
+  h=0;
+  for(x=0; x<20000; x=x+1;)
+  {
+    if (x%3 == 0)
+    {
+      y = 1000 + x;
+    }
+    else
+    {
+      y = rand(120);
+    }
+    r = find(l, y);
+    if (r == 0)
+    {
+      insert(l, y);
+    }
+    else
+    {
+      h = h+1;
+    }
+    if (x%1000 == 0)
+    {
+      c=check(l);
+      if (c == 0)
+      {
+        "!!!Check FAILED!!!"; x=1000000;
+      }
+    }
+  }
+  "Hits"; print h;
+  "Size"; x=size(l); print x;
+  "Check"; x=check(l); print x;
+
+  "Clear";
+  clear(l);
+  "Size"; x=size(l); print x;
+  "Check"; x=check(l); print x;
+  "Walk";
+  for(x=0; x<5; x=x+1;)
+  {
+    insert(l, x);
+    find(l, 0);
+  }
+  walk(l, show);
+  destroy(l);
+}
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sApcw7CoAwEATQfk6zu5GotY2lYGEdJGAwIKiN
+nt6ILtZqNx94zRRDH/yC5gwbCIw6rAusZYs27B5MhGrw/ZiuKno3X/Mzdi6O
+qWYwkFRviVXKmfiNpA6pJCqVJP8koxJTIfKNOgB2M7XpMgEAAA==
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,107 @@
+#!/bin/sh
+#
+prog="redblackCache_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for cache statistics
+
+"Empty cache";
+l=create(50);
+x=stats(l); print x;
+destroy(l);
+
+"Statistics";
+for(p=0; p<4; p=p+1;)
+{
+  l=create(50);
+  "Policy"; print p;
+  policy(l, p);
+  for(x=0; x<5000; x=x+1;)
+  {
+    y = rand(80);
+    r = find(l, y);
+    if (r == 0)
+    {
+      insert(l, y);
+    }
+    if (x%7 == 0)
+    {
+      insert(l, y);
+    }
+  }
+  x=stats(l); print x;
+  "Size"; x=size(l); print x;
+
+  "Clear";
+  clear(l);
+  x=stats(l); print x;
+  destroy(l);
+}
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAvdLfCoIwGIfh812Fl7A/Tu04Og+6gjE+8KOp
+w63Irj6VmVpiINLR/DHh4YWdCuubSCudAzFVdb1ZF1GSo++OAp2D7gNLB7XH
+quxGDdYoDQWU/U9wRz1cwcNirYbFyMW3w3nUjpwrg7oh9K1ISgMkGI8Hi2Vp
+MuX6PRNTJicmy3jyzeITiKTkaEDV/wBDHFu0ZDpasZhb7V6z0oPYELczGOL4
+opVMLPFhiR9WtiVuZzDEiUUrzkZL8rnV7tVXQvmGuJ3BF+P/7qLdAwAA
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
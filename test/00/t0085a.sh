@@ -0,0 +1,123 @@
+#!/bin/sh
+#
+prog="redblackCache_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for cache budgets. The cost of an entry is its value.
+
+"Cost without a budget";
+l=create(10);
+for(x=100; x<105; x=x+1;)
+{
+  insert(l, x);
+}
+"Size"; x=size(l); print x;
+"Cost"; x=cost(l); print x;
+destroy(l);
+
+"Budget";
+for(p=0; p<4; p=p+1;)
+{
+  l=create(100);
+  "Policy"; print p;
+  policy(l, p);
+  x=budget(l, 1000); print x;
+  for(x=0; x<3000; x=x+1;)
+  {
+    y = rand(200);
+    r = find(l, y);
+    if (r == 0)
+    {
+      insert(l, y);
+    }
+    c = cost(l);
+    if (c > 1000)
+    {
+      "!!!Budget FAILED!!!"; print c; x=1000000;
+    }
+  }
+  "Size"; x=size(l); print x;
+  "Cost"; x=cost(l); print x;
+  "Check"; x=check(l); print x;
+  x=stats(l);
+
+  "Insert a large entry";
+  y=900; insert(l, y);
+  "Size"; x=size(l); print x;
+  "Cost"; x=cost(l); print x;
+  walk(l, show);
+
+  "Clear";
+  clear(l);
+  "Cost"; x=cost(l); print x;
+  destroy(l);
+}
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sArdJNbsMgEAXg/ZyCI/ATHLytV91F6gmoO4pR
+iLEAt01P32mwo9SqUCt1YSHmgfz5yV1Imb25PIQ5M8ue55cjZnhyHwgaOgpp
+eSjDQ/CuvwAHUXJT8lY10A3Yn2juQzjNU2KKcw6Dy4mJnYazSwkTk0ZrcGPC
+mF0Yl33EydsezzjSYQ746vo13e0B3ycXbRlweLzeJaW38YiMrsRLoYiFQm/9
+ejqPNpYRX9liZQu5HDaq6jZ3brlxy6qb/6db3ty8JKbd19xku7npG765aV9x
+K/Nr91ph01zdtPxEV9s/RYpq4+Ku8XbTeFuTa/FnuSqNq03pn9Ycu3APAwAA
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,133 @@
+#!/bin/sh
+#
+prog="splayCache_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for cache entry expiry. The interpreter clock advances by one
+# each time a find() or an insert() reads it.
+
+"Entries expire 5 operations after they are inserted";
+l=create(10);
+x=ttl(l, 5); print x;
+for(x=0; x<3; x=x+1;)
+{
+  insert(l, x);
+}
+"Size"; x=size(l); print x;
+for(x=0; x<5; x=x+1;)
+{
+  y=2; r=find(l, y);
+  if (r == 0)
+  {
+    "Miss";
+  }
+  else
+  {
+    "Hit";
+  }
+  "Size"; z=size(l); print z;
+}
+walk(l, show);
+
+"Replacing an entry renews its time to live";
+y=3; insert(l, y);
+for(x=0; x<3; x=x+1;)
+{
+  y=3; insert(l, y);
+  y=4; r=find(l, y);
+}
+"Size"; x=size(l); print x;
+walk(l, show);
+destroy(l);
+
+"Expiry with each policy";
+for(p=0; p<4; p=p+1;)
+{
+  l=create(50);
+  "Policy"; print p;
+  policy(l, p);
+  x=ttl(l, 150); print x;
+  for(x=0; x<3000; x=x+1;)
+  {
+    y = rand(200);
+    r = find(l, y);
+    if (r == 0)
+    {
+      insert(l, y);
+    }
+  }
+  "Size"; x=size(l); print x;
+  "Check"; x=check(l); print x;
+  x=stats(l);
+  destroy(l);
+}
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAtZBNTsMwEIX3c4o5gn9wkq5RJTaVUHsCKwxk
+1MS2bNMSTo+bEJUgUXXDyu9pNP7em63LkSkhfQSOhAZ9oGgze5fQvmaKmDsa
+0ZYZu0Qx0wtIOPAngYYnzrekukoJO05p1gL2FHrbsntD65BKghEjOTon5Jww
+80CYPfZ8omVbw/YScMQz5w7Jth0G33M7wvP8iCWVEfDYUXssvvf++B4SaiEE
+dJevay1hKEFKYaWqDcyVprKTj1MwGkqmhALoxO08lY2SMN3o+zZ60yxoeR9a
+iSu6EWt08X+jpdErtBR1vbDVf9euHta1jVnQ+k60+YE2v9DmBrqS9QptysW/
+ACd+p4CuAgAA
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
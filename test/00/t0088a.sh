@@ -0,0 +1,129 @@
+#!/bin/sh
+#
+prog="binaryHeap_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for d-ary binaryHeap_t. create(d) creates a heap in which each
+# entry has up to d children.
+
+"4-ary heap";
+h=create(4);
+for(x=10; x>0; x=x-1;)
+{
+  push(h,x);
+}
+"Show";
+walk(h,show);
+"Pop";
+for(x=0; x<10; x=x+1;)
+{
+  "Peek : "; print peek(h);
+  pop(h);
+  "Check : "; print check(h);
+}
+destroy(h);
+
+"Random tests";
+for(d=2; d<10; d=d+d;)
+{
+  "Arity : "; print d;
+  h=create(d);
+  for (i=0;i<2000;i=i+1;)
+  {
+    if (rand(100) > 50) { y=rand(100); push(h,y); }
+    if (rand(100) > 50) { pop(h); }
+    c=check(h);
+    if (c == 0)
+    {
+      "!!!Check FAILED!!!"; i=2000;
+    }
+  }
+  "Size : "; print size(h);
+  "Check : "; print check(h);
+  "Pop in order";
+  l=0;
+  for (s=size(h); s>0; s=s-1;)
+  {
+    x=peek(h);
+    if (x < l)
+    {
+      "!!!Order FAILED!!!";
+    }
+    l=x;
+    pop(h);
+  }
+  "Size : "; print size(h);
+  destroy(h);
+}
+
+# Done
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAlZBNCsIwEEb3OcUcQKFJkzR1J+5F9ATFDrSo
+TUkLoqd3dLRVGkEhAzPvfSE/el6EC1RYtGJX+bNY+xIhgQW0RcCmf7T7qj6W
+NIEEmIGiSqk0Gcl5+SVv7nlLlVE5Minn1Zd8DjQpzqSfGVqOhZ6IjIUZhWQh
+EzZ2YiyLbCIMCzcRmkU+CsUiFxvfig3igQYhxarC/bN9QRWDaQzqGDQxaGMw
+i0EXg3kM0n+90W3RlP4EPXZ9J5ah7i/8ll19xUf3eS/fQt2ADyWGIZKM+/QA
+rftnnxug+eW8G3Z6MY3QAgAA
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
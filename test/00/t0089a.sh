@@ -0,0 +1,151 @@
+#!/bin/sh
+#
+prog="pairingHeap_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for pairingHeap_t. meld(h,g) moves the entries of g into h.
+
+"Push";
+h=create();
+for(x=10; x>0; x=x-1;)
+{
+  push(h,x);
+}
+"Show";
+walk(h,show);
+"Depth : "; print depth(h);
+"Pop";
+for(x=0; x<5; x=x+1;)
+{
+  "Peek : "; print peek(h);
+  pop(h);
+  "Check : "; print check(h);
+}
+"Show";
+walk(h,show);
+"Depth : "; print depth(h);
+
+"Meld";
+g=create();
+for(x=1; x<20; x=x+3;)
+{
+  push(g,x);
+}
+"Meld : "; print meld(h,g);
+"Size h : "; print size(h);
+"Size g : "; print size(g);
+"Check : "; print check(h);
+"Meld empty : "; print meld(h,g);
+"Size h : "; print size(h);
+"Pop in order";
+for (s=size(h); s>0; s=s-1;)
+{
+  print peek(h);
+  pop(h);
+}
+"Check : "; print check(h);
+destroy(g);
+
+"Random tests";
+g=create();
+for (i=0;i<2000;i=i+1;)
+{
+  if (rand(100) > 50) { y=rand(100); push(h,y); }
+  if (rand(100) > 50) { y=rand(100); push(g,y); }
+  if (rand(100) > 60) { pop(h); }
+  if (rand(100) > 95) { meld(h,g); }
+  c=check(h);
+  if (c == 0)
+  {
+    "!!!Check FAILED!!!"; i=2000;
+  }
+}
+meld(h,g);
+"Size : "; print size(h);
+"Check : "; print check(h);
+"Pop in order";
+l=0;
+for (s=size(h); s>0; s=s-1;)
+{
+  x=peek(h);
+  if (x < l)
+  {
+    "!!!Order FAILED!!!";
+  }
+  l=x;
+  pop(h);
+}
+"Size : "; print size(h);
+destroy(g);
+destroy(h);
+
+# Done
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAbZBRDsIgEET/5xR7BGihWn/116TRExi7kUZb
+mhZj9PQW2hpMSAjZeSyzA9VzNDgb+4JEhhwKGgU22KKEFDhw7wztyNeV7VEx
+34PE3vB1KVeYpWCegioFdQxDpFQQjSM/6rAtnc2Hac6YzeLmhYjdQje3vXsn
+7kzvoqYjO9Q8TGcqjP0N9iuHLCDL2PF06WrbkuPRjbOdx7L8/5jYeW0S+ALE
+6zWqdAEAAA==
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
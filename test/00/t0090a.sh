@@ -0,0 +1,136 @@
+#!/bin/sh
+#
+prog="binaryHeap_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Test file for top-K mode of binaryHeap_t. topk(h,k) makes an empty heap
+# keep the k greatest entries pushed onto it.
+
+"Top 5 of 1 to 20";
+h=create();
+"Top-K : "; print topk(h,5);
+for(x=1; x<=20; x=x+1;)
+{
+  push(h,x);
+  "Size : "; print size(h);
+}
+"Check : "; print check(h);
+"Pop";
+for(s=size(h); s>0; s=s-1;)
+{
+  print peek(h);
+  pop(h);
+}
+
+"Top 5 of 20 to 1";
+for(x=20; x>0; x=x-1;)
+{
+  push(h,x);
+}
+"Show";
+walk(h,show);
+clear(h);
+
+"Random tests";
+for(d=2; d<10; d=d+d;)
+{
+  "Arity : "; print d;
+  g=create(d);
+  topk(g,50);
+  for (i=0;i<2000;i=i+1;)
+  {
+    y=rand(1000); push(g,y);
+    c=check(g);
+    if (c == 0)
+    {
+      "!!!Check FAILED!!!"; i=2000;
+    }
+  }
+  "Size : "; print size(g);
+  "Pop in order";
+  l=0;
+  for (s=size(g); s>0; s=s-1;)
+  {
+    x=peek(g);
+    if (x < l)
+    {
+      "!!!Order FAILED!!!";
+    }
+    l=x;
+    pop(g);
+  }
+  "Greatest : "; print l;
+  destroy(g);
+}
+destroy(h);
+
+# Done
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok.gz.uue << 'EOF'
+begin-base64 644 test.ok.gz
+H4sICAAAAAAC/3Rlc3Qub2sAzZFBCsIwEEX3c4o5gEKStrZ1Jy5cCCLaCxQb
+aVE7IQ2Int5JAy1FBN25+8n7P8yfFGQwQTqjREeoBBRk5ltcIkg4Nk89VWpQ
+0aDiQSV/qta1Pl1CkT0ZkAuQKcgMZA6hcNiAEn4FXLamO+yo0ig4ZEqrW9fL
+U91cKz7xrnCGim/4qd4oPxgjb4y9MQ1GNTV6kgcSjUQGwrP1JH4jPPuhbCu6
+odOd62BlG/eY/k8ifFdsWiRbaQsbq0tv9izPszES/x7Jvo68ALx+pqFeAgAA
+====
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+uudecode test.ok.gz.uue
+if [ $? -ne 0 ]; then echo "Failed output uudecode"; fail; fi
+
+gunzip -f test.ok.gz
+if [ $? -ne 0 ]; then echo "Failed output gunzip"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,148 @@
+#!/bin/sh
+#
+prog="skipListLockFree_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check the lock-free skipList with equal entries and ranges
+l=create(16);
+for (x=0;x<100;x=x+1;)
+{
+  insert(l, x%50);
+}
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Walk [10, 13)"; a=10; b=13; walkrange(l, &a, &b, show);
+"Remove"; x=12; p=remove(l, &x); print (p==0);
+"Walk [10, 13)"; a=10; b=13; walkrange(l, &a, &b, show);
+"Remove again"; x=12; p=remove(l, &x); print (p==0);
+"Remove missing"; x=12; p=remove(l, &x); print (p==0);
+"Find removed"; x=12; p=find(l, x); print (p==0);
+"Min"; p=min(l); print *p;
+"Max"; p=max(l); print *p;
+"Next"; x=20; p=find(l, x); p=next(l, p); print *p;
+"Previous"; x=20; p=find(l, x); p=previous(l, p); print *p;
+"Remove [20, 30)"; a=20; b=30; x=removerange(l, &a, &b); print x;
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Walk [18, 32)"; a=18; b=32; walkrange(l, &a, &b, show);
+for (x=0;x<5000;x=x+1;)
+{
+  insert(l, rand(500));
+  y=rand(500);
+  remove(l, &y);
+}
+"Check";x=check(l); print x;
+clear(l);
+"Size after clear";x=size(l);print x;
+"Check";x=check(l); print x;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+Size
+100
+Check
+1
+Walk [10, 13)
+10
+10
+11
+11
+12
+12
+Remove
+1
+Walk [10, 13)
+10
+10
+11
+11
+12
+Remove again
+1
+Remove missing
+1
+Find removed
+1
+Min
+0
+Max
+49
+Next
+20
+Previous
+19
+Remove [20, 30)
+20
+Size
+78
+Check
+1
+Walk [18, 32)
+18
+18
+19
+19
+30
+30
+31
+31
+Check
+1
+Size after clear
+0
+Check
+1
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,175 @@
+#!/bin/sh
+#
+prog="skipList_interp"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+# Check skipList finger search
+l=create();
+x=finger(l, 1); print x;
+"Insert ascending";
+for (x=0;x<2000;x=x+1;)
+{
+  insert(l, x);
+}
+"Insert descending";
+for (x=3000;x>=2000;x=x-1;)
+{
+  insert(l, x);
+}
+"Insert duplicates";
+for (x=0;x<100;x=x+3;)
+{
+  insert(l, x);
+}
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+"Find near";
+for (x=500;x<505;x=x+1;)
+{
+  p=find(l, x); print *p;
+}
+"Find back";
+x=10; p=find(l, x); print *p;
+x=2999; p=find(l, x); print *p;
+x=3; p=find(l, x); print *p;
+"Find missing"; x=3001; p=find(l, x); print (p==0);
+"Next"; x=9; p=find(l, x); p=next(l, p); print *p;
+"Previous"; x=9; p=find(l, x); p=previous(l, p); print *p;
+"Remove near";
+for (x=1000;x<1500;x=x+1;)
+{
+  remove(l, &x);
+}
+"Remove duplicate"; x=3; p=remove(l, &x); print (p==0);
+"Walk [0, 10)"; a=0; b=10; walkrange(l, &a, &b, show);
+"Remove [1490, 1510)"; a=1490; b=1510; x=removerange(l, &a, &b); print x;
+"Size";x=size(l);print x;
+"Check";x=check(l); print x;
+for (x=0;x<5000;x=x+1;)
+{
+  y=rand(4000);
+  insert(l, y);
+  y=y+rand(10)-5;
+  remove(l, &y);
+}
+"Check";x=check(l); print x;
+x=finger(l, 0); print x;
+for (x=0;x<1000;x=x+1;)
+{
+  y=rand(4000);
+  remove(l, &y);
+}
+"Check";x=check(l); print x;
+clear(l);
+"Size after clear";x=size(l);print x;
+destroy(l);
+exit;
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+1
+Insert ascending
+Insert descending
+Insert duplicates
+Size
+3035
+Check
+1
+Find near
+500
+501
+502
+503
+504
+Find back
+10
+2999
+3
+Find missing
+1
+Next
+9
+Previous
+8
+Remove near
+Remove duplicate
+1
+Walk [0, 10)
+0
+0
+1
+2
+3
+4
+5
+6
+6
+7
+8
+9
+9
+Remove [1490, 1510)
+10
+Size
+2524
+Check
+1
+Check
+1
+1
+Check
+1
+Size after clear
+0
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
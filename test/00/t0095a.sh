@@ -0,0 +1,122 @@
+#!/bin/sh
+#
+prog="splayTreeSplit_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+split at 0
+tree: size 0
+left: size 0
+right: size 0
+joined: size 0
+emptied: size 0
+split at 5
+tree: size 0
+left: size 0
+right: size 10 min 10 max 100
+joined: size 10 min 10 max 100
+emptied: size 0
+split at 50
+tree: size 0
+left: size 4 min 10 max 40
+right: size 6 min 50 max 100
+joined: size 10 min 10 max 100
+emptied: size 0
+split at 55
+tree: size 0
+left: size 5 min 10 max 50
+right: size 5 min 60 max 100
+joined: size 10 min 10 max 100
+emptied: size 0
+split at 105
+tree: size 0
+left: size 10 min 10 max 100
+right: size 0
+joined: size 10 min 10 max 100
+emptied: size 0
+check: true
+Entries in left tree not less than right tree!
+join overlapping: failed
+tree: size 10 min 10 max 100
+other: size 1 min 50 max 50
+Can't join trees with different callbacks!
+join different user: failed
+tree: size 10 min 10 max 100
+other: size 1 min 200 max 200
+join empty right: succeeded
+join empty left: succeeded
+other: size 10 min 10 max 100
+tree: size 0
+split at 7
+tree: size 0
+left: size 0
+right: size 1 min 7 max 7
+joined: size 1 min 7 max 7
+emptied: size 0
+split at 8
+tree: size 0
+left: size 1 min 7 max 7
+right: size 0
+joined: size 1 min 7 max 7
+emptied: size 0
+split at 1000000
+tree: size 0
+left: size 1000000 min 0 max 999999
+right: size 2000000 min 1000000 max 2999999
+joined: size 3000000 min 0 max 2999999
+emptied: size 0
+find 1000000: found
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,101 @@
+#!/bin/sh
+#
+prog="redblackCacheHashed_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+insert 0 4 8 12 1 5 9 13
+find 0:0 1:4 2:miss 3:miss 4:1 5:5 6:miss 7:miss 8:2 9:6 10:miss 11:miss 12:3 13:7 14:miss 15:miss 16:miss
+size 8 check true lru 13 12 9 8 5 4 1 0
+hits 8 misses 9 insertions 8 replacements 0 evictions 0 expirations 0
+replace 8
+find 8:80
+size 8 check true lru 8 13 12 9 5 4 1 0
+hits 9 misses 9 insertions 8 replacements 1 evictions 0 expirations 0
+insert 16 20
+find 0:0
+find 0:0 1:miss 2:miss 3:miss 4:miss 5:5 6:miss 7:miss 8:80 9:6 10:miss 11:miss 12:3 13:7 14:miss 15:miss 16:16 17:miss 18:miss 19:miss 20:20
+size 8 check true lru 20 16 13 12 9 8 5 0
+hits 18 misses 22 insertions 10 replacements 1 evictions 2 expirations 0
+insert 2 6 10 14 18 22 26 30
+find 0:miss 1:miss 2:2 3:miss 4:miss 5:miss 6:6 7:miss 8:miss 9:miss 10:10 11:miss 12:miss 13:miss 14:14 15:miss 16:miss 17:miss 18:18 19:miss 20:miss 21:miss 22:22 23:miss 24:miss 25:miss 26:26 27:miss 28:miss 29:miss 30:30
+size 8 check true lru 30 26 22 18 14 10 6 2
+hits 26 misses 45 insertions 18 replacements 1 evictions 10 expirations 0
+clear
+find 2:miss
+find 2:200
+size 1 check true lru 2
+hits 27 misses 46 insertions 19 replacements 1 evictions 10 expirations 0
+insert 1 5 9 13 with ttl 10 20 10 20
+find 1:miss 2:miss 3:miss 4:miss 5:5 6:miss 7:miss 8:miss 9:miss 10:miss 11:miss 12:miss 13:13
+size 2 check true lru 13 5
+hits 2 misses 11 insertions 4 replacements 0 evictions 0 expirations 2
+find 1:miss 2:miss 3:miss 4:miss 5:miss 6:miss 7:miss 8:miss 9:miss 10:miss 11:miss 12:miss 13:miss
+size 0 check true lru
+hits 2 misses 24 insertions 4 replacements 0 evictions 0 expirations 4
+hashed insert 1 to 16 then 1 2
+live 8
+find 1:100 2:200 3:miss 4:miss
+size 8 check true lru 16 15 14 13 12 11 2 1
+hits 2 misses 2 insertions 18 replacements 0 evictions 10 expirations 0
+live 8
+tree insert 1 to 16 then 1 2
+live 8
+find 1:100 2:200 3:miss 4:miss
+size 8 check true lru 16 15 14 13 12 11 2 1
+hits 2 misses 2 insertions 18 replacements 0 evictions 10 expirations 0
+live 8
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
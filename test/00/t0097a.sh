@@ -0,0 +1,95 @@
+#!/bin/sh
+#
+prog="redblackTreeCursor_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+new: NULL
+next: NULL
+previous: NULL
+first: NULL
+last: NULL
+seek 10: NULL
+forwards: 10 20 30 40 50 60 70 80 90 100
+next after last: NULL
+backwards: 100 90 80 70 60 50 40 30 20 10
+previous before first: NULL
+meet: 10/100 20/90 30/80 40/70 50/60
+seek 45: 50
+entry: 50
+next: 55
+previous: 50
+previous: 45
+previous: 40
+next: 45
+remove 40: 40
+remove 55: 55
+remove 10: 10
+remove 100: 100
+entry: 45
+next: 50
+previous: 45
+previous: 30
+previous: 20
+previous: NULL
+previous: NULL
+remove 50: 50
+seek 50: 60
+previous: 45
+last: 90
+seek 100: NULL
+check: true
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,89 @@
+#!/bin/sh
+#
+prog="redblackTreeRank_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+select 0: NULL
+rank 0: 0
+select 0: 0
+select 1: 2
+select 999: 1998
+select 1000: NULL
+select 1000000: NULL
+rank -1: 0
+rank 0: 0
+rank 1: 1
+rank 2: 1
+rank 1998: 999
+rank 2000: 1000
+order: 1000 entries, check true
+select 0: 2
+select 665: 1996
+select 666: NULL
+rank 0: 0
+rank 2: 0
+rank 6: 2
+rank 8: 2
+rank 1996: 665
+rank 1998: 666
+order: 666 entries, check true
+select 0: 1000
+select 1: NULL
+rank 1000: 0
+rank 1001: 1
+order: 1 entries, check true
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
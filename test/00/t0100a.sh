@@ -0,0 +1,107 @@
+#!/bin/sh
+#
+prog="binaryHeapHandle_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+handle 0: 10
+handle 1: 40
+handle 2: 20
+handle 3: 50
+handle 4: 30
+update 4: ok
+peek: 5
+update 4: ok
+peek: 10
+remove 0: 10
+remove 2: 20
+remove 4: 60
+size: 3 check true
+pop: 40
+binaryHeapValidHandle: invalid handle!
+handle 0: NULL
+handle 3: 50
+binaryHeapValidHandle: invalid handle!
+update 2: failed
+binaryHeapValidHandle: invalid handle!
+remove 4: NULL
+binaryHeapValidHandle: invalid handle!
+handle 1: NULL
+binaryHeapValidHandle: invalid handle!
+handle 0: NULL
+handle 5: 15
+handle 6: 25
+handle 0: 35
+handle 2: 55
+handle 4: 65
+size: 7
+check true pop 15 25 35 45 50 55 65
+binaryHeapValidHandle: invalid handle!
+handle 0: NULL
+binaryHeapValidHandle: invalid handle!
+handle 2: NULL
+binaryHeapValidHandle: invalid handle!
+handle 0: NULL
+binaryHeapValidHandle: invalid handle!
+handle 1: NULL
+topk: ok
+push 4:5: rejected
+binaryHeapValidHandle: invalid handle!
+handle 0: NULL
+handle 1: 20
+handle 2: 30
+handle 3: 40
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
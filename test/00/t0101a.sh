@@ -0,0 +1,99 @@
+#!/bin/sh
+#
+prog="binaryHeapBatch_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+from none: size 0 check true pop
+from one: size 1 check true pop 0
+from seven: size 7 check true pop 0 14 95 176 257 338 419
+from all: size 1000 check true pop 1000 in order
+binaryHeapPushBatch: invalid entries == NULL!
+from NULL: failed
+arity 2
+none: size 0 check true pop
+one: size 1 check true pop 95
+nine: size 9 check true pop 0 14 95 176 257 338 352 419 433
+all: size 1000 check true pop 1000 in order
+few into many: size 1000 check true pop 1000 in order
+many into few: size 1000 check true pop 1000 in order
+one into few: size 9 check true pop 0 14 95 176 257 338 352 419 433
+arity 3
+none: size 0 check true pop
+one: size 1 check true pop 95
+nine: size 9 check true pop 0 14 95 176 257 338 352 419 433
+all: size 1000 check true pop 1000 in order
+few into many: size 1000 check true pop 1000 in order
+many into few: size 1000 check true pop 1000 in order
+one into few: size 9 check true pop 0 14 95 176 257 338 352 419 433
+arity 4
+none: size 0 check true pop
+one: size 1 check true pop 95
+nine: size 9 check true pop 0 14 95 176 257 338 352 419 433
+all: size 1000 check true pop 1000 in order
+few into many: size 1000 check true pop 1000 in order
+many into few: size 1000 check true pop 1000 in order
+one into few: size 9 check true pop 0 14 95 176 257 338 352 419 433
+arity 8
+none: size 0 check true pop
+one: size 1 check true pop 95
+nine: size 9 check true pop 0 14 95 176 257 338 352 419 433
+all: size 1000 check true pop 1000 in order
+few into many: size 1000 check true pop 1000 in order
+many into few: size 1000 check true pop 1000 in order
+one into few: size 9 check true pop 0 14 95 176 257 338 352 419 433
+top 5: size 5 check true pop 497 498 498 499 499
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
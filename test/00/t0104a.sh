@@ -0,0 +1,88 @@
+#!/bin/sh
+#
+prog="redblackCacheClock_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+insert 1:
+insert 2:
+insert 3:
+insert 4:
+size 4 check true list 4 3 2 1
+find 1: hit
+find 3: hit
+insert 5: evict 2
+size 4 check true list 4 3 5 1
+insert 6: evict 4
+size 4 check true list 6 3 5 1
+find 1: hit
+find 3: hit
+find 5: hit
+find 6: hit
+insert 7: evict 1
+size 4 check true list 6 3 5 7
+insert 8: evict 5
+size 4 check true list 6 3 8 7
+find 7: hit
+insert 9: evict 3
+insert 10: evict 6
+insert 11: evict 8
+size 4 check true list 10 9 11 7
+insert 12: evict 9
+insert 13: evict 10
+insert 14: evict 7
+size 4 check true list 13 12 11 14
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,82 @@
+#!/bin/sh
+#
+prog="trbTreeInline_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+without an arena
+insert existing: 7:0
+size: 20 check true
+find: 13:130
+remove: NULL
+find removed: NULL
+upper: 14
+lower: 12
+walk: 1:10 3:30 5:50 7:0 9:90 11:110 15:150 17:170 19:190
+size: 511 check true
+size after clear: 0
+with an arena
+insert existing: 7:0
+size: 20 check true
+find: 13:130
+remove: NULL
+find removed: NULL
+upper: 14
+lower: 12
+walk: 1:10 3:30 5:50 7:0 9:90 11:110 15:150 17:170 19:190
+size: 511 check true
+size after clear: 0
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass
@@ -0,0 +1,99 @@
+#!/bin/sh
+#
+prog="pairingHeapHandle_test"
+tmp=/tmp/$$
+here=`pwd`
+bin=$here/bin
+if [ $? -ne 0 ]; then echo "Failed pwd"; exit 1; fi
+
+
+fail()
+{
+        echo FAILED $prog 1>&2
+        cd $here
+        rm -rf $tmp
+        exit 1
+}
+
+
+pass()
+{
+        echo PASSED $prog
+        cd $here
+        rm -rf $tmp
+        exit 0
+}
+
+trap "fail" 1 2 3 15
+mkdir $tmp
+if [ $? -ne 0 ]; then echo "Failed mkdir"; exit 1; fi
+cd $tmp
+if [ $? -ne 0 ]; then echo "Failed cd"; fail; fi
+
+#
+# the input should look like this
+#
+cat > test.in << 'EOF'
+EOF
+if [ $? -ne 0 ]; then echo "Failed input cat"; fail; fi
+
+#
+# the output should look like this
+#
+cat > test.ok << 'EOF'
+handle 0: 10
+handle 1: 40
+handle 2: 20
+handle 3: 50
+handle 4: 30
+decrease 4: ok
+peek: 5
+remove 4: 5
+remove 2: 20
+size: 4 check true
+pop: 10
+pairingHeapValidHandle: invalid handle!
+handle 0: NULL
+handle 3: 50
+pairingHeapValidHandle: invalid handle!
+decrease 2: failed
+pairingHeapValidHandle: invalid handle!
+remove 4: NULL
+handle 1: 40
+pairingHeapValidHandle: invalid handle!
+handle 0: NULL
+handle 5: 15
+handle 6: 25
+meld: ok
+decrease 7: ok
+peek: 1
+handle 0: 55
+handle 2: 65
+handle 4: 75
+size: 9
+check true pop 1 15 25 40 45 50 55 65 75
+pairingHeapValidHandle: invalid handle!
+handle 0: NULL
+pairingHeapValidHandle: invalid handle!
+handle 2: NULL
+pairingHeapValidHandle: invalid handle!
+handle 0: NULL
+pairingHeapValidHandle: invalid handle!
+handle 1: NULL
+EOF
+if [ $? -ne 0 ]; then echo "Failed output cat"; fail; fi
+
+#
+# run and see if the results match
+#
+$VALGRIND_CMD $bin/$prog <test.in >test.out
+if [ $? -ne 0 ]; then echo "Failed running $prog"; fail; fi
+
+diff test.ok test.out
+if [ $? -ne 0 ]; then echo "Failed diff"; fail; fi
+
+
+#
+# this much worked
+#
+pass